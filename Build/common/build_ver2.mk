@@ -4,10 +4,10 @@
 
 # files 
 
-OBJS := cbios.o waveram.o Application.o Main.o stm32f10x_nvic.o cortexm3_macro.o interrupt.o startup.o GraphOsc.o Controls.o Settings.o Utils.o Wnd.o MainWnd.o MenuInput.o Toolbar.o MainMenu.o MenuSpectMain.o Calibration.o Serialize.o CalibAnalog.o CalibDac.o CalibMenu.o Calibration.o MenuMarker.o ToolBox.o MenuMeas.o Manager.o ChannelMath.o MenuMath.o MenuDisp.o SpectrumGraph.o MenuSpectMarker.o Annot.o Export.o MenuGenMain.o MenuGenEdit.o MenuGenModulation.o CoreGenerator.o Import.o CoreOscilloscope.o FFT.o Shapes.o Statistics.o _Modules.o MenuMask.o FirFilter.o
+OBJS := cbios.o waveram.o Application.o Main.o stm32f10x_nvic.o cortexm3_macro.o interrupt.o startup.o GraphOsc.o ColumnTemplates.o Controls.o Settings.o Utils.o Perf.o FramePacer.o Wnd.o MainWnd.o MenuInput.o Toolbar.o MainMenu.o MenuSpectMain.o Calibration.o Serialize.o CalibAnalog.o CalibDac.o CalibMenu.o Calibration.o MenuMarker.o ToolBox.o MenuMeas.o Manager.o ChannelMath.o MenuMath.o MenuDisp.o SpectrumGraph.o MenuSpectMarker.o Annot.o Export.o MenuGenMain.o MenuGenEdit.o MenuGenModulation.o CoreGenerator.o Import.o CoreOscilloscope.o CaptureStore.o CoreSequence.o CoreRoll.o CoreShared.o Resampler.o Interpolator.o SoftTrigger.o CoreEts.o CorePeak.o CoreHiRes.o CoreAverage.o CorePhosphor.o CoreRecorder.o FFT.o Shapes.o Statistics.o _Modules.o MenuMask.o FirFilter.o
 C_SRCS := ../Source/HwLayer/ArmM3/stm32f10x/src/stm32f10x_nvic.c ../Source/HwLayer/ArmM3/src/interrupt.c ../Source/HwLayer/ArmM3/src/startup.c
 ASM_SRCS := ../Source/HwLayer/ArmM3/stm32f10x/asm/cortexm3_macro.s ../Source/HwLayer/ArmM3/src/BIOS.S
-CPP_SRCS := ../Source/HwLayer/ArmM3/src/main.cpp ../Source/HwLayer/ArmM3/src/cbios.cpp ../Source/HwLayer/ArmM3/src/waveram.cpp ../Source/Core/Controls.cpp ../Source/Core/Settings.cpp ../Source/Core/Utils.cpp ../Source/Framework/Wnd.cpp ../Source/Gui/Generator/Main/MenuGenMain.cpp ../Source/Gui/Generator/Core/CoreGenerator.cpp ../Source/Gui/Generator/Edit/MenuGenEdit.cpp ../Source/Gui/Generator/Modulation/MenuGenModulation.cpp ../Source/Gui/Oscilloscope/Controls/GraphOsc.cpp ../Source/Gui/Oscilloscope/Marker/MenuMarker.cpp ../Source/Gui/MainWnd.cpp ../Source/Gui/Oscilloscope/Input/MenuInput.cpp ../Source/Main/Application.cpp ../Source/Gui/Toolbar.cpp ../Source/Gui/MainMenu.cpp ../Source/Gui/Spectrum/Main/MenuSpectMain.cpp ../Source/Core/Serialize.cpp ../Source/Gui/Calibration/CalibAnalog.cpp ../Source/Gui/Calibration/CalibDac.cpp ../Source/Gui/Calibration/CalibMenu.cpp ../Source/Gui/Calibration/Calibration.cpp ../Source/Gui/ToolBox/ToolBox.cpp ../Source/Gui/ToolBox/Import.cpp ../Source/Gui/Oscilloscope/Meas/MenuMeas.cpp ../Source/Gui/Oscilloscope/Meas/Statistics.cpp ../Source/Gui/ToolBox/Manager.cpp ../Source/Gui/Oscilloscope/Math/ChannelMath.cpp ../Source/Gui/Oscilloscope/Math/MenuMath.cpp ../Source/Gui/Oscilloscope/Disp/MenuDisp.cpp ../Source/Gui/Spectrum/Controls/SpectrumGraph.cpp ../Source/Gui/Spectrum/Marker/MenuSpectMarker.cpp ../Source/Gui/Spectrum/Controls/Annot.cpp ../Source/Gui/Toolbox/Export.cpp ../Source/Gui/Oscilloscope/Core/CoreOscilloscope.cpp ../Source/Gui/Spectrum/Core/FFT.cpp ../Source/Core/Shapes.cpp ../Source/User/_Modules.cpp ../Source/Gui/Oscilloscope/Mask/MenuMask.cpp ../Source/Gui/Oscilloscope/Math/FirFilter.cpp
+CPP_SRCS := ../Source/HwLayer/ArmM3/src/main.cpp ../Source/HwLayer/ArmM3/src/cbios.cpp ../Source/HwLayer/ArmM3/src/waveram.cpp ../Source/Core/Controls.cpp ../Source/Core/Settings.cpp ../Source/Core/Utils.cpp ../Source/Core/Perf.cpp ../Source/Core/FramePacer.cpp ../Source/Framework/Wnd.cpp ../Source/Gui/Generator/Main/MenuGenMain.cpp ../Source/Gui/Generator/Core/CoreGenerator.cpp ../Source/Gui/Generator/Edit/MenuGenEdit.cpp ../Source/Gui/Generator/Modulation/MenuGenModulation.cpp ../Source/Gui/Oscilloscope/Controls/GraphOsc.cpp ../Source/Gui/Oscilloscope/Controls/ColumnTemplates.cpp ../Source/Gui/Oscilloscope/Marker/MenuMarker.cpp ../Source/Gui/MainWnd.cpp ../Source/Gui/Oscilloscope/Input/MenuInput.cpp ../Source/Main/Application.cpp ../Source/Gui/Toolbar.cpp ../Source/Gui/MainMenu.cpp ../Source/Gui/Spectrum/Main/MenuSpectMain.cpp ../Source/Core/Serialize.cpp ../Source/Gui/Calibration/CalibAnalog.cpp ../Source/Gui/Calibration/CalibDac.cpp ../Source/Gui/Calibration/CalibMenu.cpp ../Source/Gui/Calibration/Calibration.cpp ../Source/Gui/ToolBox/ToolBox.cpp ../Source/Gui/ToolBox/Import.cpp ../Source/Gui/Oscilloscope/Meas/MenuMeas.cpp ../Source/Gui/Oscilloscope/Meas/Statistics.cpp ../Source/Gui/ToolBox/Manager.cpp ../Source/Gui/Oscilloscope/Math/ChannelMath.cpp ../Source/Gui/Oscilloscope/Math/MenuMath.cpp ../Source/Gui/Oscilloscope/Disp/MenuDisp.cpp ../Source/Gui/Spectrum/Controls/SpectrumGraph.cpp ../Source/Gui/Spectrum/Marker/MenuSpectMarker.cpp ../Source/Gui/Spectrum/Controls/Annot.cpp ../Source/Gui/Toolbox/Export.cpp ../Source/Gui/Oscilloscope/Core/CoreOscilloscope.cpp ../Source/Gui/Oscilloscope/Core/CaptureStore.cpp ../Source/Gui/Oscilloscope/Core/CoreSequence.cpp ../Source/Gui/Oscilloscope/Core/CoreRoll.cpp ../Source/Gui/Oscilloscope/Core/CoreShared.cpp ../Source/Gui/Oscilloscope/Core/Resampler.cpp ../Source/Gui/Oscilloscope/Core/Interpolator.cpp ../Source/Gui/Oscilloscope/Core/SoftTrigger.cpp ../Source/Gui/Oscilloscope/Core/CoreEts.cpp ../Source/Gui/Oscilloscope/Core/CorePeak.cpp ../Source/Gui/Oscilloscope/Core/CoreHiRes.cpp ../Source/Gui/Oscilloscope/Core/CoreAverage.cpp ../Source/Gui/Oscilloscope/Core/CorePhosphor.cpp ../Source/Gui/Oscilloscope/Core/CoreRecorder.cpp ../Source/Gui/Spectrum/Core/FFT.cpp ../Source/Core/Shapes.cpp ../Source/User/_Modules.cpp ../Source/Gui/Oscilloscope/Mask/MenuMask.cpp ../Source/Gui/Oscilloscope/Math/FirFilter.cpp
 
 
 
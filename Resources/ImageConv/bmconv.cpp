@@ -103,7 +103,103 @@ void pushclose(FILE* f)
 		pushfix4(f, 0);
 }
 
+// CBitmap fills runs of at least SPANMIN pixels with a single Bar, shorter runs
+// are copied into its row buffer like the unique sequences
+#define SPANMIN 16
 
+// Cost of drawing the bitmap on the DS203 in pixel writes. PutPixel sets the
+// cursor for every pixel, a span sets the LCD window and starts a transfer
+#define PIXELCOST 4
+#define TRANSFERCOST 32
+
+// transfers of the span decoder, follows CBitmap::Run and CBitmap::Pixel
+int simw, simx, simy, simpending, simtransfers, simopaque;
+
+void simflush()
+{
+	if ( simpending )
+		simtransfers++;
+	simpending = 0;
+}
+
+void simpixel(bool bTransparent)
+{
+	if ( bTransparent )
+		simflush();
+	else
+	{
+		simpending++;
+		simopaque++;
+	}
+	if ( simy & 1 )
+	{
+		if ( --simx < 0 )
+		{
+			simx++;
+			simflush();
+			simy++;
+		}
+	} else
+	{
+		if ( ++simx >= simw )
+		{
+			simx--;
+			simflush();
+			simy++;
+		}
+	}
+}
+
+void simrun(bool bTransparent, int n)
+{
+	while ( n > 0 )
+	{
+		int nStart = (simy & 1) ? simw-1 : 0;
+		if ( simx == nStart && n >= simw )
+		{
+			int nRows = n / simw;
+			simflush();
+			if ( !bTransparent )
+			{
+				simtransfers++;
+				simopaque += nRows*simw;
+			}
+			simy += nRows;
+			simx = (simy & 1) ? simw-1 : 0;
+			n -= nRows*simw;
+			continue;
+		}
+		int nLeft = (simy & 1) ? simx+1 : simw-simx;
+		int nSpan = n < nLeft ? n : nLeft;
+		if ( nSpan < SPANMIN && !bTransparent )
+		{
+			for (int i=0; i<nSpan; i++)
+				simpixel(false);
+		} else
+		{
+			simflush();
+			if ( !bTransparent )
+			{
+				simtransfers++;
+				simopaque += nSpan;
+			}
+			if ( nSpan == nLeft )
+			{
+				simx = (simy & 1) ? 0 : simw-1;
+				simy++;
+			} else
+				simx += (simy & 1) ? -nSpan : nSpan;
+		}
+		n -= nSpan;
+	}
+}
+
+// runs and unique sequences of the bitmap, nLen > 0 for a run
+struct TToken
+{
+	int nIndex;
+	int nLen;
+};
 
 int _tmain(int argc, _TCHAR* argv[])
 {
@@ -119,10 +215,9 @@ int _tmain(int argc, _TCHAR* argv[])
 "LINKERSECTION(\".extra\")\n"
 "/*static*/ const unsigned char CWndClassName::bitmapName[] = {\n\t");
 	unsigned char pbmp[400*200];
-	pushbyte(fo, 'G');
-	pushbyte(fo, bPalette ? 'B' : 'b' );
-	pushvlc8(fo, bmih.biWidth);
-	pushvlc8(fo, bmih.biHeight);
+	static TToken arrTokens[400*200];
+	int nTokens = 0;
+	unsigned int arrPalette[16] = {0};
 	printf( "w:%d, h:%d, c:%d\n", bmih.biWidth, bmih.biHeight, bmih.biClrUsed );
 	//bmih.biClrUsed = 16;
 	int i;
@@ -133,12 +228,10 @@ int _tmain(int argc, _TCHAR* argv[])
 		printf("clr %2d: %02x %02x %02x\n", i, clr.rgbRed, clr.rgbGreen, clr.rgbBlue );
 		
 		#define RGB565RGB(r, g, b) (((r)>>3)|(((g)>>2)<<5)|(((b)>>3)<<11))
-		if ( bPalette && i<16 )
-			pushword( fo, RGB565RGB( clr.rgbRed, clr.rgbGreen, clr.rgbBlue ) );
+		if ( i<16 )
+			arrPalette[i] = RGB565RGB( clr.rgbRed, clr.rgbGreen, clr.rgbBlue );
 		// push rgb565()
 	}
-	for (; bPalette && i<16; i++)
-		pushword(fo, 0);
 
 	int w = bmih.biWidth;
 	int h = bmih.biHeight;
@@ -194,37 +287,67 @@ int _tmain(int argc, _TCHAR* argv[])
 		{
 			int j=nIndex+1;
 			for (; j<nTotal && pbmp[j] == nCurrent; j++);
-			int nLen = j-nIndex;
+			arrTokens[nTokens].nIndex = nIndex;
+			arrTokens[nTokens++].nLen = j-nIndex;
 			nIndex = j;
-
-			printf("clr(%x, %d) ", nCurrent, nLen);
-			pushvlc4(fo, nLen-1);
-			pushfix4(fo, nCurrent&0x0f);
 			bSame = false;
 		} else
 		{	// unique
 			int j = nIndex+1;
 			for (; j<nTotal-1 && pbmp[j] != pbmp[j+1] && (j-nIndex)<=15; j++);
+			arrTokens[nTokens].nIndex = nIndex;
+			arrTokens[nTokens++].nLen = -(j-nIndex);
+			nIndex = j;
+			bSame = true;
+		}
+	} while (nIndex < nTotal);
+
+	// the span decoder is chosen when it draws the bitmap cheaper, the
+	// encoding is the same
+	#define TRANSPARENT(c) (arrPalette[c] == RGB565RGB(0xff, 0x00, 0xff))
+	simw = w;
+	simx = simy = simpending = simtransfers = simopaque = 0;
+	for (i=0; i<nTokens; i++)
+	{
+		if ( arrTokens[i].nLen > 0 )
+			simrun( TRANSPARENT(pbmp[arrTokens[i].nIndex]), arrTokens[i].nLen );
+		else
+			for (int j=0; j<-arrTokens[i].nLen; j++)
+				simpixel( TRANSPARENT(pbmp[arrTokens[i].nIndex+j]) );
+	}
+	bool bSpans = bPalette && simtransfers*TRANSFERCOST + simopaque < simopaque*PIXELCOST;
+	printf("\npixels %d, transfers %d: %s decoder\n", simopaque, simtransfers, bSpans ? "span" : "pixel");
+
+	pushbyte(fo, 'G');
+	pushbyte(fo, bPalette ? (bSpans ? 'S' : 'B') : 'b' );
+	pushvlc8(fo, bmih.biWidth);
+	pushvlc8(fo, bmih.biHeight);
+	for (i=0; bPalette && i<16; i++)
+		pushword(fo, arrPalette[i]);
 
-			int nLen = j-nIndex;
+	for (i=0; i<nTokens; i++)
+	{
+		int nLen = arrTokens[i].nLen;
+		nIndex = arrTokens[i].nIndex;
+		if ( nLen > 0 )
+		{
+			printf("clr(%x, %d) ", pbmp[nIndex], nLen);
+			pushvlc4(fo, nLen-1);
+			pushfix4(fo, pbmp[nIndex]&0x0f);
+		} else
+		{
+			nLen = -nLen;
 			printf("seq(%d: ", nLen);
 
 			pushfix4(fo, nLen-1);
-			for (int i=nIndex; i<j; i++)
+			for (int j=nIndex; j<nIndex+nLen; j++)
 			{
-				printf("%d, ", pbmp[i]);
-				pushfix4(fo, (pbmp[i])&0x0f);
+				printf("%d, ", pbmp[j]);
+				pushfix4(fo, (pbmp[j])&0x0f);
 			}
 			printf(") ");
-
-			nIndex = j;
-
-			bSame = true;
 		}
-		// push VLC (nLen)
-		// push nCurrent
-
-	} while (nIndex < nTotal);
+	}
 
 	pushclose(fo);
 
@@ -235,4 +358,3 @@ int _tmain(int argc, _TCHAR* argv[])
 	fclose(fo);
 	return 0;
 }
-
@@ -1,14 +1,64 @@
 #ifndef __BITMAP_H__
 #define __BITMAP_H__
 
+// Bitmap in the nibble run length format of Resources/ImageConv/bmconv. The
+// rows go alternately left to right and right to left, runs of the same
+// colour alternate with sequences of up to 16 unique pixels. RGB565(ff00ff)
+// in the palette is transparent. The converter marks the bitmaps which are
+// drawn faster in spans with 'S' instead of 'B', the others are drawn pixel
+// by pixel
 class CBitmap {
+public:
+	enum {
+		Transparent = RGB565(ff00ff),
+		// shorter runs are copied into the row buffer, longer are filled by Bar
+		SpanMin = 16,
+		// decoded images kept for Blit(x, y, true), 6 kB in total. The
+		// application RAM of ARM has no room for them, bCache is ignored there
+#ifdef _ARM
+		CachePixels = 0,
+		CacheEntries = 0
+#else
+		CachePixels = 3072,
+		CacheEntries = 4
+#endif
+	};
+
+private:
+#ifndef _ARM
+	struct TCached
+	{
+		const ui8* pData;
+		ui16 arrPalette[16];
+		ui16 nOffset;
+		ui16 nPixels;	// 0 for free entry
+		bool bTransparent;
+	};
+
+	struct TCache
+	{
+		ui16 arrPixels[CachePixels];
+		TCached arrEntries[CacheEntries];
+		int nHead;
+		int nNext;
+	};
+#endif
+
 	int naccum;
 	const ui8* m_p;
 	int base_x;
 	int base_y;
 	int x;
 	int y;
-	
+	ui16* m_pRow;
+	// pending pixels of the row buffer
+	int m_nFrom;
+	int m_nTo;
+	// decoding into the cache instead of the LCD, columns from bottom to top
+	ui16* m_pImage;
+	bool m_bTransparent;
+	bool m_bSpans;
+
 public:
 	int m_width;
 	int m_height;
@@ -18,6 +68,9 @@ public:
 	void Load( const ui8* pData )
 	{
 		naccum = -1;
+		m_width = 0;
+		m_height = 0;
+		m_bSpans = false;
 		if ( pData[0] != 'G' /*|| pData[1] != 'B'*/ )
 			return;
 
@@ -26,8 +79,9 @@ public:
 		m_height = getvlc8();
 		if ( pData[1] == 'b' )
 			return;
-		if ( pData[1] != 'B' )
+		if ( pData[1] != 'B' && pData[1] != 'S' )
 			return;
+		m_bSpans = pData[1] == 'S';
 		for (int i=0; i<16; i++)
 		{
 			int nHigh = *m_p++;
@@ -36,11 +90,35 @@ public:
 		}
 	}
 
-	void Blit( int _x, int _y )
+	// bCache keeps the decoded image for the next Blit of the same bitmap with
+	// the same palette, for small bitmaps drawn often
+	void Blit( int _x, int _y, bool bCache = false )
 	{
-		naccum = -1;
 		base_x = _x;
 		base_y = _y;
+
+#ifndef _ARM
+		if ( bCache && m_width*m_height <= CachePixels )
+		{
+			const TCached& cached = _GetCached();
+			_BlitImage( _GetCache().arrPixels + cached.nOffset, cached.bTransparent );
+			return;
+		}
+#endif
+
+		if ( !m_bSpans )
+		{
+			_DecodePixels();
+			return;
+		}
+		m_pImage = NULL;
+		_Decode();
+	}
+
+private:
+	void _DecodePixels()
+	{
+		naccum = -1;
 		x = 0;
 		y = 0;
 
@@ -56,7 +134,70 @@ public:
 				nCount = getvlc4()+1;
 				int nColor = getfix4();
 				for (int i=0; i<nCount; i++)
-					Pixel( m_arrPalette[nColor] );
+					PutPixel( m_arrPalette[nColor] );
+				bSame = false;
+			} else
+			{	// unique
+				nCount = getfix4()+1;
+				for (int i=0; i<nCount; i++)
+				{
+					int nColor = getfix4();
+					PutPixel( m_arrPalette[nColor] );
+				}
+				bSame = true;
+			}
+			nPixels -= nCount;
+			_ASSERT( nPixels >= 0 );
+		}
+		m_p = pPixels;
+	}
+
+	void PutPixel(ui16 clr)
+	{
+		if ( clr != Transparent )
+			BIOS::LCD::PutPixel(base_x+x, base_y+y, clr);
+		if ( y & 1 )
+		{
+			if ( --x < 0 )
+			{
+				x++;
+				y++;
+			}
+		} else
+		{
+			if ( ++x >= m_width )
+			{
+				x--;
+				y++;
+			}
+		}
+	}
+
+	void _Decode()
+	{
+		naccum = -1;
+		x = 0;
+		y = 0;
+
+		// literal pixels are collected in the row buffer, a contiguous piece of
+		// a row goes out in one transfer
+		ui16 arrRow[BIOS::LCD::LcdWidth];
+		_ASSERT( m_width <= (int)COUNT(arrRow) );
+		m_pRow = arrRow;
+		m_nFrom = m_nTo = 0;
+
+		const ui8* pPixels = m_p;
+
+		int nPixels = m_width*m_height;
+		bool bSame = true;
+		while ( nPixels > 0 )
+		{
+			int nCount;
+			if ( bSame )
+			{
+				nCount = getvlc4()+1;
+				int nColor = getfix4();
+				Run( m_arrPalette[nColor], nCount );
 				bSame = false;
 			} else
 			{	// unique
@@ -74,16 +215,62 @@ public:
 		m_p = pPixels;
 	}
 
-private:
+	void Run(ui16 clr, int nCount)
+	{
+		while ( nCount > 0 )
+		{
+			// whole rows are a single rectangle
+			int nRowStart = ( y & 1 ) ? m_width-1 : 0;
+			if ( x == nRowStart && nCount >= m_width )
+			{
+				int nRows = nCount / m_width;
+				Span( 0, y, m_width, nRows, clr );
+				y += nRows;
+				x = ( y & 1 ) ? m_width-1 : 0;
+				nCount -= nRows * m_width;
+				continue;
+			}
+
+			int nLeft = ( y & 1 ) ? x+1 : m_width-x;
+			int nSpan = min( nCount, nLeft );
+			if ( nSpan < SpanMin && clr != Transparent )
+			{
+				for (int i=0; i<nSpan; i++)
+					Pixel( clr );
+			} else
+			{
+				Span( ( y & 1 ) ? x-nSpan+1 : x, y, nSpan, 1, clr );
+				if ( nSpan == nLeft )
+				{
+					// the next row starts where this one ended
+					x = ( y & 1 ) ? 0 : m_width-1;
+					y++;
+				} else
+					x += ( y & 1 ) ? -nSpan : nSpan;
+			}
+			nCount -= nSpan;
+		}
+	}
+
 	void Pixel(ui16 clr)
 	{
-		if ( clr != RGB565(ff00ff) )
-			BIOS::LCD::PutPixel(base_x+x, base_y+y, clr);
+		if ( clr == Transparent && !m_pImage )
+			FlushRow();
+		else
+		{
+			if ( m_nFrom == m_nTo )
+				m_nFrom = m_nTo = x;
+			m_pRow[x] = clr;
+			m_nFrom = min( m_nFrom, x );
+			m_nTo = max( m_nTo, x+1 );
+		}
+
 		if ( y & 1 )
 		{
 			if ( --x < 0 )
 			{
 				x++;
+				FlushRow();
 				y++;
 			}
 		} else
@@ -91,16 +278,126 @@ private:
 			if ( ++x >= m_width )
 			{
 				x--;
+				FlushRow();
 				y++;
 			}
 		}
 	}
 
+	void Span(int _x, int _y, int nWidth, int nHeight, ui16 clr)
+	{
+		FlushRow();
+		if ( m_pImage )
+		{
+			for (int i=_x; i<_x+nWidth; i++)
+			{
+				ui16* pColumn = m_pImage + i*m_height + (m_height-_y-nHeight);
+				for (int j=0; j<nHeight; j++)
+					pColumn[j] = clr;
+			}
+			if ( clr == Transparent )
+				m_bTransparent = true;
+			return;
+		}
+		if ( clr != Transparent )
+			BIOS::LCD::Bar( base_x+_x, base_y+_y, base_x+_x+nWidth, base_y+_y+nHeight, clr );
+	}
+
+	void FlushRow()
+	{
+		if ( m_nFrom == m_nTo )
+			return;
+		if ( m_pImage )
+		{
+			for (int i=m_nFrom; i<m_nTo; i++)
+			{
+				m_pImage[i*m_height + m_height-1-y] = m_pRow[i];
+				if ( m_pRow[i] == Transparent )
+					m_bTransparent = true;
+			}
+		} else
+			BIOS::LCD::BlitRect( CRect(base_x+m_nFrom, base_y+y, base_x+m_nTo, base_y+y+1), m_pRow+m_nFrom, m_nTo-m_nFrom );
+		m_nFrom = m_nTo = 0;
+	}
+
+	// the image is stored in the native order of the LCD, without transparent
+	// pixels it goes out as one stream
+	void _BlitImage(const ui16* pImage, bool bTransparent)
+	{
+		if ( !bTransparent )
+		{
+			BIOS::LCD::BlitColumns( CRect(base_x, base_y, base_x+m_width, base_y+m_height), pImage, m_height );
+			return;
+		}
+		for (int i=0; i<m_width; i++)
+		{
+			const ui16* pColumn = pImage + i*m_height;
+			for (int j=0; j<m_height; )
+			{
+				if ( pColumn[j] == Transparent )
+				{
+					j++;
+					continue;
+				}
+				int nBegin = j;
+				while ( j < m_height && pColumn[j] != Transparent )
+					j++;
+				BIOS::LCD::BlitColumns( CRect(base_x+i, base_y+m_height-j, base_x+i+1, base_y+m_height-nBegin),
+					pColumn+nBegin, j-nBegin );
+			}
+		}
+	}
+
+#ifndef _ARM
+	const TCached& _GetCached()
+	{
+		TCache& cache = _GetCache();
+		for (int i=0; i<CacheEntries; i++)
+		{
+			TCached& cached = cache.arrEntries[i];
+			if ( cached.nPixels && cached.pData == m_p && memcmp( cached.arrPalette, m_arrPalette, sizeof(m_arrPalette) ) == 0 )
+				return cached;
+		}
+
+		// ring of images, the oldest ones overlapped by the new image are lost
+		int nPixels = m_width*m_height;
+		if ( cache.nHead + nPixels > CachePixels )
+			cache.nHead = 0;
+		for (int i=0; i<CacheEntries; i++)
+		{
+			TCached& cached = cache.arrEntries[i];
+			if ( cached.nPixels && cached.nOffset < cache.nHead + nPixels && cached.nOffset + cached.nPixels > cache.nHead )
+				cached.nPixels = 0;
+		}
+
+		TCached& cached = cache.arrEntries[cache.nNext];
+		cache.nNext = ( cache.nNext + 1 ) % CacheEntries;
+		cached.pData = m_p;
+		memcpy( cached.arrPalette, m_arrPalette, sizeof(m_arrPalette) );
+		cached.nOffset = cache.nHead;
+		cached.nPixels = nPixels;
+		cache.nHead += nPixels;
+
+		m_pImage = cache.arrPixels + cached.nOffset;
+		m_bTransparent = false;
+		_Decode();
+		m_pImage = NULL;
+		cached.bTransparent = m_bTransparent;
+		return cached;
+	}
+
+	static TCache& _GetCache()
+	{
+		static TCache cache;
+		return cache;
+	}
+#endif
+
 	int getvlc8()
 	{
 		ui8 b;
 		int nBit = 0, i = 0;
-		do 
+		do
 		{
 			b = *m_p++;
 			i |= (b & 127) << nBit;
@@ -125,7 +422,7 @@ private:
 	{
 		ui8 b;
 		int nBit = 0, i = 0;
-		do 
+		do
 		{
 			b = getfix4();
 			i |= (b & 7) << nBit;
@@ -135,4 +432,4 @@ private:
 	}
 };
 
-#endif
\ No newline at end of file
+#endif
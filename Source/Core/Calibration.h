@@ -154,6 +154,12 @@
 			return -fast.Zero + ( (fast.Q + nAdc * fast.K) >> 11 );
 		}
 
+		// same as Correct for a sample with 8 bit fraction
+		int CorrectFine( FastCalc& fast, int nFine )
+		{
+			return -fast.Zero * 256 + ( fast.Q >> 3 ) + ( (nFine * fast.K) >> 11 );
+		}
+
 		float Voltage(FastCalc& fast, float fAdc)
 		{	
 			//return (fast.Q + fAdc * fast.K)/65536.0f; 
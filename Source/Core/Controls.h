@@ -141,7 +141,7 @@ public:
 		} else {
 			CDesign::MenuItemDisabled( m_rcClient, m_clr );
 			if ( m_pszId )
-				BIOS::LCD::Print( m_rcClient.left+12, m_rcClient.top, RGB565(000000), RGBTRANS, m_pszId );
+				BIOS::LCD::Print( m_rcClient.left+12, m_rcClient.top, RGB565(000000), CDesign::MenuItemTextBack(false), m_pszId );
 		}
 		m_rcClient.left -= MarginLeft;
 	}
@@ -230,7 +230,7 @@ public:
 				CBitmap bmp;
 				bmp.Load( (const ui8*)m_pImage );
 				RemapPalette( bmp.m_arrPalette, RGB565(8080e0), RGB565(ffffff) );
-				bmp.Blit( m_rcClient.right - bmp.m_width, m_rcClient.bottom - bmp.m_height );
+				bmp.Blit( m_rcClient.right - bmp.m_width, m_rcClient.bottom - bmp.m_height, true );
 			}
 			BIOS::LCD::Print( m_rcClient.left+12, m_rcClient.top, RGB565(000000), RGBTRANS, m_pszId );
 		} else {
@@ -240,7 +240,7 @@ public:
 				CBitmap bmp;
 				bmp.Load( (const ui8*)m_pImage );
 				RemapPalette( bmp.m_arrPalette, RGB565(e0e0e0), RGB565(b0b0b0) );
-				bmp.Blit( m_rcClient.right - bmp.m_width, m_rcClient.bottom - bmp.m_height );
+				bmp.Blit( m_rcClient.right - bmp.m_width, m_rcClient.bottom - bmp.m_height, true );
 			}
 			BIOS::LCD::Print( m_rcClient.left+12, m_rcClient.top, RGB565(000000), RGBTRANS, m_pszId );
 		}
@@ -561,13 +561,13 @@ public:
 		{
 			(*m_pProvider)--;
 			Invalidate();
-			SendMessage(m_pParent, ToWord('i', 'u'), NULL);
+			SendMessage(m_pParent, ToWord('i', 'u'), 0);
 		}
 		if ( nKey & BIOS::KEY::KeyRight && *m_pProvider + 1 == CValueProvider::Yes )
 		{
 			(*m_pProvider)++;
 			Invalidate();
-			SendMessage(m_pParent, ToWord('i', 'u'), NULL);
+			SendMessage(m_pParent, ToWord('i', 'u'), 0);
 		}
 		CWnd::OnKey( nKey );
 	}
@@ -700,7 +700,7 @@ public:
 		_ASSERT( m_pNumber );
 		ui16 clr = bFocus ? RGB565(ffffff) : RGB565(000000);
 		int nDigit = ((*m_pNumber) / m_nStep) % 10;
-		char strDigit[2] = { '0'+nDigit, 0 };
+		char strDigit[2] = { (char)('0'+nDigit), 0 };
 
 		BIOS::LCD::Print( rcRect.left, rcRect.top, clr, RGBTRANS, strDigit);
 	}	
@@ -23,6 +23,14 @@ public:
 		BIOS::LCD::RoundRect( rcRect.left+8-2, rcRect.top+1, rcRect.right-1, rcRect.bottom-1, RGB565(ffffff));
 	}
 
+	// background of the text right of the indent, where it is flat the text
+	// is printed opaque and comes from the text cache. The focused item has
+	// a border line at the top
+	static ui16 MenuItemTextBack(bool bFocus)
+	{
+		return bFocus ? RGBTRANS : RGB565(b0b0b0);
+	}
+
 	static void MenuItemClearDisabled(const CRect& rcRect)
 	{
 		BIOS::LCD::Bar(rcRect.left, rcRect.top, rcRect.left + MenuItemIndent + 4, rcRect.bottom, RGB565(000000));
@@ -109,16 +117,16 @@ public:
 
 	static void ListItemEnabled(const CRect& rcRect)
 	{
-		BIOS::LCD::BufferBegin( rcRect, BIOS::LCD::BfXY );
+		// every column is the same gradient, it is streamed repeatedly
+		ui16 column[BIOS::LCD::LcdHeight];
+		int nHeight = min(rcRect.Height(), (int)COUNT(column));
 		ui8 c = 0xd0;
-		for (int y=0; y<rcRect.Height(); y++)
+		for (int y=0; y<nHeight; y++)
 		{
-			ui16 clr = RGB565RGB(c, c, c);
-			for (int x=rcRect.Width(); x--; )
-				BIOS::LCD::BufferPush(clr);
+			column[nHeight-1-y] = RGB565RGB(c, c, c);
 			c -= 0x0d;
 		}
-		BIOS::LCD::BufferEnd();
+		BIOS::LCD::BlitColumns( CRect(rcRect.left, rcRect.top, rcRect.right, rcRect.top+nHeight), column, 0 );
 	}
 
 	static void Shadow(const CRect& rcRect, ui32 clr)
@@ -143,6 +151,11 @@ public:
 		BIOS::LCD::Bar( rcRect.left+8-2, rcRect.top, rcRect.right, rcRect.bottom, RGB565(ffffff) );
 	}
 
+	static ui16 MenuItemTextBack(bool bFocus)
+	{
+		return bFocus ? RGB565(ffffff) : RGB565(b0b0b0);
+	}
+
 	static void GradientTop(const CRect& rcRect)
 	{
 		BIOS::LCD::Bar( rcRect, RGB565(0000B0) );
@@ -0,0 +1,35 @@
+#include "FramePacer.h"
+#include "Perf.h"
+
+/*static*/ ui32 CFramePacer::m_lLastFrame = 0;
+/*static*/ ui32 CFramePacer::m_nCaptured = 0;
+/*static*/ bool CFramePacer::m_bPending = false;
+
+/*static*/ bool CFramePacer::Acquired(ui32 nMicros)
+{
+	// the waveform waiting for its frame is replaced by the new one
+	if ( m_bPending )
+		CPerf::CountDrop();
+	m_nCaptured = nMicros;
+	m_bPending = true;
+	return IsDue();
+}
+
+/*static*/ bool CFramePacer::IsDue()
+{
+	return m_bPending && BIOS::SYS::GetTick() - m_lLastFrame >= Interval;
+}
+
+/*static*/ void CFramePacer::Painted()
+{
+	if ( m_bPending )
+		CPerf::Add( CPerf::Latency, BIOS::SYS::GetMicros() - m_nCaptured );
+	m_bPending = false;
+	m_lLastFrame = BIOS::SYS::GetTick();
+}
+
+/*static*/ void CFramePacer::Reset()
+{
+	m_lLastFrame = 0;
+	m_bPending = false;
+}
@@ -0,0 +1,36 @@
+#ifndef __FRAMEPACER_H__
+#define __FRAMEPACER_H__
+
+#include <Source/HwLayer/Types.h>
+
+// Paces the repaints of the waveform windows. Every acquisition goes through
+// the trigger, the averaging and the analysis listeners ('da' broadcast), the
+// 'dg' broadcast repainting the graph and the measurements is sent at most
+// once per Interval. A waveform arriving earlier is dropped from the screen,
+// the newest waiting one is painted as soon as its frame is due. Dropped
+// frames and the latency from the capture to its paint are kept by CPerf
+class CFramePacer
+{
+public:
+	enum {
+		// milliseconds between two paints, 25 frames per second
+		Interval = 40
+	};
+
+private:
+	static ui32 m_lLastFrame;
+	static ui32 m_nCaptured;
+	static bool m_bPending;
+
+public:
+	// a waveform captured at nMicros was processed, returns true when it has
+	// to be painted now
+	static bool Acquired(ui32 nMicros);
+	// a dropped waveform is waiting and its frame is due
+	static bool IsDue();
+	// the waveform was painted, also for the paints outside of the pacing
+	static void Painted();
+	static void Reset();
+};
+
+#endif
@@ -0,0 +1,42 @@
+#include "Perf.h"
+
+/*static*/ const char* const CPerf::m_ppszNames[CPerf::StageMax] =
+	{"Copy", "Resample", "Store", "Trigger", "Average", "Phosphor", "Broadcast", "Paint", "Meas", "Latency"};
+/*static*/ CPerf::TStage CPerf::m_arrCurrent[CPerf::StageMax];
+/*static*/ CPerf::TStage CPerf::m_arrLast[CPerf::StageMax];
+/*static*/ ui32 CPerf::m_arrBegin[CPerf::StageMax];
+/*static*/ int CPerf::m_nPaints = 0;
+/*static*/ int CPerf::m_nPaintsPerSecond = 0;
+/*static*/ int CPerf::m_nDrops = 0;
+/*static*/ int CPerf::m_nDropsPerSecond = 0;
+
+/*static*/ void CPerf::Add(EStage eStage, ui32 nDuration)
+{
+	TStage& stage = m_arrCurrent[eStage];
+	if ( stage.nCount == 0 || nDuration < stage.nMin )
+		stage.nMin = nDuration;
+	if ( stage.nCount == 0 || nDuration > stage.nMax )
+		stage.nMax = nDuration;
+	stage.nSum += nDuration;
+	stage.nCount++;
+}
+
+/*static*/ void CPerf::Second()
+{
+	memcpy( m_arrLast, m_arrCurrent, sizeof(m_arrLast) );
+	memset( m_arrCurrent, 0, sizeof(m_arrCurrent) );
+	m_nPaintsPerSecond = m_nPaints;
+	m_nPaints = 0;
+	m_nDropsPerSecond = m_nDrops;
+	m_nDrops = 0;
+}
+
+/*static*/ void CPerf::Reset()
+{
+	memset( m_arrCurrent, 0, sizeof(m_arrCurrent) );
+	memset( m_arrLast, 0, sizeof(m_arrLast) );
+	m_nPaints = 0;
+	m_nPaintsPerSecond = 0;
+	m_nDrops = 0;
+	m_nDropsPerSecond = 0;
+}
@@ -0,0 +1,88 @@
+#ifndef __PERF_H__
+#define __PERF_H__
+
+#include <Source/HwLayer/Types.h>
+#include <Source/HwLayer/Bios.h>
+
+// Lightweight profiler of the acquisition and render pipeline. Every stage
+// collects min/avg/max of its duration in microseconds, once per second the
+// collected values are published (see SDK function Perf)
+class CPerf
+{
+public:
+	enum EStage {
+		Copy,
+		Resample,
+		Store,
+		Trigger,
+		Average,
+		Phosphor,
+		Broadcast,
+		Paint,
+		Meas,
+		// capture to paint of a paced frame, see CFramePacer
+		Latency,
+		StageMax
+	};
+
+	struct TStage
+	{
+		ui32 nMin;
+		ui32 nMax;
+		ui32 nSum;
+		ui32 nCount;
+	};
+
+private:
+	static const char* const m_ppszNames[StageMax];
+	static TStage m_arrCurrent[StageMax];
+	static TStage m_arrLast[StageMax];
+	static ui32 m_arrBegin[StageMax];
+	static int m_nPaints;
+	static int m_nPaintsPerSecond;
+	static int m_nDrops;
+	static int m_nDropsPerSecond;
+
+public:
+	static void Begin(EStage eStage)
+	{
+		m_arrBegin[eStage] = BIOS::SYS::GetMicros();
+	}
+	static void End(EStage eStage)
+	{
+		Add( eStage, BIOS::SYS::GetMicros() - m_arrBegin[eStage] );
+	}
+	// duration measured elsewhere
+	static void Add(EStage eStage, ui32 nDuration);
+	static void CountPaint()
+	{
+		m_nPaints++;
+	}
+	// processed waveform that was never painted
+	static void CountDrop()
+	{
+		m_nDrops++;
+	}
+	// publish values collected in the last second and start again
+	static void Second();
+	static void Reset();
+
+	static const TStage& Get(EStage eStage)
+	{
+		return m_arrLast[eStage];
+	}
+	static const char* GetName(EStage eStage)
+	{
+		return m_ppszNames[eStage];
+	}
+	static int GetPaintsPerSecond()
+	{
+		return m_nPaintsPerSecond;
+	}
+	static int GetDropsPerSecond()
+	{
+		return m_nDropsPerSecond;
+	}
+};
+
+#endif
@@ -121,6 +121,7 @@ public:
 			{ "SPEC.Display", CEvalToken::PrecedenceVar, _SpecDisplay },
 			{ "RUN.Backlight", CEvalToken::PrecedenceVar, _RunBacklight },
 			{ "RUN.Volume", CEvalToken::PrecedenceVar, _RunVolume },
+			{ "PERF.Waveforms", CEvalToken::PrecedenceVar, _PerfWaveforms },
 
 			// functions
 			{ "About", CEvalToken::PrecedenceFunc, _About },
@@ -132,6 +133,10 @@ public:
 			{ "WND.GetFocus", CEvalToken::PrecedenceFunc, _WndGetFocus },
 			{ "WND.GetInfo", CEvalToken::PrecedenceFunc, _WndGetInfo },
 			{ "ADC.Transfer", CEvalToken::PrecedenceFunc, _AdcTransfer },	// output only through uart
+			{ "Perf", CEvalToken::PrecedenceFunc, _Perf },					// output only through uart
+			{ "PERF.Paints", CEvalToken::PrecedenceFunc, _PerfPaints },
+			{ "PERF.Drops", CEvalToken::PrecedenceFunc, _PerfDrops },
+			{ "PERF.Reset", CEvalToken::PrecedenceFunc, _PerfReset },
 
 			// constants
 			{ "WND::WmPaint", CEvalToken::PrecedenceConst, _WndWmPaint },
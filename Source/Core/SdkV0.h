@@ -27,7 +27,7 @@
 				//if ( m_nPos == 0 )
 				//	BIOS::ADC::Restart();
 				if ( (m_nPos & 3) == 0 )
-					m_LastSample.m_ui32 = BIOS::ADC::GetAt(m_nPos >> 2);
+					m_LastSample.m_ui32 = CCaptureStore::GetAt(m_nPos >> 2);
 
 				return m_LastSample.m_arr8[ m_nPos++ & 3 ];
 			};
@@ -59,7 +59,7 @@
 
 			virtual CHAR Get()
 			{
-				const BIOS::ADC::TSample& sample = BIOS::ADC::GetAt( 10 + m_nPos/2 );
+				ui32 sample = CCaptureStore::GetAt( 10 + m_nPos/2 );
 				CHAR chOut = (m_nPos & 1) ? (CHAR) (sample >> 8) : (CHAR)sample;
 				m_nPos++;
 				return chOut;
@@ -102,7 +102,7 @@ DECLARE_FUNCTION( _WndMessage )
 		_ASSERT( arrOperands[-2].Is( pTokDelim ) );
 		_ASSERT( arrOperands[-1].Is( CEvalOperand::eoInteger ) );
 
-		pTarget = (CWnd*)arrOperands[-5].GetInteger();
+		pTarget = (CWnd*)(ui32)arrOperands[-5].GetInteger();
 		nMessage = arrOperands[-3].GetInteger();
 		nData = arrOperands[-1].GetInteger();
 		arrOperands.Resize(-5);
@@ -231,7 +231,7 @@ DECLARE_FUNCTION( _AdcTransfer )
 
 	for (int i = nBegin; i < nEnd; i++ )
 	{
-		BIOS::ADC::TSample Sample = BIOS::ADC::GetAt( i );
+		ui32 Sample = CCaptureStore::GetAt( i );
 		ui8* buf = (ui8*)&Sample;
 
 		BIOS::SERIAL::Putch( buf[0] );
@@ -243,6 +243,46 @@ DECLARE_FUNCTION( _AdcTransfer )
 	return CEvalOperand(CEvalOperand::eoNone);
 }
 
+DECLARE_FUNCTION( _Perf )
+{
+	// durations in microseconds collected during the last second, the broadcast
+	// stage includes all listeners, so it contains paint and meas too
+	char msg[64];
+	BIOS::SERIAL::Send( "Stage          min     avg     max   count\n" );
+	for ( int i = 0; i < CPerf::StageMax; i++ )
+	{
+		const CPerf::TStage& stage = CPerf::Get( (CPerf::EStage)i );
+		int nAvg = stage.nCount ? stage.nSum / stage.nCount : 0;
+		BIOS::DBG::sprintf( msg, "%-10s %7d %7d %7d %7d\n", CPerf::GetName( (CPerf::EStage)i ),
+			stage.nMin, nAvg, stage.nMax, stage.nCount );
+		BIOS::SERIAL::Send( msg );
+	}
+	BIOS::DBG::sprintf( msg, "Waveforms/s %d, paints/s %d, dropped/s %d\n", 
+		Settings.Runtime.m_nWaveformsPerSecond, CPerf::GetPaintsPerSecond(), CPerf::GetDropsPerSecond() );
+	BIOS::SERIAL::Send( msg );
+	ui32 nTextHits, nTextMisses;
+	BIOS::LCD::GetTextStats( nTextHits, nTextMisses );
+	BIOS::DBG::sprintf( msg, "Text cache hits %d, misses %d\n", nTextHits, nTextMisses );
+	BIOS::SERIAL::Send( msg );
+	return CEvalOperand(CEvalOperand::eoNone);
+}
+
+DECLARE_FUNCTION( _PerfPaints )
+{
+	return CEvalOperand( CPerf::GetPaintsPerSecond() );
+}
+
+DECLARE_FUNCTION( _PerfDrops )
+{
+	return CEvalOperand( CPerf::GetDropsPerSecond() );
+}
+
+DECLARE_FUNCTION( _PerfReset )
+{
+	CPerf::Reset();
+	return CEvalOperand(CEvalOperand::eoNone);
+}
+
 DECLARE_FUNCTION( _AdcUpdate )
 {
 	CCoreOscilloscope::ConfigureAdc();
@@ -382,6 +422,7 @@ DECLARE_DYNAVAR( NATIVEENUM, _SpecDisplay, Settings.Spec.Display )
 
 DECLARE_DYNAVAR( NATIVEENUM, _RunBacklight, Settings.Runtime.m_nBacklight )
 DECLARE_DYNAVAR( NATIVEENUM, _RunVolume, Settings.Runtime.m_nVolume )
+DECLARE_DYNAVAR( int, _PerfWaveforms, Settings.Runtime.m_nWaveformsPerSecond )
 
 DECLARE_CONST( _WndWmPaint, CWnd::WmPaint )
 DECLARE_CONST( _WndWmKey, CWnd::WmKey )
@@ -516,7 +557,7 @@ DECLARE_FUNCTION( _MemRead )
 
 	int nAddress = arrOperands[-1].GetInteger();
 	arrOperands.Resize(-1);
-	ui32* pData = (ui32*)nAddress;
+	ui32* pData = (ui32*)(ui32)nAddress;
 	ui32 nData = *pData;
 
 	return (UINT)nData;
@@ -537,7 +578,7 @@ DECLARE_FUNCTION( _MemWrite )
 
 	arrOperands.Resize(-3);
 
-	ui32* pData = (ui32*)nAddress;
+	ui32* pData = (ui32*)(ui32)nAddress;
 	*pData = nValue;
 
 	return CEvalOperand(CEvalOperand::eoNone);
@@ -1,6 +1,7 @@
 #include "Settings.h"    
 #include <Source/HwLayer/Bios.h>
 #include <Source/Gui/Toolbar.h>
+#include <Source/Gui/Oscilloscope/Core/CoreSequence.h>
 #include <string.h>
 
 CSettings* CSettings::m_pInstance = NULL;
@@ -43,6 +44,8 @@ CSettings* CSettings::m_pInstance = NULL;
 		1024, 1024, 1024, 1024, 1024, 1024,
 		1024};
 		
+/*static*/ const char* const CSettings::TimeBase::ppszTextAcquire[] =
+		{"Normal", "Peak", "High res"};
 /*static*/ const float CSettings::TimeBase::pfValueResolution[] =
 		{/*100e-9f,*/ 200e-9f, 500e-9f,
 		/* 97.65e-9f, 417e-9f, */
@@ -56,11 +59,13 @@ CSettings* CSettings::m_pInstance = NULL;
 /*static*/ const char* const CSettings::Generator::ppszTextWave[] =
 		{"DC", "Sin HQ", "Sin LQ", "Triangle", "Sawtooth", "Square", "Cardiac", "Volatile"};
 /*static*/ const char* const CSettings::Trigger::ppszTextSync[] =
-		{"Auto", "Norm", "Single", "Scan", "None"};
+		{"Auto", "Norm", "Single", "Scan", "None", "Seq", "Roll", "ETS"};
 /*static*/ const char* const CSettings::Trigger::ppszTextSource[] =
 		{"CH1", "CH2", "CH3", "CH4", "Math"};
 /*static*/ const char* const CSettings::Trigger::ppszTextType[] =
 		{"Falling", "Rising", "<Vt", ">Vt", "<TL", ">TL", "<TH", ">TH" };
+/*static*/ const char* const CSettings::Trigger::ppszTextSoft[] =
+		{"Off", "Edge", "Pulse", "Runt", "Window", "Slew"};
 
 /*static*/ const char* const CSettings::Marker::ppszTextMode[] =
 		{"Off", "On", "Auto"};
@@ -96,9 +101,15 @@ CSettings* CSettings::m_pInstance = NULL;
 /*static*/ const char* const CSettings::Display::ppszTextDraw[]
 		 = {"Dots", "Lines", "Fill"};
 /*static*/ const char* const CSettings::Display::ppszTextAverage[]
-		 = {"Off", "CH1", "CH2"};
+		 = {"Off", "Linear", "Exp"};
+/*static*/ const char* const CSettings::Display::ppszTextAverageCount[]
+		 = {"2", "4", "8", "16", "32", "64", "128", "256"};
+/*static*/ const char* const CSettings::Display::ppszTextAccumulator[]
+		 = {"16 bit", "32 bit"};
 /*static*/ const char* const CSettings::Display::ppszTextPersist[]
-		 = {"No", "Yes"};
+		 = {"No", "Yes", "Phosphor"};
+/*static*/ const char* const CSettings::Display::ppszTextHalfLife[]
+		 = {"1", "2", "4", "8", "16", "32", "64"};
 /*static*/ const char* const CSettings::Display::ppszTextGrid[]
 		 = {"None", "Dots", "Lines"};
 /*static*/ const char* const CSettings::Display::ppszTextAxis[]
@@ -163,6 +174,7 @@ void CSettings::Reset()
 	
 	Time.Resolution = TimeBase::_500us;
 	Time.Range = TimeBase::_4;
+	Time.Acquire = TimeBase::_AcqNormal;
 	Time.InvalidFirst = 30; 
 	// first samples are some noise, cut them out, length matching one div
 	Time.Shift = Time.InvalidFirst;
@@ -176,6 +188,10 @@ void CSettings::Reset()
 	Trig.nHoldOff = 0;
 	Trig.nPosition = 150;
 	Trig.nLastChange = 0;
+	Trig.nSegments = CCoreSequence::MaxSegments;
+	Trig.nSegment = 0;
+	Trig.Soft = Trigger::_SoftOff;
+	Trig.nLevel2 = 160;
 
 	Gen.Wave = Generator::_SinHq;
 	//Gen.nPsc = 180-1;
@@ -284,8 +300,11 @@ void CSettings::Reset()
 
 	Disp.Axes = Display::_TY;
 	Disp.Draw = Display::_Lines;
-	Disp.Average = Display::_AvgNo;
+	Disp.Average = Display::_AvgOff;
+	Disp.AverageCount = Display::_Avg16;
+	Disp.Accumulator = Display::_Acc16;
 	Disp.Persist = Display::_PerNo;
+	Disp.HalfLife = Display::_Half8;
 	Disp.Grid = Display::_GridDots;
 	Disp.Axis= Display::_AxisSingle;
 
@@ -313,6 +332,7 @@ void CSettings::Reset()
 
 	Runtime.m_bUartTest = true;
 	Runtime.m_bUartEcho = false;
+	Runtime.m_nWaveformsPerSecond = 0;
 	Runtime.m_bUartSdk = true;
 }
 
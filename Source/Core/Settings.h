@@ -6,7 +6,7 @@
 #include <Source/HwLayer/Bios.h>
 #include "Serialize.h"
 
-#define _VERSION ToDword('D', 'S', 'C', 10)
+#define _VERSION ToDword('D', 'S', 'C', 11)
 
 class CSettings : public CSerialize
 {
@@ -100,6 +100,13 @@ class AnalogChannel : public CSerialize
 		static const float pfValueResolution[];
 		static const int pfValueResolutionCorrection[]; // florian
 
+		// not serialized, peak detect and high resolution sample faster than the
+		// timebase and keep the min/max envelope or the average of every interval
+		static const char* const ppszTextAcquire[];
+		enum {
+			_AcqNormal, _AcqPeak, _AcqHiRes, _AcquireMax = _AcqHiRes }
+			Acquire;
+
 		si16 Shift;
 		int InvalidFirst;
 		
@@ -121,7 +128,8 @@ class AnalogChannel : public CSerialize
 		static const char* const ppszTextSync[];
 		static const char* const ppszTextSource[];
 		static const char* const ppszTextType[];
-		enum ESync { _Auto, _Norm, _Single, _Scan, _None, _SyncMax = _None }
+		static const char* const ppszTextSoft[];
+		enum ESync { _Auto, _Norm, _Single, _Scan, _None, _Seq, _Roll, _Ets, _SyncMax = _Ets }
 			Sync;
 		enum { _EdgeHL, _EdgeLH, _LevelLow, _LevelHigh, _LowerDTLow, _GreaterDTLow, _LowerDTHigh, _GreaterDTHigh, _TypeMax = _GreaterDTHigh }
 			Type;
@@ -134,6 +142,11 @@ class AnalogChannel : public CSerialize
 		si16 nHoldOff;
 		si16 nPosition;
 		ui32 nLastChange;
+		si16 nSegments;	// segmented acquisition, not saved in settings
+		si16 nSegment;
+		enum { _SoftOff, _SoftEdge, _SoftPulse, _SoftRunt, _SoftWindow, _SoftSlew, _SoftMax = _SoftSlew }
+			Soft;	// software trigger, not saved in settings
+		si16 nLevel2;
 
 		virtual CSerialize& operator <<( CStream& stream )
 		{
@@ -295,9 +308,15 @@ class AnalogChannel : public CSerialize
 		static const char* const ppszTextDraw[];
 		// = {"Points", "Lines", "Fill"};
 		static const char* const ppszTextAverage[];
-		// = {"No", "Yes"};
+		// = {"Off", "Linear", "Exp"};
+		static const char* const ppszTextAverageCount[];
+		// = {"2", "4", ... "256"};
+		static const char* const ppszTextAccumulator[];
+		// = {"16 bit", "32 bit"};
 		static const char* const ppszTextPersist[];
-		// = {"No", "Yes"};
+		// = {"No", "Yes", "Phosphor"};
+		static const char* const ppszTextHalfLife[];
+		// = {"1", "2", ... "64"};
 		static const char* const ppszTextGrid[];
 		// = {"None", "Dots", "Lines"};
 		static const char* const ppszTextAxis[];
@@ -307,10 +326,19 @@ class AnalogChannel : public CSerialize
 			Axes;
 		enum { _Points, _Lines, _Fill, _DrawMax = _Fill }
 			Draw;
-		enum { _AvgNo, _AvgCh1, _AvgCh2, _AverageMax = _AvgCh2 }
+		// averaging of successive sweeps, see CCoreAverage
+		enum { _AvgOff, _AvgLinear, _AvgExp, _AverageMax = _AvgExp }
 			Average;
-		enum { _PerNo, _PerYes, _PersistMax = _PerYes }
+		// not serialized, number of sweeps is 2 << AverageCount
+		enum { _Avg2, _Avg4, _Avg8, _Avg16, _Avg32, _Avg64, _Avg128, _Avg256, _AverageCountMax = _Avg256 }
+			AverageCount;
+		enum { _Acc16, _Acc32, _AccumulatorMax = _Acc32 }
+			Accumulator;
+		enum { _PerNo, _PerYes, _PerPhosphor, _PersistMax = _PerPhosphor }
 			Persist;
+		// not serialized, half-life of the phosphor in acquisitions is 1 << HalfLife
+		enum { _Half1, _Half2, _Half4, _Half8, _Half16, _Half32, _Half64, _HalfLifeMax = _Half64 }
+			HalfLife;
 		enum { _GridNone, _GridDots, _GridLines, _GridMax = _GridLines }
 			Grid;
 		enum { _AxisNone, _AxisSingle, _AxisDouble, _AxisMax = _AxisDouble }
@@ -399,6 +427,7 @@ class AnalogChannel : public CSerialize
 
 		int m_bUartTest;
 		int m_bUartEcho;	// not saved in settings
+		int m_nWaveformsPerSecond;	// not saved in settings
 		int m_bUartSdk;
 
 		virtual CSerialize& operator <<( CStream& stream )
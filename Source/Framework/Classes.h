@@ -107,17 +107,147 @@ public:
 		return rcNew;
 	}
 
-	bool IsInside( int x, int y )
+	bool IsInside( int x, int y ) const
 	{
 		if ( x < left || x >= right || y < top || y >= bottom )
 			return false;
 		return true;
 	}
 
+	bool Intersects( const CRect& rc ) const
+	{
+		return left < rc.right && rc.left < right && top < rc.bottom && rc.top < bottom;
+	}
+
 	// RAM optimization int->short
 	short left, top, right, bottom;
 };
 
+// Parts of the screen the LCD drawing has to leave alone. The rectangles are
+// pushed by the modal windows, only the ones from m_nFirst on are hidden, so
+// a modal window is covered just by the modals opened after it
+class DLLAPI CClipRegion
+{
+public:
+	enum {
+		MaxRects = 8,
+		// pieces of a rectangle returned by GetVisible
+		MaxPieces = 16
+	};
+
+private:
+	CRect	m_arrRects[MaxRects];
+	ui8		m_nCount;
+	ui8		m_nFirst;
+
+public:
+	CClipRegion()
+	{
+		m_nCount = 0;
+		m_nFirst = 0;
+	}
+
+	void Push( const CRect& rc )
+	{
+		_ASSERT( m_nCount < MaxRects );
+		m_arrRects[m_nCount++] = rc;
+	}
+
+	void Pop()
+	{
+		_ASSERT( m_nCount > 0 );
+		m_nCount--;
+	}
+
+	int GetFirst() const
+	{
+		return m_nFirst;
+	}
+
+	void SetFirst( int nFirst )
+	{
+		m_nFirst = nFirst;
+	}
+
+	bool IsActive() const
+	{
+		return m_nFirst < m_nCount;
+	}
+
+	bool IsHidden( int x, int y ) const
+	{
+		for ( int i = m_nFirst; i < m_nCount; i++ )
+			if ( m_arrRects[i].IsInside( x, y ) )
+				return true;
+		return false;
+	}
+
+	// no part of rc is hidden
+	bool IsVisible( const CRect& rc ) const
+	{
+		for ( int i = m_nFirst; i < m_nCount; i++ )
+			if ( m_arrRects[i].Intersects( rc ) )
+				return false;
+		return true;
+	}
+
+	// every part of rc is hidden
+	bool IsHidden( const CRect& rc ) const
+	{
+		CRect arrPieces[MaxPieces];
+		return GetVisible( rc, arrPieces, MaxPieces ) == 0;
+	}
+
+	// splits rc into rectangles that are not hidden, returns their number.
+	// When the pieces do not fit, the smallest ones are not drawn
+	int GetVisible( const CRect& rc, CRect* pPieces, int nMax ) const
+	{
+		if ( rc.right <= rc.left || rc.bottom <= rc.top || nMax < 1 )
+			return 0;
+
+		int nCount = 0;
+		pPieces[nCount++] = rc;
+		for ( int i = m_nFirst; i < m_nCount; i++ )
+		{
+			const CRect& rcHide = m_arrRects[i];
+			// pieces appended in this round are already outside of rcHide
+			for ( int j = 0, nEnd = nCount; j < nEnd; j++ )
+			{
+				CRect rcPiece = pPieces[j];
+				if ( !rcPiece.Intersects( rcHide ) )
+					continue;
+
+				pPieces[j].Invalidate();
+				int nTop = max( rcPiece.top, rcHide.top );
+				int nBottom = min( rcPiece.bottom, rcHide.bottom );
+				CRect arrSplit[4] = {
+					CRect( rcPiece.left, rcPiece.top, rcPiece.right, nTop ),
+					CRect( rcPiece.left, nBottom, rcPiece.right, rcPiece.bottom ),
+					CRect( rcPiece.left, nTop, rcHide.left, nBottom ),
+					CRect( rcHide.right, nTop, rcPiece.right, nBottom )
+				};
+				for ( int k = 0; k < 4; k++ )
+				{
+					const CRect& rcSplit = arrSplit[k];
+					if ( rcSplit.right <= rcSplit.left || rcSplit.bottom <= rcSplit.top )
+						continue;
+					if ( !pPieces[j].IsValid() )
+						pPieces[j] = rcSplit;
+					else if ( nCount < nMax )
+						pPieces[nCount++] = rcSplit;
+				}
+			}
+			// drop the pieces hidden completely
+			int nValid = 0;
+			for ( int j = 0; j < nCount; j++ )
+				if ( pPieces[j].IsValid() )
+					pPieces[nValid++] = pPieces[j];
+			nCount = nValid;
+		}
+		return nCount;
+	}
+};
+
 template <class TYPE>
 class DLLAPI CArray
 {
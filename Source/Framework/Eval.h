@@ -398,7 +398,7 @@ public:
 	PSTR m_pEndPtr;
 
 private:
-	virtual const CEvalToken* isOperator( CHAR* pszExpression ) = NULL;
+	virtual const CEvalToken* isOperator( CHAR* pszExpression ) = 0;
 
 public:
 	CEvalOperand Eval( PSTR pszExpression )
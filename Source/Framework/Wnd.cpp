@@ -9,6 +9,8 @@
 /*static*/ CArray<CWnd::CModal> 			CWnd::m_arrModals;
 /*static*/ CRect 							CWnd::m_rcOverlay;
 /*static*/ CRect 							CWnd::m_rcOverlayStack;
+/*static*/ CClipRegion						CWnd::m_rgnClip;
+/*static*/ CRect 							CWnd::m_rcDamage;
 
 CWnd::CWnd()
 {
@@ -20,6 +22,8 @@ CWnd::CWnd()
 		m_arrTimers.Init( m_arrTimers_, COUNT(m_arrTimers_) );
 		m_arrModals.Init( m_arrModals_, COUNT(m_arrModals_) );
 		m_rcOverlay.Invalidate();
+		m_rcDamage.Invalidate();
+		BIOS::LCD::SetClip( &m_rgnClip );
 	}
 }
 
@@ -186,6 +190,7 @@ void CWnd::Create( const char* pszId, ui16 dwFlags, const CRect& rc, CWnd* pPare
 	{
 		case WmPaint:
 		{
+			int nFirst = _BeginClip();
 			OnPaint();
 
 			CWnd *pChild = m_pFirst;
@@ -195,12 +200,17 @@ void CWnd::Create( const char* pszId, ui16 dwFlags, const CRect& rc, CWnd* pPare
 					pChild->WindowMessage( WmPaint );
 				pChild = pChild->m_pNext;
 			}
+			m_rgnClip.SetFirst( nFirst );
 		}	
 		break;
 		case WmKey:
 		{
 			if ( GetActiveWindow() )
+			{
+				int nFirst = GetActiveWindow()->_BeginClip();
 				GetActiveWindow()->OnKey( nParam );
+				m_rgnClip.SetFirst( nFirst );
+			}
 		}
 		break;
 		case WmTick:
@@ -223,7 +233,11 @@ void CWnd::Create( const char* pszId, ui16 dwFlags, const CRect& rc, CWnd* pPare
 		case WmBroadcast:
 		{
 			if ( m_dwFlags & WsListener )
+			{
+				int nFirst = _BeginClip();
 				OnMessage( NULL, WmBroadcast, nParam );
+				m_rgnClip.SetFirst( nFirst );
+			}
 
 			CWnd *pChild = m_pFirst;
 			while (pChild)
@@ -363,7 +377,9 @@ void CWnd::_UpdateTimers()
 		{
 			// enable resident timers ?
 			_ASSERT( timer.m_pWnd->m_dwFlags & CWnd::WsVisible );
+			int nFirst = timer.m_pWnd->_BeginClip();
 			timer.m_pWnd->OnTimer();
+			m_rgnClip.SetFirst( nFirst );
 			timer.m_nNext = BIOS::SYS::GetTick() + timer.m_nInterval;
 		}
 	}
@@ -389,7 +405,9 @@ bool CWnd::IsVisible()
 void CWnd::StartModal( CWnd* pwndChildFocus /*= NULL*/ )
 {
 	CModal modCurrent;
+	modCurrent.m_pWnd = this;
 	m_arrModals.Add( modCurrent );
+	m_rgnClip.Push( m_rcClient );
 
 	if ( pwndChildFocus )
 		pwndChildFocus->SetFocus();
@@ -411,8 +429,11 @@ void CWnd::StopModal()
 	Destroy();
 	m_rcOverlay.Invalidate();
 	m_arrModals.GetLast().m_pPrevFocus->SetFocus();
-	// redraw everything without any limits
+	m_rgnClip.Pop();
+	// redraw everything, the windows may limit the work to the uncovered area
+	m_rcDamage = m_rcClient;
 	m_pTop->Invalidate();
+	m_rcDamage.Invalidate();
 	m_rcOverlay = m_arrModals.GetLast().m_rcPrevOverlay;
 	m_arrModals.RemoveLast();
 }
@@ -422,6 +443,34 @@ const CRect& CWnd::GetOverlay()
 	return m_rcOverlay;
 }
 
+const CClipRegion& CWnd::GetClipRegion()
+{
+	return m_rgnClip;
+}
+
+const CRect& CWnd::GetDamage()
+{
+	return m_rcDamage;
+}
+
+// number of the modal windows lying under this one, these do not hide it
+int CWnd::_GetClipLevel()
+{
+	for ( CWnd* pWnd = this; pWnd && m_arrModals.GetSize() > 0; pWnd = pWnd->m_pParent )
+		for ( int i = m_arrModals.GetSize()-1; i >= 0; i-- )
+			if ( m_arrModals[i].m_pWnd == pWnd )
+				return i+1;
+	return 0;
+}
+
+// the clip region hides what covers this window, returns the previous state
+int CWnd::_BeginClip()
+{
+	int nFirst = m_rgnClip.GetFirst();
+	m_rgnClip.SetFirst( _GetClipLevel() );
+	return nFirst;
+}
+
 const CWnd::CModal& CWnd::GetTopModal()
 {
 	return CWnd::m_arrModals.GetLast();
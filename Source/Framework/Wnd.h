@@ -33,10 +33,12 @@ public:
 		{
 			m_pPrevFocus = CWnd::m_pFocus;
 			m_rcPrevOverlay = CWnd::m_rcOverlay; 
+			m_pWnd = NULL;
 		}
 
 		CWnd*		m_pPrevFocus;
 		CRect		m_rcPrevOverlay;
+		CWnd*		m_pWnd;
 	};
 
 public:
@@ -72,6 +74,11 @@ public:
 	static CArray<CModal> m_arrModals;
 	static CRect m_rcOverlay;
 	static CRect m_rcOverlayStack;
+	// client rectangles of the modal windows in the order they were started
+	static CClipRegion m_rgnClip;
+	// area uncovered by a modal window, valid while the windows are repainted
+	// after StopModal
+	static CRect m_rcDamage;
 
 	CRect	m_rcClient;						// 8
 	CWnd*	m_pParent;						// 4
@@ -109,6 +116,8 @@ public:
 	void StopModal();
 
 	const CRect& GetOverlay();
+	const CClipRegion& GetClipRegion();
+	const CRect& GetDamage();
 	const CModal& GetTopModal();
 	void PushOverlay();
 	void PopOverlay();
@@ -120,6 +129,8 @@ private:
 	CWnd* _GetFirstActiveWindow();
 
 	void _UpdateTimers();
+	int _GetClipLevel();
+	int _BeginClip();
 };                                 
 
 #endif
\ No newline at end of file
@@ -231,6 +231,7 @@ public:
 
 		BIOS::LCD::Bar( m_rcClient, RGB565(000000) );
 
+		BIOS::LCD::Print (   4, 240-13*16, clrA, 0, "Waveforms per second:" );
 		BIOS::LCD::Print (   4, 240-12*16, clrA, 0, "Cold boot:" );
 		BIOS::LCD::Print (   4, 240-11*16, clrA, 0, "Battery voltage:" );
 		BIOS::LCD::Print (   4, 240-10*16, clrA, 0, "USB Powered:" );
@@ -305,6 +306,7 @@ public:
 		BIOS::LCD::Printf( 240, 240-11*16, clrB, 0, "%f V  ", fBattery );
 		BIOS::LCD::Printf( 240, 240-10*16, clrB, 0, "%s  ", nUsbPower ? "Yes" : "No" );
 		BIOS::LCD::Printf( 240, 240-12*16, clrB, 0, "%s  ", BIOS::SYS::IsColdBoot() ? "Yes" : "No");
+		BIOS::LCD::Printf( 240, 240-13*16, clrB, 0, "%d  ", Settings.Runtime.m_nWaveformsPerSecond );
 	}
 };
 
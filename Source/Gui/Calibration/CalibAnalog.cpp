@@ -111,9 +111,9 @@ void CWndListCalSimple::OnWave()
 	{
 		int nValue = 0;
 		if ( m_calChannel == CSettings::Trigger::_CH1 )
-			nValue = BIOS::ADC::GetAt(i) & 0xff;
+			nValue = CCaptureStore::GetAnalogAt( CCaptureStore::CH1, i );
 		if ( m_calChannel == CSettings::Trigger::_CH2 )
-			nValue = (BIOS::ADC::GetAt(i) >> 8) & 0xff;
+			nValue = CCaptureStore::GetAnalogAt( CCaptureStore::CH2, i );
 
 		if ( nMax == -1 )
 			nMax = nMin = nValue;
@@ -7,6 +7,7 @@
 #include <Source/Core/ListItems.h>
 #include <Source/Core/Settings.h>
 #include "CalibCore.h"
+#include <Source/Gui/Oscilloscope/Core/CaptureStore.h>
 
 class CWndListCalSimple : public CListBox
 {
@@ -237,9 +238,9 @@ public:
 				{
 					int nValue = 0;
 					if ( CCalibration::nChannel == 1 )
-						nValue = BIOS::ADC::GetAt(i) & 0xff;
+						nValue = CCaptureStore::GetAnalogAt( CCaptureStore::CH1, i );
 					if ( CCalibration::nChannel == 2 )
-						nValue = (BIOS::ADC::GetAt(i) >> 8) & 0xff;
+						nValue = CCaptureStore::GetAnalogAt( CCaptureStore::CH2, i );
 
 					if ( nMax == -1 )
 						nMax = nMin = nValue;
@@ -57,7 +57,7 @@
 		{
 			int nIndex = nBegin + i*(nEnd - nBegin)/nTargetLen;
 			BIOS::ADC::SSample Sample;
-			Sample.nValue = BIOS::ADC::GetAt( nIndex );
+			Sample.nValue = CCaptureStore::GetAt( nIndex );
 			*pVolatile++ = Sample.CH1;
 		}
 		Settings.Gen.Wave = CSettings::Generator::_Volatile;
@@ -154,7 +154,7 @@ CWnd* CWndModuleSelector::_GetWindowById(int nId)
 
 LINKERSECTION(".extra")
 /*static*/ const unsigned char CWndModuleSelector::iconSettings[] = {
-	0x47, 0x42, 0x29, 0x2b, 0x48, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x38, 0xa0, 0x41, 0xe0, 0x00, 0x60, 0x23, 0x40, 0x14, 0x80, 0x01, 0x00, 0x0e, 0x20, 0x02, 0x40, 
+	0x47, 0x53, 0x29, 0x2b, 0x48, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x00, 0x38, 0xa0, 0x41, 0xe0, 0x00, 0x60, 0x23, 0x40, 0x14, 0x80, 0x01, 0x00, 0x0e, 0x20, 0x02, 0x40, 
 	0x07, 0xe0, 0x00, 0x00, 0xfa, 0x1f, 0x18, 0xa3, 0xc1, 0xab, 0x82, 0xf1, 0x8a, 0x2c, 0x0d, 0x5f, 0x13, 0xd4, 0xe1, 0xcb, 0xd1, 0xf1, 0xba, 0x5e, 0x1c, 0x8b, 0x1f, 0x23, 0x1c, 0x5e, 0x1c, 0xbb, 
 	0x1f, 0x4b, 0xce, 0xc9, 0x3e, 0x1b, 0x31, 0xf1, 0x1a, 0x3e, 0x59, 0x5c, 0xec, 0xb9, 0x1f, 0x0b, 0x6e, 0x3c, 0x51, 0x3c, 0x1f, 0x32, 0x45, 0xa5, 0xe1, 0xa2, 0x7f, 0x5b, 0xce, 0xc6, 0x91, 0xe0, 
 	0xc1, 0xe9, 0xa4, 0x21, 0x59, 0xec, 0x0c, 0x1e, 0x59, 0x6c, 0xec, 0xb5, 0xf1, 0x2b, 0x5e, 0x3a, 0x54, 0x28, 0x1f, 0x1d, 0xa5, 0xf3, 0x24, 0x5c, 0x4e, 0x19, 0x14, 0xf5, 0xbc, 0xec, 0x57, 0x1e, 
@@ -177,7 +177,7 @@ LINKERSECTION(".extra")
 
 LINKERSECTION(".extra")
 /*static*/ const unsigned char CWndModuleSelector::iconOscilloscope[] = {
-	0x47, 0x42, 0x33, 0x23, 0x48, 0x00, 0x38, 0x00, 0x28, 0x00, 0x18, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xa0, 0x29, 0xa0, 0x10, 0xc0, 0x23, 0x00, 0x1c, 0xa0, 0x0e, 0x40, 
+	0x47, 0x53, 0x33, 0x23, 0x48, 0x00, 0x38, 0x00, 0x28, 0x00, 0x18, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xa0, 0x29, 0xa0, 0x10, 0xc0, 0x23, 0x00, 0x1c, 0xa0, 0x0e, 0x40, 
 	0x07, 0xc0, 0x00, 0x00, 0x5f, 0x07, 0x26, 0x05, 0x16, 0x07, 0xb1, 0xf0, 0x75, 0x60, 0x78, 0x4f, 0x97, 0x65, 0x49, 0xdc, 0xa6, 0x79, 0x1f, 0x06, 0x15, 0x64, 0xad, 0xca, 0x67, 0x81, 0xf3, 0x76, 
 	0xad, 0x2e, 0x49, 0x34, 0x57, 0x7f, 0x37, 0x65, 0xd2, 0xe4, 0xa3, 0x46, 0x7d, 0x3f, 0x46, 0x53, 0x2c, 0x3e, 0x2b, 0x56, 0x6f, 0x57, 0x64, 0x32, 0xd3, 0xe2, 0xb5, 0x66, 0xf6, 0x75, 0xad, 0xec, 
 	0x81, 0xe4, 0xb2, 0x35, 0x65, 0xf6, 0x76, 0x4d, 0xec, 0xb1, 0xe4, 0x92, 0x45, 0x7b, 0x3f, 0x86, 0x43, 0x29, 0xed, 0x09, 0x1e, 0x23, 0x57, 0x4f, 0x77, 0x64, 0x31, 0xce, 0xc1, 0x04, 0xee, 0xb4, 
@@ -208,7 +208,7 @@ LINKERSECTION(".extra")
 
 LINKERSECTION(".extra")
 /*static*/ const unsigned char CWndModuleSelector::iconSpectrum[] = {
-	0x47, 0x42, 0x2a, 0x22, 0x60, 0x00, 0x00, 0x00, 0x28, 0x00, 0x88, 0x80, 0x30, 0xc0, 0x72, 0x20, 0x53, 0xa0, 0x1a, 0xe0, 0x24, 0xa0, 0x00, 0xa0, 0x1e, 0x60, 0x0d, 0xc0, 0x01, 0x20, 0x07, 0x40, 
+	0x47, 0x53, 0x2a, 0x22, 0x60, 0x00, 0x00, 0x00, 0x28, 0x00, 0x88, 0x80, 0x30, 0xc0, 0x72, 0x20, 0x53, 0xa0, 0x1a, 0xe0, 0x24, 0xa0, 0x00, 0xa0, 0x1e, 0x60, 0x0d, 0xc0, 0x01, 0x20, 0x07, 0x40, 
 	0x06, 0xc0, 0x07, 0xe0, 0xd8, 0x11, 0x0c, 0x1b, 0x08, 0xb2, 0x10, 0xb1, 0xf0, 0x7e, 0x61, 0x12, 0x51, 0xf0, 0xbb, 0x21, 0x0b, 0x1f, 0x15, 0x0d, 0x61, 0x10, 0x51, 0xf0, 0xbd, 0x11, 0x0c, 0x2d, 
 	0x27, 0x1b, 0x1f, 0x25, 0x0e, 0x1d, 0x0b, 0xc5, 0x11, 0x2b, 0x1f, 0x2d, 0x05, 0x1f, 0x2b, 0x28, 0x2f, 0x0c, 0x71, 0x0c, 0x2f, 0x26, 0x2b, 0x1f, 0x25, 0x0d, 0x1f, 0x28, 0x02, 0xe4, 0x10, 0x71, 
 	0xd2, 0x80, 0x81, 0xf2, 0xd0, 0x51, 0xf2, 0xb0, 0x62, 0xf0, 0xc3, 0x10, 0xc1, 0xc1, 0x1c, 0x2f, 0x26, 0x0b, 0x1f, 0x25, 0x0d, 0x1f, 0x28, 0x08, 0x1f, 0x27, 0x29, 0x2c, 0x01, 0x83, 0x10, 0xe1, 
@@ -234,7 +234,7 @@ LINKERSECTION(".extra")
 
 LINKERSECTION(".extra")
 /*static*/ const unsigned char CWndModuleSelector::iconGenerator[] = {
-	0x47, 0x42, 0x20, 0x31, 0x48, 0x20, 0x30, 0x20, 0x20, 0x20, 0x10, 0x41, 0x90, 0x20, 0x70, 0x20, 0x71, 0xa0, 0x4a, 0x60, 0x3b, 0xe0, 0x10, 0xe0, 0x11, 0xa0, 0x0a, 0x60, 0x16, 0x00, 0x0b, 0xe0, 
+	0x47, 0x53, 0x20, 0x31, 0x48, 0x20, 0x30, 0x20, 0x20, 0x20, 0x10, 0x41, 0x90, 0x20, 0x70, 0x20, 0x71, 0xa0, 0x4a, 0x60, 0x3b, 0xe0, 0x10, 0xe0, 0x11, 0xa0, 0x0a, 0x60, 0x16, 0x00, 0x0b, 0xe0, 
 	0x07, 0xc0, 0x00, 0x00, 0xd8, 0x1f, 0x1b, 0xb5, 0xf2, 0xde, 0xac, 0x3f, 0x33, 0xae, 0xd4, 0xf3, 0x3c, 0xe9, 0xa1, 0xf3, 0xec, 0x13, 0x3f, 0x4d, 0xe7, 0x13, 0x93, 0xf4, 0x30, 0x6e, 0xd2, 0xf4, 
 	0xbd, 0x8c, 0xe2, 0xd0, 0xf3, 0xf0, 0xa6, 0xe1, 0xd3, 0x1f, 0x4d, 0xe6, 0x03, 0x93, 0xfc, 0x30, 0x6e, 0xdf, 0x31, 0x07, 0x6c, 0xe1, 0x71, 0xb9, 0x3f, 0x19, 0xa1, 0x51, 0xec, 0x14, 0x85, 0x02, 
 	0xfd, 0xe6, 0x03, 0x93, 0xf7, 0x30, 0x6e, 0xdf, 0x31, 0x10, 0x24, 0xce, 0x10, 0x02, 0x5f, 0x63, 0x23, 0x76, 0x51, 0x13, 0x6f, 0xbc, 0xe8, 0x73, 0xf2, 0xf0, 0xb1, 0xc0, 0xe3, 0xe6, 0xcc, 0xd9, 
@@ -257,7 +257,7 @@ LINKERSECTION(".extra")
 
 LINKERSECTION(".extra")
 /*static*/ const unsigned char CWndModuleSelector::iconAbout[] = {
-	0x47, 0x42, 0x24, 0x24, 0x48, 0x20, 0x30, 0x20, 0x20, 0x20, 0x10, 0x41, 0x90, 0x20, 0x70, 0x20, 0x71, 0xa0, 0x4a, 0x60, 0x3b, 0xe0, 0x10, 0xe0, 0x11, 0xa0, 0x0a, 0x60, 0x16, 0x00, 0x0b, 0xe0, 
+	0x47, 0x53, 0x24, 0x24, 0x48, 0x20, 0x30, 0x20, 0x20, 0x20, 0x10, 0x41, 0x90, 0x20, 0x70, 0x20, 0x71, 0xa0, 0x4a, 0x60, 0x3b, 0xe0, 0x10, 0xe0, 0x11, 0xa0, 0x0a, 0x60, 0x16, 0x00, 0x0b, 0xe0, 
 	0x07, 0xc0, 0x00, 0x00, 0xb1, 0xf0, 0xa1, 0xd0, 0xc3, 0xc1, 0xda, 0x83, 0xf1, 0x9d, 0xb1, 0xe1, 0xd9, 0x82, 0xf0, 0xdf, 0x1e, 0x0d, 0x92, 0xf1, 0xac, 0x92, 0xe1, 0xc9, 0xa1, 0xf0, 0xad, 0x2e, 
 	0x0b, 0xc1, 0xf0, 0xbf, 0x2e, 0x0a, 0x6f, 0x09, 0xd1, 0xe3, 0xda, 0xbc, 0x7e, 0x0a, 0x81, 0xf1, 0x3c, 0x7e, 0x0a, 0x2f, 0x0d, 0xc1, 0xe0, 0xc4, 0xf0, 0xdd, 0x1e, 0x0b, 0x2f, 0x0a, 0x81, 0xe1, 
 	0xd3, 0x5f, 0x01, 0x91, 0xe1, 0xc9, 0x1f, 0x0c, 0xe1, 0xe0, 0xf1, 0xf0, 0xd8, 0x2e, 0x0c, 0xb1, 0xe1, 0x82, 0x3f, 0x01, 0xe3, 0xe2, 0xcf, 0xad, 0x1e, 0x1d, 0xb1, 0xa0, 0xcc, 0x1e, 0x17, 0x21, 
@@ -272,7 +272,7 @@ LINKERSECTION(".extra")
 
 LINKERSECTION(".extra")
 /*static*/ const unsigned char CWndModuleSelector::iconUser[] = {
-	0x47, 0x42, 0x25, 0x27, 0xa0, 0x00, 0x68, 0x00, 0x00, 0x00, 0x38, 0x00, 0x18, 0x00, 0x79, 0x40, 0x72, 0x60, 0x4c, 0x40, 0x01, 0x60, 0x0a, 0xe0, 0x15, 0xa0, 0x16, 0x60, 0x0c, 0x80, 0x07, 0x80, 
+	0x47, 0x53, 0x25, 0x27, 0xa0, 0x00, 0x68, 0x00, 0x00, 0x00, 0x38, 0x00, 0x18, 0x00, 0x79, 0x40, 0x72, 0x60, 0x4c, 0x40, 0x01, 0x60, 0x0a, 0xe0, 0x15, 0xa0, 0x16, 0x60, 0x0c, 0x80, 0x07, 0x80, 
 	0x07, 0x00, 0x07, 0xe0, 0xa1, 0x21, 0x88, 0x94, 0x20, 0x81, 0xc0, 0x97, 0x21, 0x8e, 0x1f, 0x0a, 0xa2, 0x20, 0xc3, 0xf1, 0xd8, 0x52, 0x0a, 0x3f, 0x08, 0x82, 0x21, 0x4b, 0x4f, 0x0a, 0x32, 0x14, 
 	0xb5, 0xf0, 0x8f, 0x12, 0x09, 0x6f, 0x19, 0x41, 0x20, 0x96, 0xf1, 0x34, 0xd1, 0x21, 0x46, 0x6f, 0x0e, 0x12, 0x13, 0xa6, 0xf0, 0xcf, 0x12, 0x0c, 0x6f, 0x3d, 0x34, 0x87, 0xf1, 0x63, 0xc1, 0x22, 
 	0x43, 0x67, 0xf2, 0xc4, 0x57, 0xf0, 0xcf, 0x12, 0x09, 0x7f, 0x25, 0x3a, 0x7f, 0x25, 0x34, 0xc1, 0x22, 0x30, 0xb6, 0xf2, 0xb3, 0x57, 0xf0, 0x8f, 0x12, 0x14, 0xe6, 0xf2, 0x03, 0xa6, 0xf2, 0x70, 
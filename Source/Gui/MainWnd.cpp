@@ -70,6 +70,7 @@ void CMainWnd::Create()
 	SendMessage( &m_wndToolBar, ToWord('g', 'i'), Settings.Runtime.m_nMenuItem);
 
 	m_lLastAcquired = 0;
+	m_nWaveforms = 0;
 	SetTimer(200);
 }
 
@@ -85,6 +86,10 @@ void CMainWnd::Create()
 		static int nSeconds = 0;
 		nSeconds++;
 
+		Settings.Runtime.m_nWaveformsPerSecond = m_nWaveforms;
+		m_nWaveforms = 0;
+		CPerf::Second();
+
 		if ( Settings.Runtime.m_nStandby != 0 )
 		{
 			if ( (int)BIOS::SYS::GetTick() > m_nLastKey + Settings.Runtime.m_nStandby*60000 )
@@ -145,11 +150,24 @@ void CMainWnd::Create()
 		if ( m_lLastAcquired != -1 && BIOS::SYS::GetTick() - m_lLastAcquired > 150 )
 		{
 			bool bScreenReady = BIOS::ADC::GetPointer() > (300 + Settings.Time.InvalidFirst);
+			CPerf::Begin( CPerf::Copy );
 			BIOS::ADC::Copy( BIOS::ADC::GetCount() );
+			CPerf::End( CPerf::Copy );
+			CPerf::Begin( CPerf::Store );
+			if ( CCorePeak::IsActive() )
+				CCorePeak::Process();
+			else if ( CCoreHiRes::IsActive() )
+				CCoreHiRes::Process();
+			else
+				CCaptureStore::Update();
+			CPerf::End( CPerf::Store );
 
 			// redraw the screen even when the sampler is not full
 			//BIOS::LCD::Print(0, 0, RGB565(ff0000), 0, "U");
-			WindowMessage( CWnd::WmBroadcast, ToWord('d', 'g') );
+			CPerf::Begin( CPerf::Broadcast );
+			WindowMessage( CWnd::WmBroadcast, ToWord('d', 'a') );
+			PaintFrame();
+			CPerf::End( CPerf::Broadcast );
 			//BIOS::LCD::Print(0, 0, RGB565(808080), 0, "u");
 		
 			// force restart if the write pointer is behind current window
@@ -163,9 +181,41 @@ void CMainWnd::Create()
 	}
 }
 
+void CMainWnd::Acquired(ui32 nCaptured)
+{
+	// every waveform goes to the windows analysing the data ('da'), the
+	// windows drawing it ('dg') get only as many frames as the pacer allows
+	CPerf::Begin( CPerf::Broadcast );
+	WindowMessage( CWnd::WmBroadcast, ToWord('d', 'a') );
+	if ( CFramePacer::Acquired( nCaptured ) )
+		PaintFrame();
+	CPerf::End( CPerf::Broadcast );
+}
+
+void CMainWnd::ShowCapture()
+{
+	WindowMessage( CWnd::WmBroadcast, ToWord('d', 'a') );
+	PaintFrame();
+}
+
+void CMainWnd::PaintFrame()
+{
+	WindowMessage( CWnd::WmBroadcast, ToWord('d', 'g') );
+	CFramePacer::Painted();
+}
+
 /*virtual*/ void CMainWnd::OnPaint()
 {
+	if ( GetDamage().IsValid() )
+	{
+		// a modal window was closed, the graph repaints the uncovered columns
+		// and the columns changed meanwhile
+		BIOS::LCD::Bar( GetDamage(), RGB565(000000) );
+		m_wndGraph.InvalidateColumns( GetDamage() );
+		return;
+	}
 	BIOS::LCD::Clear(RGB565(000000));
+	m_wndGraph.InvalidateColumns();
 }
 
 /*virtual*/ void CMainWnd::OnMessage(CWnd* pSender, ui16 code, ui32 data)
@@ -251,50 +301,44 @@ void CMainWnd::OnMouseClick()
 	}
 }
 
-ui32 GetInterpolatedSample( int nSample256 )
+void CMainWnd::Resample()
 {
-	// real sample index = nSample256 / 256.0f
-	int nBase = nSample256 / 1024;
-	int nFraction = nSample256 & 1023;
-
-	_ASSERTW( nBase + 1 < (int)BIOS::ADC::GetCount() );
-
-	BIOS::ADC::SSample nSampleA;
-	nSampleA.nValue = BIOS::ADC::GetAt( nBase );
-
-	BIOS::ADC::SSample nSampleB;
-	nSampleB.nValue = BIOS::ADC::GetAt( nBase + 1 );
-
-	// interpolate values for CH1 and CH2 in nSampleA..nSampleB and store result in nSampleA
-	nSampleA.CH1 += (int)(nSampleB.CH1 - nSampleA.CH1) * nFraction / 1024;
-	nSampleA.CH2 += (int)(nSampleB.CH2 - nSampleA.CH2) * nFraction / 1024;
-
-	return nSampleA.nValue;
+	int nTimebaseCorrection = Settings.Time.pfValueResolutionCorrection[ (NATIVEENUM)Settings.Time.Resolution ];
+	CResampler::Process( &BIOS::ADC::GetAt(0), BIOS::ADC::GetCount(), nTimebaseCorrection );
 }
 
-void CMainWnd::Resample()
+static int _GetMathSample(int i)
 {
-	int nTimebaseCorrection = Settings.Time.pfValueResolutionCorrection[ (NATIVEENUM)Settings.Time.Resolution ];
-	if ( nTimebaseCorrection == 1024 )
-		return;
+	return MainWnd.m_wndGraph.MathCalc( CCaptureStore::GetAt( i ) );
+}
 
-	if ( nTimebaseCorrection < 1024 )
+bool CMainWnd::SoftTrigger()
+{
+	// moves the first software trigger candidate following the trigger position
+	// to the trigger position, returns false when there is no candidate
+	if ( Settings.Trig.Soft == CSettings::Trigger::_SoftOff )
+		return true;
+	if ( Settings.Trig.Source == CSettings::Trigger::_Math && Settings.Math.Type == CSettings::MathOperator::_Off )
+		return false;
+
+	CSettings::Calibrator::FastCalc fastCalc1, fastCalc2;
+	if ( Settings.Trig.Source == CSettings::Trigger::_Math )
 	{
-		// shrink
-		for (int i=4096-1; i>=1; i--) // no need to copy [0] <- [0*nCorrect/1k]
-		{
-			BIOS::ADC::SSample& nSample = (BIOS::ADC::SSample&)BIOS::ADC::GetAt( i );
-			BIOS::ADC::SSample nInterpolated;
-			nInterpolated.nValue = GetInterpolatedSample( i * nTimebaseCorrection );
-
-			nSample.CH[0] = nInterpolated.CH[0];
-			nSample.CH[1] = nInterpolated.CH[1];
-			nSample.CH[2] = nInterpolated.CH[2]; // contains CH3 & CH4
-		}
-	} else {
-		// expand
-		_ASSERT( 0 );
+		Settings.CH1Calib.Prepare( &Settings.CH1, fastCalc1 );
+		Settings.CH2Calib.Prepare( &Settings.CH2, fastCalc2 );
+		m_wndGraph.MathSetup( &fastCalc1, &fastCalc2 );
 	}
+
+	CSoftTrigger::TCondition cond;
+	CSoftTrigger::GetCondition( cond );
+	int nCandidate = CSoftTrigger::Find( CSoftTrigger::GetSource( Settings.Trig.Source, _GetMathSample ), cond,
+		Settings.Trig.nPosition, CCaptureStore::Length );
+	if ( nCandidate < 0 )
+		return false;
+
+	CCaptureStore::Align( nCandidate - Settings.Trig.nPosition );
+	CCorePeak::Shift( nCandidate - Settings.Trig.nPosition );
+	return true;
 }
 
 /*virtual*/ void CMainWnd::WindowMessage(int nMsg, int nParam /*=0*/)
@@ -327,25 +371,130 @@ void CMainWnd::Resample()
 		if ( bEnableSdk )
 			SdkUartProc();
 
-		if ( (Settings.Trig.Sync != CSettings::Trigger::_None) && BIOS::ADC::Enabled() && BIOS::ADC::Ready() )
+		if ( Settings.Trig.Sync == CSettings::Trigger::_Roll && BIOS::ADC::Enabled() )
+		{
+			// roll mode does not wait for the full buffer, samples are taken as soon
+			// as they are written and the graph draws only the new columns, at most
+			// 50 times per second
+			if ( BIOS::SYS::GetTick() - m_lLastAcquired >= 20 && CCoreRoll::Acquire() > 0 )
+			{
+				m_lLastAcquired = BIOS::SYS::GetTick();
+				WindowMessage( CWnd::WmBroadcast, ToWord('r', 'l') );
+			}
+		} else
+		if ( Settings.Trig.Sync == CSettings::Trigger::_Seq && BIOS::ADC::Enabled() && BIOS::ADC::Ready() )
 		{
-			// ADC::Ready means that the write pointer is at the end of buffer, we can restart sampler
-			BIOS::ADC::Copy( BIOS::ADC::GetCount() );
+			// segmented acquisition, every trigger stores a segment directly into the
+			// ADC buffer. Nothing is processed until the sequence is complete
+			bool bComplete = CCoreSequence::Acquire();
 			BIOS::ADC::Restart();
-			Resample();
-
-			// trig stuff
+			m_nWaveforms++;
 			m_lLastAcquired = BIOS::SYS::GetTick();
-			if ( BIOS::ADC::Enabled() && Settings.Trig.Sync == CSettings::Trigger::_Single )
+			if ( bComplete )
 			{
 				BIOS::ADC::Enable( false );
 				Settings.Trig.State = CSettings::Trigger::_Stop;
 				if ( m_wndMenuInput.m_itmTrig.IsVisible() )
 					m_wndMenuInput.m_itmTrig.Invalidate();
+
+				Settings.Trig.nSegment = 0;
+				CCoreSequence::Replay( 0 );
+				ShowCapture();
+			}
+		} else
+		if ( Settings.Trig.Sync == CSettings::Trigger::_Ets && BIOS::ADC::Enabled() && BIOS::ADC::Ready() )
+		{
+			// equivalent time sampling, the raw capture is not resampled, it is
+			// binned into the fine grid by the phase of its trigger crossing
+			ui32 nCaptured = BIOS::SYS::GetMicros();
+			CPerf::Begin( CPerf::Copy );
+			BIOS::ADC::Copy( BIOS::ADC::GetCount() );
+			BIOS::ADC::Restart();
+			CPerf::End( CPerf::Copy );
+			CPerf::Begin( CPerf::Store );
+			CCaptureStore::Update();
+			CPerf::End( CPerf::Store );
+			m_lLastAcquired = BIOS::SYS::GetTick();
+
+			CPerf::Begin( CPerf::Resample );
+			bool bAcquired = CCoreEts::Acquire();
+			CCoreEts::Render();
+			CPerf::End( CPerf::Resample );
+			if ( bAcquired )
+			{
+				m_nWaveforms++;
+				Acquired( nCaptured );
+			}
+		} else
+		if ( CCoreRecorder::IsReplaying() ? CCoreRecorder::IsDue() :
+			(Settings.Trig.Sync != CSettings::Trigger::_None) && BIOS::ADC::Enabled() && BIOS::ADC::Ready() )
+		{
+			// ADC::Ready means that the write pointer is at the end of buffer, we can restart sampler.
+			// A replayed frame takes the place of the capture
+			ui32 nCaptured = BIOS::SYS::GetMicros();
+			CPerf::Begin( CPerf::Copy );
+			if ( CCoreRecorder::IsReplaying() )
+			{
+				if ( CCoreRecorder::Replay() )
+					Invalidate();
+			} else
+			{
+				BIOS::ADC::Copy( BIOS::ADC::GetCount() );
+				BIOS::ADC::Restart();
+				if ( CCoreRecorder::IsRecording() )
+					CCoreRecorder::Record();
 			}
+			CPerf::End( CPerf::Copy );
+			CPerf::Begin( CPerf::Resample );
+			Resample();
+			CPerf::End( CPerf::Resample );
+			CPerf::Begin( CPerf::Store );
+			if ( CCorePeak::IsActive() )
+				CCorePeak::Process();
+			else if ( CCoreHiRes::IsActive() )
+				CCoreHiRes::Process();
+			else
+				CCaptureStore::Update();
+			CPerf::End( CPerf::Store );
+			CPerf::Begin( CPerf::Trigger );
+			bool bTriggered = SoftTrigger();
+			CPerf::End( CPerf::Trigger );
+			// without a candidate in this capture nothing is processed, the sampler
+			// is already running again and a dropped frame can still be due
+			if ( bTriggered || ( Settings.Trig.Sync != CSettings::Trigger::_Norm &&
+				Settings.Trig.Sync != CSettings::Trigger::_Single ) )
+			{
+				m_nWaveforms++;
+				CPerf::Begin( CPerf::Average );
+				CCoreAverage::Process();
+				CPerf::End( CPerf::Average );
+				if ( CCorePhosphor::IsActive() )
+				{
+					CPerf::Begin( CPerf::Phosphor );
+					CCorePhosphor::Process();
+					CPerf::End( CPerf::Phosphor );
+				}
 
-			// broadcast message for windows that process waveform data
-			WindowMessage( CWnd::WmBroadcast, ToWord('d', 'g') );
+				// trig stuff
+				m_lLastAcquired = BIOS::SYS::GetTick();
+				if ( BIOS::ADC::Enabled() && Settings.Trig.Sync == CSettings::Trigger::_Single )
+				{
+					BIOS::ADC::Enable( false );
+					Settings.Trig.State = CSettings::Trigger::_Stop;
+					if ( m_wndMenuInput.m_itmTrig.IsVisible() )
+						m_wndMenuInput.m_itmTrig.Invalidate();
+				}
+
+				Acquired( nCaptured );
+			}
+		}
+
+		// the last waveform dropped by the pacer is painted once its frame is due
+		if ( CFramePacer::IsDue() )
+		{
+			CPerf::Begin( CPerf::Broadcast );
+			PaintFrame();
+			CPerf::End( CPerf::Broadcast );
 		}
 		m_Mouse.Show();
 		return;
@@ -5,6 +5,8 @@
 
 #include "Toolbar.h"
 #include "Oscilloscope/Core/CoreOscilloscope.h"
+#include <Source/Core/Perf.h>
+#include <Source/Core/FramePacer.h>
 #include "Oscilloscope/Oscilloscope.h"
 #include "Windows/WndConfirm.h"
 #include "Windows/MessageBox.h"
@@ -86,17 +88,24 @@ public:
 	bool				HasOverlay();
 	void				OnMouseClick();
 	void				Resample();
+	bool				SoftTrigger();
+	// the capture store changed outside of an acquisition (segment replay,
+	// stopped ADC), it is analysed and painted at once
+	void				ShowCapture();
 
 private:
 	// auto trigger
 	long				m_lLastAcquired;
 	int					m_nLastKey;
 	bool				m_bSleeping;
+	int					m_nWaveforms;
 
 private:
 	void				SdkDiskProc();
 	void				SdkUartProc();
 	void				CallShortcut(int nShortcut);
+	void				Acquired(ui32 nCaptured);
+	void				PaintFrame();
 };
 
 #endif
\ No newline at end of file
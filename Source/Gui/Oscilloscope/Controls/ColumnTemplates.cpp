@@ -0,0 +1,97 @@
+#include "ColumnTemplates.h"
+
+#ifdef _ARM
+/*static*/ ui16* const CColumnTemplates::m_pPool = NULL;
+#else
+static ui16 g_arrPool[CColumnTemplates::PoolSize];
+/*static*/ ui16* const CColumnTemplates::m_pPool = g_arrPool;
+#endif
+/*static*/ int CColumnTemplates::m_nPoolUsed = 0;
+/*static*/ int CColumnTemplates::m_nPoolGeneration = 0;
+
+CColumnTemplates::CColumnTemplates()
+{
+	m_pIndex = NULL;
+	m_pTemplates = NULL;
+	m_nGeneration = -1;
+	m_nKey = 0;
+	m_nWidth = 0;
+	m_nHeight = 0;
+	m_nVariants = 0;
+	m_bValid = false;
+}
+
+bool CColumnTemplates::IsValid(ui32 nKey) const
+{
+	return m_bValid && m_nGeneration == m_nPoolGeneration && m_nKey == nKey;
+}
+
+void CColumnTemplates::Begin(ui32 nKey, int nWidth, int nHeight)
+{
+	// the index is followed by the templates, the worst case has to fit
+	int nIndexWords = (nWidth + 1) / 2;
+	int nNeeded = nIndexWords + MaxVariants * nHeight;
+	if ( nNeeded > PoolSize )
+	{
+		m_bValid = false;
+		return;
+	}
+	if ( m_nPoolUsed + nNeeded > PoolSize )
+	{
+		m_nPoolUsed = 0;
+		m_nPoolGeneration++;
+	}
+
+	m_pIndex = (ui8*)&m_pPool[m_nPoolUsed];
+	m_pTemplates = &m_pPool[m_nPoolUsed + nIndexWords];
+	m_nPoolUsed += nNeeded;
+	m_nGeneration = m_nPoolGeneration;
+	m_nKey = nKey;
+	m_nWidth = nWidth;
+	m_nHeight = nHeight;
+	m_nVariants = 0;
+	m_bValid = true;
+}
+
+bool CColumnTemplates::Add(int n, const ui16* pColumn)
+{
+	if ( !m_bValid )
+		return false;
+
+	int nVariant;
+	for ( nVariant = 0; nVariant < m_nVariants; nVariant++ )
+		if ( memcmp( m_pTemplates + nVariant * m_nHeight, pColumn, m_nHeight * sizeof(ui16) ) == 0 )
+			break;
+
+	if ( nVariant == m_nVariants )
+	{
+		if ( m_nVariants == MaxVariants )
+		{
+			m_bValid = false;
+			return false;
+		}
+		memcpy( m_pTemplates + nVariant * m_nHeight, pColumn, m_nHeight * sizeof(ui16) );
+		m_nVariants++;
+	}
+	m_pIndex[n] = (ui8)nVariant;
+	return true;
+}
+
+void CColumnTemplates::End()
+{
+	// return the unused variants to the pool
+	if ( m_bValid && m_nGeneration == m_nPoolGeneration && m_pTemplates + MaxVariants * m_nHeight == &m_pPool[m_nPoolUsed] )
+		m_nPoolUsed -= ( MaxVariants - m_nVariants ) * m_nHeight;
+}
+
+void CColumnTemplates::Get(ui16* pColumn, int n, ui16 clr) const
+{
+	const ui16* pTemplate = m_pTemplates + m_pIndex[n] * m_nHeight;
+	if ( clr == Background )
+	{
+		memcpy( pColumn, pTemplate, m_nHeight * sizeof(ui16) );
+		return;
+	}
+	for ( int i = 0; i < m_nHeight; i++ )
+		pColumn[i] = pTemplate[i] == Background ? clr : pTemplate[i];
+}
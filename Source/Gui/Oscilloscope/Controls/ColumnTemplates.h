@@ -0,0 +1,55 @@
+#ifndef __COLUMNTEMPLATES_H__
+#define __COLUMNTEMPLATES_H__
+
+#include <Source/HwLayer/Types.h>
+
+// Background of the graph columns (grid, axis and dots) has only a few
+// distinct variants. The variants are built once for the given key (the grid
+// settings) and every column is then a copy of its variant. The templates of
+// all graphs share one pool, a graph that does not fit clears the pool and
+// the other graphs build their templates again when they are painted
+class CColumnTemplates
+{
+public:
+	enum {
+#ifdef _ARM
+		// the application RAM has no room for the pool, the graphs build
+		// every column again
+		PoolSize = 0,
+#else
+		PoolSize = 1800,
+#endif
+		MaxVariants = 8,
+		Background = 0x0101
+	};
+
+private:
+	static ui16* const m_pPool;
+	static int m_nPoolUsed;
+	static int m_nPoolGeneration;
+
+	ui8* m_pIndex;
+	ui16* m_pTemplates;
+	int m_nGeneration;
+	ui32 m_nKey;
+	int m_nWidth;
+	int m_nHeight;
+	int m_nVariants;
+	bool m_bValid;
+
+public:
+	CColumnTemplates();
+
+	bool IsValid(ui32 nKey) const;
+	// reserves the pool for nWidth columns, nHeight pixels each, the
+	// templates stay invalid when the pool is too small
+	void Begin(ui32 nKey, int nWidth, int nHeight);
+	// column n drawn over the Background colour, identical columns share the
+	// template. Returns false when there are too many variants
+	bool Add(int n, const ui16* pColumn);
+	void End();
+	// template of column n, the Background colour is replaced by clr
+	void Get(ui16* pColumn, int n, ui16 clr) const;
+};
+
+#endif
@@ -3,12 +3,40 @@
 
 CWndOscGraph::CWndOscGraph()
 {
-	ClearAverage();
-	m_bPersistReset = false;
 	m_bNeedRedraw = true;
+	m_nLabelWidth = 0;
+	InvalidateColumns();
+}
+
+// one step of FNV-1a over a 32 bit value
+static inline ui32 _Hash( ui32 nHash, int nValue )
+{
+	return ( nHash ^ (ui32)nValue ) * 16777619u;
 }
 
 void CWndOscGraph::_PrepareColumn( ui16 *column, ui16 n, ui16 clr )
+{
+	// the templates follow the grid settings
+	ui32 nKey = (NATIVEENUM)Settings.Disp.Grid | ( (NATIVEENUM)Settings.Disp.Axis << 8 );
+	if ( !m_templates.IsValid( nKey ) )
+	{
+		ui16 arrColumn[DivsY*BlkY];
+		m_templates.Begin( nKey, MaxX, DivsY*BlkY );
+		for ( int i = 0; i < MaxX && m_templates.IsValid( nKey ); i++ )
+		{
+			_BuildColumn( arrColumn, i, CColumnTemplates::Background );
+			if ( !m_templates.Add( i, arrColumn ) )
+				break;
+		}
+		m_templates.End();
+	}
+	if ( m_templates.IsValid( nKey ) )
+		m_templates.Get( column, n, clr );
+	else
+		_BuildColumn( column, n, clr );
+}
+
+void CWndOscGraph::_BuildColumn( ui16 *column, ui16 n, ui16 clr )
 {
 	for (ui16 y=0; y<DivsY*BlkY; y++)
 		column[y] = clr;
@@ -100,6 +128,15 @@ ui16 CWndOscGraph::_Interpolate( ui16 clrA, ui16 clrB )
 	return RGB565RGB(ar, ag, ab);
 }
 
+// nLevel/256 of the color
+ui16 CWndOscGraph::_Dim( ui16 clr, int nLevel )
+{
+	int r = Get565R(clr) * nLevel >> 8;
+	int g = Get565G(clr) * nLevel >> 8;
+	int b = Get565B(clr) * nLevel >> 8;
+	return RGB565RGB(r, g, b);
+}
+
 /*virtual*/ void CWndOscGraph::Create(CWnd *pParent, ui16 dwFlags) 
 {
 	CWndGraph::Create( pParent, dwFlags | CWnd::WsListener );
@@ -113,99 +150,107 @@ ui16 CWndOscGraph::_Interpolate( ui16 clrA, ui16 clrB )
 		CCoreOscilloscope::UpdateConstants();
 		return;
 	}
+	if ( pSender == NULL && code == WmBroadcast && data == ToWord('r', 'l') )
+	{
+		if ( !IsVisible() )
+			return;
+		if ( Settings.Disp.Axes != CSettings::Display::_TY )
+		{
+			Invalidate();
+			return;
+		}
+		// repaint only the columns appended by the roll mode
+		int nEnd = CCoreRoll::GetColumn();
+		int nBegin = nEnd - CCoreRoll::GetNew();
+		if ( nBegin < 0 )
+		{
+			OnPaintTY( nBegin + CCoreRoll::Width, CCoreRoll::Width );
+			nBegin = 0;
+		}
+		OnPaintTY( nBegin, nEnd );
+		return;
+	}
 	if ( pSender == this && code == ToWord('S', 'H') && data == 1 )
 	{
 		m_bNeedRedraw = true;
+		InvalidateColumns();
 	}
 }
 
 /*virtual*/ void CWndOscGraph::OnPaint()
 {
+	CPerf::Begin( CPerf::Paint );
 	if ( Settings.Disp.Axes == CSettings::Display::_TY )
 		OnPaintTY();
 	else
 		OnPaintXY();
+	CPerf::End( CPerf::Paint );
+	CPerf::CountPaint();
 }
 
 void CWndOscGraph::OnPaintXY()
 {
-	if ( CWnd::GetOverlay().IsValid() )
-	{
-		return;
-	}
+	InvalidateColumns();
 
 	// input channels
 	ui8 bEnabled1 = Settings.CH1.Enabled == CSettings::AnalogChannel::_YES;
 	ui8 bEnabled2 = Settings.CH2.Enabled == CSettings::AnalogChannel::_YES;
 	ui16 clrPoint = _Interpolate( Settings.CH1.u16Color, Settings.CH2.u16Color );
 
-	// calibration
-	CSettings::Calibrator::FastCalc calCh1, calCh2;
-	Settings.CH1Calib.Prepare( &Settings.CH1, calCh1 );
-	Settings.CH2Calib.Prepare( &Settings.CH2, calCh2 );
-
-	// range
-	int nMaxIndex = BIOS::ADC::GetCount();
-	int nIndex = Settings.Time.Shift;
-	int nColMax = m_rcClient.Width(); 
-
 	//if ( m_bNeedRedraw ) // does not work reliably
 	{
 		CRect rc = m_rcClient;
 		rc.Inflate( 1, 1, 1, 1 );
 		BIOS::LCD::Rectangle( rc, RGB565(b0b0b0) );
 	}
-
-	if ( Settings.Disp.Persist == CSettings::Display::_PerNo || m_bPersistReset || m_bNeedRedraw )
-		BIOS::LCD::Bar( m_rcClient, 0x0101 );
-
-	m_bPersistReset = false;
 	m_bNeedRedraw = false;
 
 	if ( !bEnabled1 || !bEnabled2 ) 
 	{
+		BIOS::LCD::Bar( m_rcClient, 0x0101 );
 		BIOS::LCD::Print( m_rcClient.left, m_rcClient.top, RGB565(ffffff), RGBTRANS, (char*)"Enable both channels" );
 		return;
 	}
 
-	
-	for (ui16 x=0; x<nColMax; x++, nIndex++)
+	// the density of the counters is shown by the phosphor palette, without
+	// the decay it dims the trace color
+	ui16 arrColors[CCorePhosphor::Colors];
+	bool bPhosphor = Settings.Disp.Persist == CSettings::Display::_PerPhosphor;
+	for ( int i = 0; i < CCorePhosphor::Colors; i++ )
+		arrColors[i] = bPhosphor ? CCorePhosphor::GetColor( i * 256 / CCorePhosphor::Colors ) :
+			_Dim( clrPoint, 64 + i * 192 / (CCorePhosphor::Colors - 1) );
+
+	// the square of the counters is placed BlkX pixels from the left edge, the
+	// whole client area is painted with one transfer per column. It stays
+	// empty while another engine holds the counters
+	bool bShown = CCorePhosphor::IsShown();
+	ui16 column[CWndGraph::DivsY*CWndGraph::BlkY];
+	for ( int x = 0; x < MaxX; x++ )
 	{
-		ui32 ui32Sample = nIndex < nMaxIndex ?  BIOS::ADC::GetAt(nIndex) : 0;
-		
-		int nSampleY2 = 0, nSampleY1 = 0;
-
-		if ( bEnabled1 )
+		int nCol = x - BlkX;
+		if ( nCol < 0 || nCol >= CCorePhosphor::GraphHeight || !bShown )
 		{
-			si16 ch1 = (ui8)((ui32Sample) & 0xff);
-			ch1 = Settings.CH1Calib.Correct( calCh1, ch1 );
-			if ( ch1 < 0 ) 
-				ch1 = 0;
-			if ( ch1 > 255 ) 
-				ch1 = 255;
-			nSampleY1 = (ch1*(DivsY*BlkY))>>8;
-		}
-		if ( bEnabled2 )
+			for ( int y = 0; y < DivsY*BlkY; y++ )
+				column[y] = 0x0101;
+		} else
 		{
-			si16 ch2 = (ui8)((ui32Sample>>8) & 0xff);
-			ch2 = Settings.CH2Calib.Correct( calCh2, ch2 );
-			if ( ch2 < 0 ) 
-				ch2 = 0;
-			if ( ch2 > 255 ) 
-				ch2 = 255;
-			nSampleY2 = (ch2*(DivsY*BlkY))>>8;
+			const ui8* pCells = CCorePhosphor::GetColumnXY( nCol );
+			for ( int y = 0; y < DivsY*BlkY; y++ )
+			{
+				int nCount = pCells[y / CCorePhosphor::ScaleXY];
+				column[y] = nCount ? arrColors[nCount * CCorePhosphor::Colors >> 8] : 0x0101;
+			}
 		}
-		if ( Settings.Disp.Axes == CSettings::Display::_XY )
-			BIOS::LCD::PutPixel( m_rcClient.left + nSampleY1 + BlkX, m_rcClient.bottom - nSampleY2, clrPoint );
-		else
-			BIOS::LCD::PutPixel( m_rcClient.left + nSampleY2 + BlkX, m_rcClient.bottom - nSampleY1, clrPoint );
+		BIOS::LCD::BlitColumns( CRect( m_rcClient.left + x, m_rcClient.top, m_rcClient.left + x + 1, m_rcClient.bottom ),
+			column, DivsY*BlkY );
 	}
 }
 
-void CWndOscGraph::OnPaintTY()
+void CWndOscGraph::OnPaintTY(int nBegin, int nEnd)
 {
 	ui16 column[CWndGraph::DivsY*CWndGraph::BlkY];
-	if ( !CWnd::GetOverlay().IsValid() /*&& m_bNeedRedraw*/ )
+	bool bWhole = nBegin == 0 && nEnd >= MaxX;
+	if ( bWhole /*&& m_bNeedRedraw*/ )
 	{
 		CRect rc = m_rcClient;
 		rc.Inflate( 1, 1, 1, 1 );
@@ -221,6 +266,10 @@ void CWndOscGraph::OnPaintTY()
 	ui8 en2 = Settings.CH2.Enabled == CSettings::AnalogChannel::_YES;
 	ui8 en3 = Settings.CH3.Enabled == CSettings::DigitalChannel::_YES;
 	ui8 en4 = Settings.CH4.Enabled == CSettings::DigitalChannel::_YES;
+	// the phosphor takes the place of the analog traces
+	bool bPhosphor = CCorePhosphor::IsShown();
+	if ( bPhosphor )
+		en1 = en2 = false;
 
 	ui16 clrShade1 = 0, clrShade2 = 0, clrShade12 = 0;
 
@@ -229,14 +278,10 @@ void CWndOscGraph::OnPaintTY()
 	if (!bTrigger)
 		nTriggerTime = -1;
 
-	int nCut = CWnd::GetOverlay().IsValid() ? CWnd::GetOverlay().left - m_rcClient.left : m_rcClient.Width();
-	int nCutTop = CWnd::GetOverlay().IsValid() ? CWnd::GetOverlay().bottom - m_rcClient.top : 0;
-	if ( nCutTop >= m_rcClient.Height() )
-		nCut = m_rcClient.Width();
-	int nFirstTop = CWnd::GetOverlay().IsValid() ? CWnd::GetOverlay().top - m_rcClient.top : 0;
-
-	int nMax = m_rcClient.Width(); 
-	if ( CWnd::GetOverlay().IsValid() && CWnd::GetOverlay().left - m_rcClient.left <= 0 )
+	// the LCD skips the parts hidden by modal windows
+	const CClipRegion& rgnClip = CWnd::GetClipRegion();
+	int nMax = min( nEnd, (int)m_rcClient.Width() ); 
+	if ( rgnClip.IsHidden( m_rcClient ) )
 		return;
 
 	CSettings::Calibrator::FastCalc Ch1fast, Ch2fast;
@@ -247,14 +292,18 @@ void CWndOscGraph::OnPaintTY()
 	int nMaxIndex = BIOS::ADC::GetCount();
 	bool bLines = Settings.Disp.Draw != CSettings::Display::_Points;
 	bool bFill = Settings.Disp.Draw == CSettings::Display::_Fill;
-	bool bAverage1 = Settings.Disp.Average == CSettings::Display::_AvgCh1;
-	bool bAverage2 = Settings.Disp.Average == CSettings::Display::_AvgCh2;
+	// the envelope of peak detect is drawn as a vertical span in every column
+	bool bPeak = CCorePeak::IsActive();
+	// high resolution and averaged samples are scaled from their 16 bit value
+	bool bHiRes = CCoreHiRes::IsActive();
+	bool bFine = CCaptureStore::HasFine();
 	int nPrev1 = -1, nPrev2 = -1, nPrevm = -1, nPrev3 = -1, nPrev4 = -1;
 
 	int nMarkerT1 = -1, nMarkerT2 = -1, nMarkerY1 = -1, nMarkerY2 = -1;
 	bool bAreaT = false;
 	bool enmath = false;
 	int nSampleY2 = 0, nSampleY1 = 0;
+	int nLowY1 = 0, nHighY1 = 0, nLowY2 = 0, nHighY2 = 0;
 
 	int nY3High = 0;
 	int nY3Low = 0;
@@ -306,9 +355,26 @@ void CWndOscGraph::OnPaintTY()
 	}
 
 	ui16 clrm = Settings.Math.uiColor;
-	int nIndex = Settings.Time.Shift;
 
-	for (ui16 x=0; x<nMax; x++, nIndex++)
+	// state shared by all columns, the grid depends only on the position of
+	// the column. Mask test paints over the columns and the phosphor changes
+	// with every acquisition, these are never skipped
+	bool bSkip = !bUsingMask && !bPhosphor;
+	ui32 nFrameSignature = 2166136261u;
+	const int arrFrame[] = { clr1, clr2, clr3, clr4, clrm, en1, en2, en3, en4, enmath, bLines, bFill,
+		(NATIVEENUM)Settings.Disp.Grid, (NATIVEENUM)Settings.Disp.Axis, bTrigger ? Settings.Trig.nLevel : -1,
+		nMarkerY1, nMarkerY2, Settings.MarkY1.u16Color, Settings.MarkY2.u16Color };
+	for ( int i = 0; i < (int)COUNT(arrFrame); i++ )
+		nFrameSignature = _Hash( nFrameSignature, arrFrame[i] );
+
+	// when painting a part of the window, the preceding column is evaluated
+	// but not drawn, so the lines continue from the previous sample
+	int nFirst = max( nBegin-1, 0 );
+	int nIndex = Settings.Time.Shift + nFirst;
+	const ui8* pCH1 = CCaptureStore::GetAnalog( CCaptureStore::CH1 );
+	const ui8* pCH2 = CCaptureStore::GetAnalog( CCaptureStore::CH2 );
+
+	for (ui16 x=nFirst; x<nMax; x++, nIndex++)
 	{
 		int clrCol = (nTriggerTime != x) ? 0x0101 : 0x00;
 
@@ -319,6 +385,107 @@ void CWndOscGraph::OnPaintTY()
 		if ( nMarkerT2 == nIndex )
 			clrCol = Settings.MarkT2.u16Color;
 			
+		bool bValid = nIndex < nMaxIndex;
+
+		if ( en1 )
+		{
+			si16 ch1 = bValid ? pCH1[nIndex] : 0;
+			ch1 = Settings.CH1Calib.Correct( Ch1fast, ch1 );
+			UTILS.Clamp<si16>( ch1, 0, 255 );
+
+			nSampleY1 = (ch1*(DivsY*BlkY))>>8;
+			if ( bFine && bValid )
+			{
+				int nFine = Settings.CH1Calib.CorrectFine( Ch1fast, CCaptureStore::GetFineAt( CCaptureStore::CH1, nIndex ) );
+				UTILS.Clamp<int>( nFine, 0, 0xffff );
+				nSampleY1 = (nFine*(DivsY*BlkY))>>16;
+			}
+			nLowY1 = nHighY1 = nSampleY1;
+
+			int nMin, nMax;
+			if ( bPeak && bValid && CCorePeak::GetEnvelope( CCaptureStore::CH1, nIndex, nMin, nMax ) )
+			{
+				nMin = Settings.CH1Calib.Correct( Ch1fast, nMin );
+				nMax = Settings.CH1Calib.Correct( Ch1fast, nMax );
+				UTILS.Clamp<int>( nMin, 0, 255 );
+				UTILS.Clamp<int>( nMax, 0, 255 );
+				nLowY1 = (nMin*(DivsY*BlkY))>>8;
+				nHighY1 = (nMax*(DivsY*BlkY))>>8;
+			}
+		}
+		if ( en2 )
+		{
+			si16 ch2 = bValid ? pCH2[nIndex] : 0;
+			ch2 = Settings.CH2Calib.Correct( Ch2fast, ch2 );
+			UTILS.Clamp<si16>( ch2, 0, 255 );
+
+			nSampleY2 = (ch2*(DivsY*BlkY))>>8;
+			if ( bFine && bValid )
+			{
+				int nFine = Settings.CH2Calib.CorrectFine( Ch2fast, CCaptureStore::GetFineAt( CCaptureStore::CH2, nIndex ) );
+				UTILS.Clamp<int>( nFine, 0, 0xffff );
+				nSampleY2 = (nFine*(DivsY*BlkY))>>16;
+			}
+			nLowY2 = nHighY2 = nSampleY2;
+
+			int nMin, nMax;
+			if ( bPeak && bValid && CCorePeak::GetEnvelope( CCaptureStore::CH2, nIndex, nMin, nMax ) )
+			{
+				nMin = Settings.CH2Calib.Correct( Ch2fast, nMin );
+				nMax = Settings.CH2Calib.Correct( Ch2fast, nMax );
+				UTILS.Clamp<int>( nMin, 0, 255 );
+				UTILS.Clamp<int>( nMax, 0, 255 );
+				nLowY2 = (nMin*(DivsY*BlkY))>>8;
+				nHighY2 = (nMax*(DivsY*BlkY))>>8;
+			}
+		}
+		if ( en3 )
+		{
+			nSampleY3 = bValid && CCaptureStore::GetDigitalAt( CCaptureStore::CH3, nIndex ) ? nY3High : nY3Low;		
+		}
+		if ( en4 )
+		{
+			nSampleY4 = bValid && CCaptureStore::GetDigitalAt( CCaptureStore::CH4, nIndex ) ? nY4High : nY4Low;
+		}
+
+		int nSampleYm = 0;
+		if ( enmath )
+		{
+			int chm = MathCalc( bValid ? CCaptureStore::GetAt( nIndex ) : 0 );
+			UTILS.Clamp<int>( chm, 0, 255 );
+			nSampleYm = (chm*(DivsY*BlkY))>>8;
+		}
+
+		// the column is painted only when something drawn into it has changed
+		ui32 nSignature = _Hash( nFrameSignature, clrCol );
+		if ( en1 )
+			nSignature = _Hash( _Hash( _Hash( _Hash( nSignature, nSampleY1 ), nLowY1 ), nHighY1 ), nPrev1 );
+		if ( en2 )
+			nSignature = _Hash( _Hash( _Hash( _Hash( nSignature, nSampleY2 ), nLowY2 ), nHighY2 ), nPrev2 );
+		if ( en3 )
+			nSignature = _Hash( _Hash( nSignature, nSampleY3 ), nPrev3 );
+		if ( en4 )
+			nSignature = _Hash( _Hash( nSignature, nSampleY4 ), nPrev4 );
+		if ( enmath )
+			nSignature = _Hash( _Hash( nSignature, nSampleYm ), nPrevm );
+		ui32 nColumnSignature = nSignature;
+		if ( nColumnSignature == 0 )
+			nColumnSignature = 1;
+
+		if ( x < nBegin || ( bSkip && x >= m_nLabelWidth && m_arrSignature[x] == nColumnSignature ) )
+		{
+			// the lines of the next column start here
+			if ( bLines )
+			{
+				nPrev1 = nSampleY1;
+				nPrev2 = nSampleY2;
+				nPrev3 = nSampleY3;
+				nPrev4 = nSampleY4;
+				nPrevm = nSampleYm;
+			}
+			continue;
+		}
+
 		_PrepareColumn( column, x, clrCol );
 		
 		if ( bUsingMask )
@@ -371,48 +538,15 @@ void CWndOscGraph::OnPaintTY()
 			}
 		}
 
-		BIOS::ADC::SSample Sample;
-		Sample.nValue = nIndex < nMaxIndex ? BIOS::ADC::GetAt(nIndex) : 0;
-
-		if ( en1 )
-		{
-			si16 ch1 = Sample.CH1;
-			ch1 = Settings.CH1Calib.Correct( Ch1fast, ch1 );
-			UTILS.Clamp<si16>( ch1, 0, 255 );
-
-			if ( bAverage1 )
-			{
-				ui16& nMemory = m_arrAverageBuf[x];
-				int nNew = (nMemory*7 + (ch1<<8)*1)/8;  // 7:1
-				nMemory = (ui16)nNew;
-				ch1 = nMemory >> 8;
-			}
-
-			nSampleY1 = (ch1*(DivsY*BlkY))>>8;
-		}
-		if ( en2 )
+		if ( bPhosphor )
 		{
-			si16 ch2 = Sample.CH2;
-			ch2 = Settings.CH2Calib.Correct( Ch2fast, ch2 );
-			UTILS.Clamp<si16>( ch2, 0, 255 );
-
-			if ( bAverage2 )
+			const ui8* pCells = CCorePhosphor::GetColumn( x );
+			for ( int y = 0; y < DivsY*BlkY; y++ )
 			{
-				ui16& nMemory = m_arrAverageBuf[x];
-				int nNew = (nMemory*7 + (ch2<<8)*1)/8;
-				nMemory = (ui16)nNew;
-				ch2 = nMemory >> 8;
+				int nCount = pCells[y / CCorePhosphor::ScaleY];
+				if ( nCount )
+					column[y] = CCorePhosphor::GetColor( nCount );
 			}
-
-			nSampleY2 = (ch2*(DivsY*BlkY))>>8;
-		}
-		if ( en3 )
-		{
-			nSampleY3 = Sample.CH3 ? nY3High : nY3Low;		
-		}
-		if ( en4 )
-		{
-			nSampleY4 = Sample.CH4 ? nY4High : nY4Low;
 		}
 
 		if ( bFill )
@@ -480,13 +614,16 @@ void CWndOscGraph::OnPaintTY()
 		if ( en2 )
 		{
 			if ( !bLines )
-				column[nSampleY2] = clr2;
+			{
+				for ( int _y = nLowY2; _y <= nHighY2; _y++)
+					column[_y] = clr2;
+			}
 			else
 			{
 				if ( nPrev2 == -1 )
 					nPrev2 = nSampleY2;
-				int nBottom = min(nSampleY2, nPrev2);
-				int nTop = max(nSampleY2, nPrev2);
+				int nBottom = min(nLowY2, nPrev2);
+				int nTop = max(nHighY2, nPrev2);
 				for ( int _y = nBottom; _y <= nTop; _y++)
 					column[_y] = clr2;
 				nPrev2 = nSampleY2;
@@ -496,13 +633,16 @@ void CWndOscGraph::OnPaintTY()
 		if ( en1 )
 		{
 			if ( !bLines )
-				column[nSampleY1] = clr1;
+			{
+				for ( int _y = nLowY1; _y <= nHighY1; _y++)
+					column[_y] = clr1;
+			}
 			else
 			{
 				if ( nPrev1 == -1 )
 					nPrev1 = nSampleY1;
-				int nBottom = min(nSampleY1, nPrev1);
-				int nTop = max(nSampleY1, nPrev1);
+				int nBottom = min(nLowY1, nPrev1);
+				int nTop = max(nHighY1, nPrev1);
 				for ( int _y = nBottom; _y <= nTop; _y++)
 					column[_y] = clr1;
 				nPrev1 = nSampleY1;
@@ -511,10 +651,7 @@ void CWndOscGraph::OnPaintTY()
 
 		if ( enmath )
 		{
-			int chm = MathCalc( Sample.nValue );
-			UTILS.Clamp<int>( chm, 0, 255 );
-			ui16 y = (chm*(DivsY*BlkY))>>8;
-
+			ui16 y = nSampleYm;
 			if ( !bLines )
 				column[y] = clrm;
 			else
@@ -537,16 +674,55 @@ void CWndOscGraph::OnPaintTY()
 		if ( nMarkerY2 > 0 )
 			column[nMarkerY2] = Settings.MarkY2.u16Color;
  
-		if ( x <= nCut )
-			BIOS::LCD::Buffer( m_rcClient.left + x, m_rcClient.top, column, DivsY*BlkY );
-		else
-		{
-			if ( nCutTop > 0 )
-				BIOS::LCD::Buffer( m_rcClient.left + x, m_rcClient.top + nCutTop, column, DivsY*BlkY - nCutTop);
-			if ( nFirstTop > 0 )
-				BIOS::LCD::Buffer( m_rcClient.left + x, m_rcClient.top, column + DivsY*BlkY - nFirstTop, nFirstTop );
-		}
+		CRect rcColumn( m_rcClient.left + x, m_rcClient.top, m_rcClient.left + x + 1, m_rcClient.bottom );
+		BIOS::LCD::BlitColumns( rcColumn, column, DivsY*BlkY );
+		// a partially hidden column is painted completely once uncovered
+		m_arrSignature[x] = ( bSkip && rgnClip.IsVisible( rcColumn ) ) ? nColumnSignature : 0;
+	}
+
+	// the labels are printed over the columns, next time these are painted again
+	int nLabelWidth = 0;
+	if ( bWhole && Settings.Trig.Sync == CSettings::Trigger::_Seq && CCoreSequence::IsComplete() && 
+		!CWnd::GetOverlay().IsValid() )
+	{
+		int nSegment = Settings.Trig.nSegment;
+		UTILS.Clamp<int>( nSegment, 0, CCoreSequence::GetCount()-1 );
+		nLabelWidth = max( nLabelWidth, 2 + 8*BIOS::LCD::Printf( m_rcClient.left+2, m_rcClient.top+2, RGB565(ffffff), 0x0101, 
+			"Seg %d/%d +%d ms", nSegment+1, CCoreSequence::GetCount(), CCoreSequence::GetTimestamp(nSegment) ) );
 	}
+	if ( bWhole && Settings.Trig.Sync == CSettings::Trigger::_Ets && !CWnd::GetOverlay().IsValid() )
+	{
+		nLabelWidth = max( nLabelWidth, 2 + 8*BIOS::LCD::Printf( m_rcClient.left+2, m_rcClient.top+2, RGB565(ffffff), 0x0101, 
+			"ETS x%d %d%% %d acq", (int)CCoreEts::Factor, CCoreEts::GetProgress(), CCoreEts::GetCount() ) );
+	}
+	if ( bWhole && bPeak && !CWnd::GetOverlay().IsValid() )
+	{
+		nLabelWidth = max( nLabelWidth, 2 + 8*BIOS::LCD::Printf( m_rcClient.left+2, m_rcClient.top+2, RGB565(ffffff), 0x0101, 
+			"Peak x%d", (int)CCorePeak::Decimation ) );
+	}
+	if ( bWhole && bHiRes && !CWnd::GetOverlay().IsValid() )
+	{
+		int nBits10 = CCoreHiRes::GetEffectiveBits10();
+		nLabelWidth = max( nLabelWidth, 2 + 8*BIOS::LCD::Printf( m_rcClient.left+2, m_rcClient.top+2, RGB565(ffffff), 0x0101, 
+			"High res x%d %d.%d bit", (int)CCorePeak::Decimation, nBits10 / 10, nBits10 % 10 ) );
+	}
+	if ( bWhole && CCoreAverage::IsActive() && !CWnd::GetOverlay().IsValid() )
+	{
+		nLabelWidth = max( nLabelWidth, 2 + 8*BIOS::LCD::Printf( m_rcClient.left+2, m_rcClient.top+2 + ( bPeak || bHiRes ? 14 : 0 ), RGB565(ffffff), 0x0101, 
+			"Avg %d/%d", CCoreAverage::GetCount(), 2 << (NATIVEENUM)Settings.Disp.AverageCount ) );
+	}
+	if ( bWhole && CCoreRecorder::IsRecording() && !CWnd::GetOverlay().IsValid() )
+	{
+		nLabelWidth = max( nLabelWidth, 2 + 8*BIOS::LCD::Printf( m_rcClient.left+2, m_rcClient.bottom-16, RGB565(ff4040), 0x0101, 
+			"Rec %d", CCoreRecorder::GetFrames() ) );
+	}
+	if ( bWhole && CCoreRecorder::IsReplaying() && !CWnd::GetOverlay().IsValid() )
+	{
+		nLabelWidth = max( nLabelWidth, 2 + 8*BIOS::LCD::Printf( m_rcClient.left+2, m_rcClient.bottom-16, RGB565(40ff40), 0x0101, 
+			"Play %d/%d", CCoreRecorder::GetFrame()+1, CCoreRecorder::GetFrames() ) );
+	}
+	if ( bWhole )
+		m_nLabelWidth = nLabelWidth;
 }
 
 void CWndOscGraph::SetupSelection( bool& bSelection, int& nMarkerT1, int& nMarkerT2 )
@@ -600,15 +776,14 @@ void CWndOscGraph::SetupMarkers( CSettings::Calibrator::FastCalc& Ch1fast, CSett
 	}
 	if ( Settings.MarkY1.Mode == CSettings::Marker::_Auto )
 	{
-		nMarkerY1 = BIOS::ADC::GetAt( Settings.MarkT1.nValue );
 		if ( Settings.MarkY1.Source == CSettings::Marker::_CH1 )
 		{
-			nMarkerY1 = (ui8)((nMarkerY1) & 0xff);
+			nMarkerY1 = CCaptureStore::GetAnalogAt( CCaptureStore::CH1, Settings.MarkT1.nValue );
 			Settings.MarkY1.nValue = nMarkerY1;
 			nMarkerY1 = Settings.CH1Calib.Correct( Ch1fast, nMarkerY1 );
 		} else
 		{
-			nMarkerY1 = (ui8)((nMarkerY1>>8) & 0xff);
+			nMarkerY1 = CCaptureStore::GetAnalogAt( CCaptureStore::CH2, Settings.MarkT1.nValue );
 			Settings.MarkY1.nValue = nMarkerY1;
 			nMarkerY1 = Settings.CH2Calib.Correct( Ch2fast, nMarkerY1 );
 		}
@@ -616,15 +791,14 @@ void CWndOscGraph::SetupMarkers( CSettings::Calibrator::FastCalc& Ch1fast, CSett
 	}
 	if ( Settings.MarkY2.Mode == CSettings::Marker::_Auto )
 	{
-		nMarkerY2 = BIOS::ADC::GetAt( Settings.MarkT2.nValue );
 		if ( Settings.MarkY2.Source == CSettings::Marker::_CH1 )
 		{
-			nMarkerY2 = (ui8)((nMarkerY2) & 0xff);
+			nMarkerY2 = CCaptureStore::GetAnalogAt( CCaptureStore::CH1, Settings.MarkT2.nValue );
 			Settings.MarkY2.nValue = nMarkerY2;
 			nMarkerY2 = Settings.CH1Calib.Correct( Ch1fast, nMarkerY2 );
 		} else
 		{
-			nMarkerY2 = (ui8)((nMarkerY2>>8) & 0xff);
+			nMarkerY2 = CCaptureStore::GetAnalogAt( CCaptureStore::CH2, Settings.MarkT2.nValue );
 			Settings.MarkY2.nValue = nMarkerY2;
 			nMarkerY2 = Settings.CH2Calib.Correct( Ch2fast, nMarkerY2 );
 		}
@@ -645,12 +819,23 @@ void CWndOscGraph::GetCurrentRange(int& nBegin, int& nEnd)
 
 // Move to better place
 
-void CWndOscGraph::ClearAverage()
+void CWndOscGraph::ClearPersist()
 {
-	memset(m_arrAverageBuf, 0, sizeof(m_arrAverageBuf));
+	CCorePhosphor::Reset();
 }
-void CWndOscGraph::ClearPersist()
+
+void CWndOscGraph::InvalidateColumns()
 {
-	m_bPersistReset = true;
+	memset( m_arrSignature, 0, sizeof(m_arrSignature) );
 }
 
+void CWndOscGraph::InvalidateColumns(const CRect& rc)
+{
+	if ( !rc.Intersects( m_rcClient ) )
+		return;
+	int nBegin = max( rc.left - m_rcClient.left, 0 );
+	int nEnd = min( rc.right - m_rcClient.left, (int)MaxX );
+	for ( int x = nBegin; x < nEnd; x++ )
+		m_arrSignature[x] = 0;
+}
+
@@ -2,17 +2,24 @@
 #define __CWNDOSCGRAPH_H__
 
 #include "GraphBase.h"
+#include "ColumnTemplates.h"
 #include <Source/Core/Settings.h>
 #include <Source/Gui/Oscilloscope/Math/ChannelMath.h>
 
 class CWndOscGraph : public CWndGraph, public CMathChannel
 {
-	ui16			m_arrAverageBuf[DivsX*BlkX];
-	bool			m_bPersistReset;
 	bool			m_bNeedRedraw;
+	// FNV-1a signature of every painted column, 0 forces a repaint
+	ui32			m_arrSignature[MaxX];
+	// columns covered by the text labels of the last paint
+	int				m_nLabelWidth;
 
+	CColumnTemplates m_templates;
+
+	void			_BuildColumn( ui16 *column, ui16 n, ui16 clr );
 	void			_PrepareColumn( ui16 *column, ui16 n, ui16 clr );
 	ui16			_Interpolate( ui16 clrA, ui16 clrB );
+	ui16			_Dim( ui16 clr, int nLevel );
 
 public:
 	CWndOscGraph();
@@ -23,10 +30,12 @@ public:
 		int& nMarkerT1, int& nMarkerT2, int& nMarkerY1, int& nMarkerY2 );
 	void			SetupSelection( bool& bSelection, int& nMarkerT1, int& nMarkerT2 );
 	void			GetCurrentRange(int& nBegin, int& nEnd);
-	void			ClearAverage();
 	void			ClearPersist();
+	// the screen under the graph was painted over, next paint redraws every column
+	void			InvalidateColumns();
+	void			InvalidateColumns(const CRect& rc);
 
-	void			OnPaintTY();
+	void			OnPaintTY(int nBegin = 0, int nEnd = MaxX);
 	void			OnPaintXY();
 };
 
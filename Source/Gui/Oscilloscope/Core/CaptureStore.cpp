@@ -0,0 +1,380 @@
+#include "CaptureStore.h"
+
+#ifdef _ARM
+/*static*/ CCaptureStore::TWord* const CCaptureStore::m_arrAnalog[2] = {
+	(TWord*)&BIOS::ADC::GetAt( AtCH1 ), (TWord*)&BIOS::ADC::GetAt( AtCH2 ) };
+/*static*/ ui16* const CCaptureStore::m_arrFine[2] = {
+	(ui16*)&BIOS::ADC::GetAt( AtFine ), (ui16*)&BIOS::ADC::GetAt( AtFine ) + FineLength };
+/*static*/ CCaptureStore::TWord* const CCaptureStore::m_arrDigital[2] = {
+	(TWord*)&BIOS::ADC::GetAt( AtDigital ), (TWord*)&BIOS::ADC::GetAt( AtDigital ) + DigitalWords };
+#else
+/*static*/ CCaptureStore::TWord CCaptureStore::m_arrAnalog[2][CCaptureStore::AnalogWords];
+/*static*/ ui16 CCaptureStore::m_arrFine[2][CCaptureStore::FineLength];
+/*static*/ CCaptureStore::TWord CCaptureStore::m_arrDigital[2][CCaptureStore::DigitalWords];
+#endif
+/*static*/ int CCaptureStore::m_nFineFirst = 0;
+/*static*/ int CCaptureStore::m_nFineCount = 0;
+/*static*/ int CCaptureStore::m_nValidFirst = 0;
+/*static*/ int CCaptureStore::m_nValidCount = CCaptureStore::Length;
+
+/*static*/ void CCaptureStore::Update()
+{
+	const BIOS::ADC::TSample* pSrc = &BIOS::ADC::GetAt(0);
+	TWord* pCH1 = m_arrAnalog[CH1];
+	TWord* pCH2 = m_arrAnalog[CH2];
+	m_nFineCount = 0;
+	SetValid( 0, Length );
+
+#ifdef _ARM
+	// the samples are packed into 16 bit pairs of CH1 and CH2 in the upper
+	// half of the buffer first and split into the planes then. Both passes
+	// go backwards, the pair j lands on the sample Length/2 + j/2 and the
+	// plane words of the sample j on Length/4 + j/4 and Length*3/4 + j/4,
+	// all of these samples were read already. The bit planes wait in the
+	// scratch bytes of the CH1 quarter during the first pass and in the low
+	// bytes of the raw samples during the second one
+	BIOS::ADC::TSample* pRaw = &BIOS::ADC::GetAt(0);
+	ui8* pStash = (ui8*)&BIOS::ADC::GetAt( AtCH1 ) + 3;
+	TWord* pPairs = (TWord*)&BIOS::ADC::GetAt( Length/2 );
+	for ( int i = DigitalWords-1; i >= 0; i-- )
+	{
+		TWord nCH3 = 0, nCH4 = 0;
+		for ( int j = (i << 5) + 30; j >= (i << 5); j -= 2 )
+		{
+			TWord s0 = (TWord)pSrc[j], s1 = (TWord)pSrc[j+1];
+			pPairs[j >> 1] = (s0 & 0xffff) | (s1 << 16);
+			int b = j & 31;
+			nCH3 |= ( ((s0 >> 16) & 1) | ((s1 >> 15) & 2) ) << b;
+			nCH4 |= ( ((s0 >> 17) & 1) | ((s1 >> 16) & 2) ) << b;
+		}
+		// byte k of the bit planes goes to the sample AtCH1 + k
+		for ( int b = 0; b < 4; b++ )
+		{
+			pStash[(i*4 + b)*4] = (ui8)(nCH3 >> (b*8));
+			pStash[(DigitalWords*4 + i*4 + b)*4] = (ui8)(nCH4 >> (b*8));
+		}
+	}
+	// two bytes per raw sample, the scratch byte stays
+	for ( int i = 0; i < DigitalWords*4; i++ )
+		pRaw[i] = (pRaw[i] & 0xff000000) | pStash[i*8] | (pStash[i*8 + 4] << 8);
+
+	for ( int i = AnalogWords-1; i >= 0; i-- )
+	{
+		TWord p0 = pPairs[2*i], p1 = pPairs[2*i+1];
+		pCH1[i] = (p0 & 0xff) | ((p0 >> 8) & 0xff00) | ((p1 & 0xff) << 16) | ((p1 << 8) & 0xff000000);
+		pCH2[i] = ((p0 >> 8) & 0xff) | ((p0 >> 16) & 0xff00) | ((p1 & 0xff00) << 8) | (p1 & 0xff000000);
+	}
+
+	TWord* pDigital = m_arrDigital[CH3];
+	for ( int i = 0; i < DigitalWords*2; i++ )
+		pDigital[i] = ((TWord)pRaw[2*i] & 0xffff) | ((TWord)pRaw[2*i+1] << 16);
+#else
+	// four samples give one word of each analog plane, the byte order
+	// matches the little endian ui8 view returned by GetAnalog
+	for ( int i = 0; i < AnalogWords; i++, pSrc += 4 )
+	{
+		TWord s0 = (TWord)pSrc[0], s1 = (TWord)pSrc[1], s2 = (TWord)pSrc[2], s3 = (TWord)pSrc[3];
+		pCH1[i] = (s0 & 0xff) | ((s1 & 0xff) << 8) | ((s2 & 0xff) << 16) | ((s3 & 0xff) << 24);
+		pCH2[i] = ((s0 >> 8) & 0xff) | (s1 & 0xff00) | ((s2 & 0xff00) << 8) | ((s3 & 0xff00) << 16);
+	}
+
+	pSrc = &BIOS::ADC::GetAt(0);
+	for ( int i = 0; i < DigitalWords; i++ )
+	{
+		TWord nCH3 = 0, nCH4 = 0;
+		for ( int b = 0; b < 32; b++ )
+		{
+			TWord nSample = (TWord)*pSrc++;
+			nCH3 |= ((nSample >> 16) & 1) << b;
+			nCH4 |= ((nSample >> 17) & 1) << b;
+		}
+		m_arrDigital[CH3][i] = nCH3;
+		m_arrDigital[CH4][i] = nCH4;
+	}
+#endif
+}
+
+/*static*/ void CCaptureStore::Clear()
+{
+	memset( m_arrAnalog[CH1], 0, Length );
+	memset( m_arrAnalog[CH2], 0, Length );
+	memset( m_arrDigital[CH3], 0, DigitalWords*sizeof(TWord) );
+	memset( m_arrDigital[CH4], 0, DigitalWords*sizeof(TWord) );
+	m_nFineCount = 0;
+	SetValid( 0, 0 );
+}
+
+/*static*/ void CCaptureStore::Load(int nSource, int nTarget, int nCount)
+{
+	Clear();
+
+	ui8* pCH1 = (ui8*)m_arrAnalog[CH1];
+	ui8* pCH2 = (ui8*)m_arrAnalog[CH2];
+	for ( int i = 0; i < nCount; i++ )
+	{
+		TWord nSample = (TWord)BIOS::ADC::GetAt( nSource + i );
+		int j = nTarget + i;
+		pCH1[j] = (ui8)nSample;
+		pCH2[j] = (ui8)(nSample >> 8);
+		m_arrDigital[CH3][j >> 5] |= ((nSample >> 16) & 1) << (j & 31);
+		m_arrDigital[CH4][j >> 5] |= ((nSample >> 17) & 1) << (j & 31);
+	}
+	SetValid( nTarget, nCount );
+}
+
+/*static*/ void CCaptureStore::Set(int i, TWord nSample)
+{
+	_ASSERT( i >= 0 && i < Length );
+	((ui8*)m_arrAnalog[CH1])[i] = (ui8)nSample;
+	((ui8*)m_arrAnalog[CH2])[i] = (ui8)(nSample >> 8);
+
+	TWord nMask = 1 << (i & 31);
+	if ( nSample & (1<<16) )
+		m_arrDigital[CH3][i >> 5] |= nMask;
+	else
+		m_arrDigital[CH3][i >> 5] &= ~nMask;
+	if ( nSample & (1<<17) )
+		m_arrDigital[CH4][i >> 5] |= nMask;
+	else
+		m_arrDigital[CH4][i >> 5] &= ~nMask;
+}
+
+/*static*/ void CCaptureStore::Align(int nOffset)
+{
+	if ( nOffset <= 0 )
+		return;
+	if ( nOffset > Length )
+		nOffset = Length;
+	m_nFineFirst -= nOffset;
+	// the head of the record moves out, the tail is cleared
+	int nValidEnd = min( m_nValidFirst + m_nValidCount, Length - nOffset );
+	m_nValidFirst = max( m_nValidFirst - nOffset, 0 );
+	m_nValidCount = max( nValidEnd - m_nValidFirst, 0 );
+
+	for ( int c = 0; c < 2; c++ )
+	{
+		ui8* pPlane = (ui8*)m_arrAnalog[c];
+		memmove( pPlane, pPlane + nOffset, Length - nOffset );
+		memset( pPlane + Length - nOffset, 0, nOffset );
+
+		// bit planes are shifted by whole words first, the rest is funneled
+		// from the following word
+		TWord* pBits = m_arrDigital[c];
+		int nWords = nOffset >> 5;
+		int nBits = nOffset & 31;
+		for ( int i = 0; i < DigitalWords; i++ )
+		{
+			TWord nLow = ( i + nWords < DigitalWords ) ? pBits[i + nWords] : 0;
+			TWord nHigh = ( i + nWords + 1 < DigitalWords ) ? pBits[i + nWords + 1] : 0;
+			pBits[i] = nBits ? ( (nLow >> nBits) | (nHigh << (32 - nBits)) ) : nLow;
+		}
+	}
+}
+
+/*static*/ void CCaptureStore::SetValid(int nFirst, int nCount)
+{
+	m_nValidFirst = nFirst;
+	m_nValidCount = nCount;
+}
+
+/*static*/ bool CCaptureStore::ClipValid(int& nBegin, int& nEnd)
+{
+	nBegin = max( nBegin, m_nValidFirst );
+	nEnd = min( nEnd, m_nValidFirst + m_nValidCount );
+	return nBegin < nEnd;
+}
+
+/*static*/ void CCaptureStore::Crop(int nFirst, int nCount)
+{
+	int nEnd = nFirst + nCount;
+	for ( int c = 0; c < 2; c++ )
+	{
+		ui8* pPlane = (ui8*)m_arrAnalog[c];
+		memset( pPlane, 0, nFirst );
+		memset( pPlane + nEnd, 0, Length - nEnd );
+
+		for ( int i = 0; i < DigitalWords; i++ )
+		{
+			// bits [nLow, nHigh) of the word are kept
+			int nLow = nFirst - (i << 5), nHigh = nEnd - (i << 5);
+			TWord nMask = nHigh >= 32 ? ~(TWord)0 : nHigh <= 0 ? 0 : ((TWord)1 << nHigh) - 1;
+			if ( nLow > 0 )
+				nMask &= nLow >= 32 ? 0 : ~( ((TWord)1 << nLow) - 1 );
+			m_arrDigital[c][i] &= nMask;
+		}
+	}
+	SetValid( nFirst, nCount );
+}
+
+/*static*/ int CCaptureStore::GetReduceSplit(int nFirst, int nStep)
+{
+	// ascending from the split the record sample is written below the
+	// interval of the next one and above the intervals left for the
+	// descending pass, which write at or above their own interval
+	return nStep > 1 ? nFirst / (nStep - 1) : Length;
+}
+
+/*static*/ ui8* CCaptureStore::GetScratch()
+{
+#ifdef _ARM
+	m_nFineCount = 0;
+#endif
+	return (ui8*)&BIOS::ADC::GetAt( AtScratch );
+}
+
+// per byte unsigned a >= b, returns 0x01 in each lane where it holds. The
+// subtraction of the low seven bits can not borrow into the next lane, the
+// top bits are compared separately
+/*static*/ CCaptureStore::TWord CCaptureStore::_GreaterEqualBytes(TWord a, TWord b)
+{
+	const TWord H = 0x80808080;
+	TWord nDiff = (a | H) - (b & ~H);
+	return ((((a & ~b) | (~(a ^ b) & nDiff)) & H) >> 7);
+}
+
+/*static*/ CCaptureStore::TWord CCaptureStore::_MaxBytes(TWord a, TWord b)
+{
+	TWord nMask = _GreaterEqualBytes(a, b) * 0xff;
+	return (a & nMask) | (b & ~nMask);
+}
+
+/*static*/ CCaptureStore::TWord CCaptureStore::_MinBytes(TWord a, TWord b)
+{
+	TWord nMask = _GreaterEqualBytes(a, b) * 0xff;
+	return (b & nMask) | (a & ~nMask);
+}
+
+/*static*/ void CCaptureStore::GetMinMax(int nChannel, int nBegin, int nEnd, int& nMin, int& nMax)
+{
+	const ui8* pData = GetAnalog(nChannel);
+	nMin = 255;
+	nMax = 0;
+
+	// unaligned head and tail go sample by sample
+	for ( ; nBegin < nEnd && (nBegin & 3); nBegin++ )
+	{
+		nMin = min(nMin, (int)pData[nBegin]);
+		nMax = max(nMax, (int)pData[nBegin]);
+	}
+	for ( ; nEnd > nBegin && (nEnd & 3); nEnd-- )
+	{
+		nMin = min(nMin, (int)pData[nEnd-1]);
+		nMax = max(nMax, (int)pData[nEnd-1]);
+	}
+	if ( nBegin >= nEnd )
+		return;
+
+	const TWord* pWords = m_arrAnalog[nChannel];
+	TWord nWordMin = 0xffffffff, nWordMax = 0;
+	for ( int i = nBegin >> 2; i < nEnd >> 2; i++ )
+	{
+		nWordMin = _MinBytes( nWordMin, pWords[i] );
+		nWordMax = _MaxBytes( nWordMax, pWords[i] );
+	}
+	for ( int i = 0; i < 32; i += 8 )
+	{
+		nMin = min(nMin, (int)((nWordMin >> i) & 0xff));
+		nMax = max(nMax, (int)((nWordMax >> i) & 0xff));
+	}
+}
+
+/*static*/ ui32 CCaptureStore::GetSum(int nChannel, int nBegin, int nEnd)
+{
+	const ui8* pData = GetAnalog(nChannel);
+	ui32 nSum = 0;
+
+	for ( ; nBegin < nEnd && (nBegin & 3); nBegin++ )
+		nSum += pData[nBegin];
+	for ( ; nEnd > nBegin && (nEnd & 3); nEnd-- )
+		nSum += pData[nEnd-1];
+	if ( nBegin >= nEnd )
+		return nSum;
+
+	// two 16 bit lanes collect two bytes each per word, 128 words
+	// (at most 128*510) fit into a lane before it has to be flushed
+	const TWord* pWords = m_arrAnalog[nChannel];
+	int nWordEnd = nEnd >> 2;
+	for ( int i = nBegin >> 2; i < nWordEnd; )
+	{
+		int nBlockEnd = min(i + 128, nWordEnd);
+		TWord nLanes = 0;
+		for ( ; i < nBlockEnd; i++ )
+			nLanes += (pWords[i] & 0x00ff00ff) + ((pWords[i] >> 8) & 0x00ff00ff);
+		nSum += (nLanes & 0xffff) + (nLanes >> 16);
+	}
+	return nSum;
+}
+
+/*static*/ int CCaptureStore::GetAbove(int nChannel, int nBegin, int nEnd, int nThreshold)
+{
+	if ( nThreshold < 0 )
+		return max(nEnd - nBegin, 0);
+	if ( nThreshold >= 255 )
+		return 0;
+
+	const ui8* pData = GetAnalog(nChannel);
+	int nAbove = 0;
+
+	for ( ; nBegin < nEnd && (nBegin & 3); nBegin++ )
+		nAbove += pData[nBegin] > nThreshold;
+	for ( ; nEnd > nBegin && (nEnd & 3); nEnd-- )
+		nAbove += pData[nEnd-1] > nThreshold;
+	if ( nBegin >= nEnd )
+		return nAbove;
+
+	// each lane counts up to 255 words before it has to be flushed
+	const TWord* pWords = m_arrAnalog[nChannel];
+	TWord nLevel = (nThreshold + 1) * 0x01010101;
+	int nWordEnd = nEnd >> 2;
+	for ( int i = nBegin >> 2; i < nWordEnd; )
+	{
+		int nBlockEnd = min(i + 255, nWordEnd);
+		TWord nLanes = 0;
+		for ( ; i < nBlockEnd; i++ )
+			nLanes += _GreaterEqualBytes( pWords[i], nLevel );
+		nAbove += (nLanes & 0xff) + ((nLanes >> 8) & 0xff) + ((nLanes >> 16) & 0xff) + ((nLanes >> 24) & 0xff);
+	}
+	return nAbove;
+}
+
+/*static*/ void CCaptureStore::GetHistogram(int nChannel, int nBegin, int nEnd, ui16* pHistogram)
+{
+	const ui8* pData = GetAnalog(nChannel);
+	memset( pHistogram, 0, 256*sizeof(ui16) );
+
+	for ( ; nBegin < nEnd && (nBegin & 3); nBegin++ )
+		pHistogram[pData[nBegin]]++;
+	for ( ; nEnd > nBegin && (nEnd & 3); nEnd-- )
+		pHistogram[pData[nEnd-1]]++;
+
+	const TWord* pWords = m_arrAnalog[nChannel];
+	for ( int i = nBegin >> 2; i < nEnd >> 2; i++ )
+	{
+		TWord nWord = pWords[i];
+		pHistogram[nWord & 0xff]++;
+		pHistogram[(nWord >> 8) & 0xff]++;
+		pHistogram[(nWord >> 16) & 0xff]++;
+		pHistogram[(nWord >> 24) & 0xff]++;
+	}
+}
+
+/*static*/ int CCaptureStore::GetOnes(int nChannel, int nBegin, int nEnd)
+{
+	const TWord* pWords = m_arrDigital[nChannel];
+	int nOnes = 0;
+	while ( nBegin < nEnd )
+	{
+		int nBit = nBegin & 31;
+		int nBits = min(32 - nBit, nEnd - nBegin);
+		TWord nWord = pWords[nBegin >> 5] >> nBit;
+		if ( nBits < 32 )
+			nWord &= (1UL << nBits) - 1;
+
+		nWord = nWord - ((nWord >> 1) & 0x55555555);
+		nWord = (nWord & 0x33333333) + ((nWord >> 2) & 0x33333333);
+		nWord = (nWord + (nWord >> 4)) & 0x0f0f0f0f;
+		nOnes += ((nWord * 0x01010101) >> 24) & 0xff;
+		nBegin += nBits;
+	}
+	return nOnes;
+}
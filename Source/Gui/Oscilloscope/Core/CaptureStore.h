@@ -0,0 +1,157 @@
+#ifndef __CAPTURESTORE_H__
+#define __CAPTURESTORE_H__
+
+#include <Source/HwLayer/Types.h>
+#include <Source/HwLayer/Bios.h>
+
+// Structure of arrays copy of the ADC buffer. CH1 and CH2 are stored as
+// contiguous ui8 planes, CH3 and CH4 as bit planes (32 samples per word, LSB
+// first), so a pass over one channel touches only its own data and can be
+// processed one word (four samples) at a time.
+// On ARM the application RAM has no room for a copy of the capture, Update
+// moves the planes into the ADC buffer itself and the samples can be read
+// only through the store afterwards
+class CCaptureStore
+{
+	friend class CSoftTrigger;
+	friend class CCoreHiRes;
+	friend class CCoreAverage;
+
+public:
+	// plane word, exactly 32 bits wide (ui32 is wider on LP64 hosts)
+	typedef unsigned int TWord;
+
+	enum {
+		Length = BIOS::ADC::Length,
+		AnalogWords = Length/4,
+		DigitalWords = Length/32,
+#ifdef _ARM
+		// the application RAM has no room for 16 bit copies of the capture
+		FineLength = 512,
+		// the scratch bytes of the samples [0, AtCH1) keep the mask and the
+		// FIR filter, the sequence stores its segments there (RawLength
+		// samples, Update uses their low bytes as a work area and is not
+		// called in the sequence mode). CH1 and CH2 take a quarter of the
+		// buffer each, the quarter between them holds the fine plane and
+		// ends with the bit planes
+		AtCH1 = Length/4,
+		AtCH2 = Length*3/4,
+		AtFine = Length/2,
+		AtDigital = AtCH2 - 2*DigitalWords,
+		RawLength = AtCH1,
+		// ScratchLength bytes of the ADC buffer free after Update
+		ScratchLength = (AtDigital - Length/2)*4,
+#else
+		FineLength = Length,
+		RawLength = Length,
+		ScratchLength = Length,
+#endif
+		AtScratch = Length/2
+	};
+
+	enum EChannel {
+		CH1 = 0,
+		CH2 = 1,
+		CH3 = 0,
+		CH4 = 1
+	};
+
+private:
+#ifdef _ARM
+	static TWord* const m_arrAnalog[2];
+	static ui16* const m_arrFine[2];
+	static TWord* const m_arrDigital[2];
+#else
+	static TWord m_arrAnalog[2][AnalogWords];
+	// 16 bit samples of the high resolution acquisition, 8 bit fraction
+	static ui16 m_arrFine[2][FineLength];
+	static TWord m_arrDigital[2][DigitalWords];
+#endif
+	static int m_nFineFirst;
+	static int m_nFineCount;
+	// samples holding data, the acquisitions building a shorter record leave
+	// the rest of the planes cleared
+	static int m_nValidFirst;
+	static int m_nValidCount;
+
+public:
+	// de-interleave the BIOS::ADC buffer, call after every Copy or after
+	// the buffer was modified in place (resampling, import). On ARM it is
+	// done in place, only once for the samples of a Copy
+	static void Update();
+	static void Clear();
+	// clear the planes and load nCount samples of the ADC buffer starting at
+	// nSource to position nTarget, used for replaying acquisition segments
+	static void Load(int nSource, int nTarget, int nCount);
+	// store single packed sample, used by the roll mode and the
+	// sequence replay
+	static void Set(int i, TWord nSample);
+	// move the capture nOffset samples towards the beginning and clear the
+	// tail, aligns the display on a software trigger candidate
+	static void Align(int nOffset);
+	// marks [nFirst, nFirst+nCount) as the record after Clear and Set
+	static void SetValid(int nFirst, int nCount);
+	// clears the planes around [nFirst, nFirst+nCount) and marks it as the record
+	static void Crop(int nFirst, int nCount);
+	// the record sample nFirst+i made of the samples [i*nStep, (i+1)*nStep)
+	// can be written in place when the samples from the returned index are
+	// processed in ascending order first and the ones below it in descending
+	// order, no sample is overwritten before it was read
+	static int GetReduceSplit(int nFirst, int nStep);
+	// work area of ScratchLength bytes in the ADC buffer, on ARM it overlaps
+	// the fine plane and the high resolution record is dropped
+	static ui8* GetScratch();
+	// restricts [nBegin, nEnd) to the record, false when nothing is left
+	static bool ClipValid(int& nBegin, int& nEnd);
+
+	// span accessors
+	static const ui8* GetAnalog(int nChannel, int nBegin = 0)
+	{
+		return ((const ui8*)m_arrAnalog[nChannel]) + nBegin;
+	}
+	static const TWord* GetDigital(int nChannel)
+	{
+		return m_arrDigital[nChannel];
+	}
+	static ui8 GetAnalogAt(int nChannel, int i)
+	{
+		return ((const ui8*)m_arrAnalog[nChannel])[i];
+	}
+	static ui8 GetDigitalAt(int nChannel, int i)
+	{
+		return (ui8)((m_arrDigital[nChannel][i >> 5] >> (i & 31)) & 1);
+	}
+	// sample in the packed BIOS::ADC::SSample format without the scratch byte
+	static ui32 GetAt(int i)
+	{
+		return GetAnalogAt(CH1, i) | (GetAnalogAt(CH2, i) << 8) |
+			(GetDigitalAt(CH3, i) << 16) | (GetDigitalAt(CH4, i) << 17);
+	}
+	// analog sample with 8 bit fraction, outside of the high resolution record
+	// it is the 8 bit sample scaled up
+	static int GetFineAt(int nChannel, int i)
+	{
+		int j = i - m_nFineFirst;
+		if ( j >= 0 && j < m_nFineCount )
+			return m_arrFine[nChannel][j];
+		return GetAnalogAt(nChannel, i) << 8;
+	}
+	static bool HasFine()
+	{
+		return m_nFineCount > 0;
+	}
+
+	// word at a time reductions over [nBegin, nEnd)
+	static void GetMinMax(int nChannel, int nBegin, int nEnd, int& nMin, int& nMax);
+	static ui32 GetSum(int nChannel, int nBegin, int nEnd);
+	static int GetAbove(int nChannel, int nBegin, int nEnd, int nThreshold);
+	static void GetHistogram(int nChannel, int nBegin, int nEnd, ui16* pHistogram);
+	static int GetOnes(int nChannel, int nBegin, int nEnd);
+
+private:
+	static TWord _GreaterEqualBytes(TWord a, TWord b);
+	static TWord _MaxBytes(TWord a, TWord b);
+	static TWord _MinBytes(TWord a, TWord b);
+};
+
+#endif
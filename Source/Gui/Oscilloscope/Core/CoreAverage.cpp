@@ -0,0 +1,162 @@
+#include "CoreAverage.h"
+#include <Source/Core/Settings.h>
+#include <Source/Core/Utils.h>
+
+/*static*/ int CCoreAverage::m_nFirst = -1;
+/*static*/ int CCoreAverage::m_nCount = 0;
+/*static*/ bool CCoreAverage::m_bWide = false;
+
+/*static*/ void CCoreAverage::Reset()
+{
+	// the buffer may hold the state of another engine
+	if ( CCoreShared::IsOwner( CCoreShared::Average ) )
+		memset( &_GetAccum(), 0, sizeof(TAccumulators) );
+	m_nCount = 0;
+}
+
+/*static*/ CCoreAverage::TAccumulators& CCoreAverage::_GetAccum()
+{
+	return *(TAccumulators*)CCoreShared::GetBuffer();
+}
+
+/*static*/ bool CCoreAverage::IsActive()
+{
+	return Settings.Disp.Average != CSettings::Display::_AvgOff;
+}
+
+/*static*/ void CCoreAverage::Process()
+{
+	if ( !IsActive() )
+		return;
+	bool bOwner = CCoreShared::IsOwner( CCoreShared::Average );
+	if ( !CCoreShared::Claim( CCoreShared::Average ) )
+		return;
+
+	// a high resolution record is averaged in place, otherwise the window
+	// starts at the display position when the accumulators are shorter than
+	// the capture
+	int nFirst = 0;
+	int nLength = Length;
+	if ( CCaptureStore::HasFine() )
+	{
+		nFirst = CCaptureStore::m_nFineFirst;
+		nLength = min( CCaptureStore::m_nFineCount, (int)Length );
+	} else
+	if ( (int)Length < (int)CCaptureStore::Length )
+	{
+		nFirst = Settings.Time.Shift;
+		UTILS.Clamp<int>( nFirst, 0, CCaptureStore::Length - Length );
+	}
+	bool bLinear = Settings.Disp.Average == CSettings::Display::_AvgLinear;
+	bool b32 = Settings.Disp.Accumulator == CSettings::Display::_Acc32 ||
+		( bLinear && CCaptureStore::HasFine() );
+	if ( nFirst != m_nFirst || b32 != m_bWide || !bOwner )
+	{
+		Reset();
+		m_nFirst = nFirst;
+		m_bWide = b32;
+	}
+
+	int nSweeps = 2 << (NATIVEENUM)Settings.Disp.AverageCount;
+	if ( bLinear )
+	{
+		// when the count is reached the sums are halved, the older half
+		// of the sweeps fades out
+		bool bDrop = m_nCount >= nSweeps;
+		if ( bDrop )
+			m_nCount = nSweeps / 2;
+		m_nCount++;
+		for ( int nChannel = CCaptureStore::CH1; nChannel <= CCaptureStore::CH2; nChannel++ )
+			if ( b32 )
+				_Linear32( nChannel, bDrop ? 1 : 0, nLength );
+			else
+				_Linear16( nChannel, bDrop ? 1 : 0, nLength );
+	} else
+	{
+		int nShift = (NATIVEENUM)Settings.Disp.AverageCount + 1;
+		m_nCount = min( m_nCount + 1, nSweeps );
+		for ( int nChannel = CCaptureStore::CH1; nChannel <= CCaptureStore::CH2; nChannel++ )
+			if ( b32 )
+				_Exponential32( nChannel, nShift, nLength );
+			else
+				_Exponential16( nChannel, nShift, nLength );
+	}
+
+	CCaptureStore::m_nFineFirst = nFirst;
+	CCaptureStore::m_nFineCount = nLength;
+}
+
+// the fine plane is indexed from m_nFirst like the accumulators
+/*static*/ ui8* CCoreAverage::_GetPlane(int nChannel)
+{
+	return (ui8*)CCaptureStore::m_arrAnalog[nChannel] + m_nFirst;
+}
+
+/*static*/ void CCoreAverage::_Store(int nChannel, int i, int nResult)
+{
+	CCaptureStore::m_arrFine[nChannel][i] = (ui16)nResult;
+	_GetPlane( nChannel )[i] = (ui8)min( (nResult + 0x80) >> 8, 255 );
+}
+
+/*static*/ void CCoreAverage::_Linear16(int nChannel, int nDrop, int nLength)
+{
+	const ui8* pPlane = _GetPlane( nChannel );
+	ui16* pAccum = _GetAccum().arr16[nChannel];
+	int nCount = m_nCount;
+	for ( int i = 0; i < nLength; i++ )
+	{
+		// sum of at most 256 samples of 8 bits
+		int nSum = ( pAccum[i] >> nDrop ) + pPlane[i];
+		pAccum[i] = (ui16)nSum;
+		_Store( nChannel, i, ( (nSum << 8) + nCount/2 ) / nCount );
+	}
+}
+
+/*static*/ void CCoreAverage::_Linear32(int nChannel, int nDrop, int nLength)
+{
+	const ui8* pPlane = _GetPlane( nChannel );
+	const ui16* pFine = CCaptureStore::m_arrFine[nChannel];
+	bool bFine = CCaptureStore::HasFine();
+	CCaptureStore::TWord* pAccum = _GetAccum().arr32[nChannel];
+	CCaptureStore::TWord nCount = m_nCount;
+	for ( int i = 0; i < nLength; i++ )
+	{
+		CCaptureStore::TWord nSum = ( pAccum[i] >> nDrop ) + ( bFine ? pFine[i] : pPlane[i] << 8 );
+		pAccum[i] = nSum;
+		_Store( nChannel, i, (int)( ( nSum + nCount/2 ) / nCount ) );
+	}
+}
+
+/*static*/ void CCoreAverage::_Exponential16(int nChannel, int nShift, int nLength)
+{
+	const ui8* pPlane = _GetPlane( nChannel );
+	const ui16* pFine = CCaptureStore::m_arrFine[nChannel];
+	bool bFine = CCaptureStore::HasFine();
+	ui16* pAccum = _GetAccum().arr16[nChannel];
+	int nRound = 1 << (nShift - 1);
+	for ( int i = 0; i < nLength; i++ )
+	{
+		int nInput = bFine ? pFine[i] : pPlane[i] << 8;
+		int nAverage = m_nCount == 1 ? nInput : pAccum[i] + ( ( nInput - pAccum[i] + nRound ) >> nShift );
+		pAccum[i] = (ui16)nAverage;
+		_Store( nChannel, i, nAverage );
+	}
+}
+
+/*static*/ void CCoreAverage::_Exponential32(int nChannel, int nShift, int nLength)
+{
+	const ui8* pPlane = _GetPlane( nChannel );
+	const ui16* pFine = CCaptureStore::m_arrFine[nChannel];
+	bool bFine = CCaptureStore::HasFine();
+	CCaptureStore::TWord* pAccum = _GetAccum().arr32[nChannel];
+	int nRound = 1 << (nShift - 1);
+	for ( int i = 0; i < nLength; i++ )
+	{
+		// 16 bit fraction, small differences are not lost in the long averages
+		int nInput = ( bFine ? pFine[i] : pPlane[i] << 8 ) << 8;
+		int nAccum = (int)pAccum[i];
+		int nAverage = m_nCount == 1 ? nInput : nAccum + ( ( nInput - nAccum + nRound ) >> nShift );
+		pAccum[i] = (CCaptureStore::TWord)nAverage;
+		_Store( nChannel, i, ( nAverage + 0x80 ) >> 8 );
+	}
+}
@@ -0,0 +1,65 @@
+#ifndef __COREAVERAGE_H__
+#define __COREAVERAGE_H__
+
+#include <Source/HwLayer/Types.h>
+#include "CaptureStore.h"
+#include "CoreShared.h"
+
+// Multi sweep averaging of CH1 and CH2 after the acquisition. Linear mode
+// keeps the sum of the last sweeps (the older half is dropped when the count
+// is reached), exponential mode moves the average by 1/N of the difference.
+// The result is written into the capture store, rounded into the 8 bit
+// planes and with 8 bit fraction into the fine plane, so the display, the
+// measurements, the spectrum and the export work on the average. The
+// accumulators are kept in the buffer of CCoreShared
+class CCoreAverage
+{
+public:
+	enum {
+		// accumulators cover the whole capture unless the RAM is short
+#ifdef _ARM
+		Length = 192
+#else
+		Length = CCaptureStore::FineLength
+#endif
+	};
+
+	// 16 bit accumulators hold sums of 8 bit samples or the exponential
+	// average with 8 bit fraction, 32 bit ones sums of the 16 bit samples
+	// or the exponential average with 16 bit fraction. The linear sums of a
+	// high resolution record are always 32 bit, 16 bit sums have no room
+	// for the fraction
+	union TAccumulators
+	{
+		ui16 arr16[2][Length];
+		CCaptureStore::TWord arr32[2][Length];
+	};
+
+private:
+	static int m_nFirst;
+	static int m_nCount;
+	static bool m_bWide;
+
+public:
+	static void Reset();
+	static bool IsActive();
+	// adds the capture store to the average and replaces it with the result
+	static void Process();
+	// number of sweeps in the average
+	static int GetCount()
+	{
+		return m_nCount;
+	}
+
+private:
+	static TAccumulators& _GetAccum();
+	static ui8* _GetPlane(int nChannel);
+	static void _Store(int nChannel, int i, int nResult);
+	// nDrop 1 halves the sums before the sweep is added
+	static void _Linear16(int nChannel, int nDrop, int nLength);
+	static void _Linear32(int nChannel, int nDrop, int nLength);
+	static void _Exponential16(int nChannel, int nShift, int nLength);
+	static void _Exponential32(int nChannel, int nShift, int nLength);
+};
+
+#endif
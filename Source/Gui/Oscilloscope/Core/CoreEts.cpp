@@ -0,0 +1,174 @@
+#include "CoreEts.h"
+#include "CoreShared.h"
+#include "CaptureStore.h"
+#include "SoftTrigger.h"
+#include "Resampler.h"
+#include <Source/Core/Settings.h>
+#include <Source/Core/Utils.h>
+
+/*static*/ int CCoreEts::m_nFirst = 0;
+/*static*/ int CCoreEts::m_nAcquired = 0;
+
+/*static*/ bool CCoreEts::IsActive()
+{
+	return Settings.Trig.Sync == CSettings::Trigger::_Ets;
+}
+
+/*static*/ void CCoreEts::Reset()
+{
+	// the buffer may hold the state of another engine
+	if ( CCoreShared::IsOwner( CCoreShared::Ets ) )
+		memset( &_GetBins(), 0, sizeof(TBins) );
+	m_nAcquired = 0;
+}
+
+/*static*/ CCoreEts::TBins& CCoreEts::_GetBins()
+{
+	return *(TBins*)CCoreShared::GetBuffer();
+}
+
+/*static*/ int CCoreEts::FindCrossing(const ui8* pPlane, int nBegin, int nEnd, int nLevel, int nPolarity)
+{
+	CSoftTrigger::TSource src = { pPlane, NULL, NULL };
+	int nState = -1;
+	int nEdge = CSoftTrigger::FindEdge( src, nBegin, nEnd, nLevel - CSoftTrigger::Hysteresis,
+		nLevel + CSoftTrigger::Hysteresis, nPolarity, nState );
+	if ( nEdge <= 0 )
+		return -1;
+
+	// the comparator fires past the hysteresis, go back to the pair of samples
+	// around the level and interpolate between them
+	int j = nEdge;
+	if ( nPolarity > 0 )
+	{
+		while ( j > 1 && pPlane[j-1] >= nLevel )
+			j--;
+	} else
+	{
+		while ( j > 1 && pPlane[j-1] <= nLevel )
+			j--;
+	}
+	int nA = pPlane[j-1];
+	int nB = pPlane[j];
+	int nFraction = ( nA != nB ) ? ( (nLevel - nA) << 8 ) / (nB - nA) : 0;
+	UTILS.Clamp<int>( nFraction, 0, 256 );
+	return ( (j-1) << 8 ) + nFraction;
+}
+
+/*static*/ bool CCoreEts::Acquire()
+{
+	bool bOwner = CCoreShared::IsOwner( CCoreShared::Ets );
+	if ( !CCoreShared::Claim( CCoreShared::Ets ) )
+		return false;
+	int nFirst = Settings.Time.Shift;
+	UTILS.Clamp<int>( nFirst, 0, CCaptureStore::Length - Bins );
+	if ( nFirst != m_nFirst || !bOwner )
+	{
+		Reset();
+		m_nFirst = nFirst;
+	}
+
+	// the store holds the capture before resampling, one raw sample spans
+	// Unity/nCorrection display samples
+	int nCorrection = Settings.Time.pfValueResolutionCorrection[ (NATIVEENUM)Settings.Time.Resolution ];
+	int nTrigger = Settings.Trig.nPosition * nCorrection / CResampler::Unity;
+	int nChannel = Settings.Trig.Source == CSettings::Trigger::_CH2 ? CCaptureStore::CH2 : CCaptureStore::CH1;
+
+	CSoftTrigger::TCondition cond;
+	CSoftTrigger::GetCondition( cond );
+	int nCrossing = FindCrossing( CCaptureStore::GetAnalog( nChannel ), max( nTrigger - Search, 1 ),
+		CCaptureStore::Length, Settings.Trig.nLevel, cond.nPolarity );
+	if ( nCrossing < 0 )
+		return false;
+
+	// the crossing lands on the trigger position, nStep is the distance of two
+	// raw samples in bins with 8 bit fraction
+	int nOrigin = Settings.Trig.nPosition - m_nFirst;
+	UTILS.Clamp<int>( nOrigin, 0, Bins-1 );
+	int nStep = ( (Factor * CResampler::Unity) << 8 ) / nCorrection;
+	int nBegin = (nCrossing >> 8) - ( (nOrigin << 8) / nStep ) - 1;
+	int nEnd = (nCrossing >> 8) + ( ((Bins - nOrigin) << 8) / nStep ) + 2;
+	UTILS.Clamp<int>( nBegin, 0, CCaptureStore::Length );
+	UTILS.Clamp<int>( nEnd, 0, CCaptureStore::Length );
+
+	const ui8* pCH1 = CCaptureStore::GetAnalog( CCaptureStore::CH1 );
+	const ui8* pCH2 = CCaptureStore::GetAnalog( CCaptureStore::CH2 );
+	TBins& bins = _GetBins();
+	for ( int i = nBegin; i < nEnd; i++ )
+	{
+		int nBin = nOrigin + ( ( ((i << 8) - nCrossing) * nStep + 0x8000 ) >> 16 );
+		if ( nBin < 0 || nBin >= Bins )
+			continue;
+
+		if ( bins.arrCount[nBin] == MaxCount )
+		{
+			// keep the bins adaptive, the older half of the samples is dropped
+			bins.arrSum[0][nBin] = (ui16)( bins.arrSum[0][nBin] * (MaxCount/2) / MaxCount );
+			bins.arrSum[1][nBin] = (ui16)( bins.arrSum[1][nBin] * (MaxCount/2) / MaxCount );
+			bins.arrCount[nBin] = MaxCount/2;
+		}
+		bins.arrSum[0][nBin] += pCH1[i];
+		bins.arrSum[1][nBin] += pCH2[i];
+		bins.arrCount[nBin]++;
+	}
+	m_nAcquired++;
+	return true;
+}
+
+/*static*/ void CCoreEts::Render()
+{
+	if ( !CCoreShared::IsOwner( CCoreShared::Ets ) )
+		return;
+	CCaptureStore::Clear();
+
+	const TBins& bins = _GetBins();
+	int nLast = -1;
+	int nLastCH1 = 0, nLastCH2 = 0;
+	for ( int i = 0; i < Bins; i++ )
+	{
+		int nCount = bins.arrCount[i];
+		if ( nCount == 0 )
+			continue;
+
+		int nCH1 = bins.arrSum[0][i] / nCount;
+		int nCH2 = bins.arrSum[1][i] / nCount;
+		if ( nLast < 0 )
+		{
+			nLastCH1 = nCH1;
+			nLastCH2 = nCH2;
+		}
+		// linear interpolation over the empty bins
+		for ( int j = nLast + 1; j < i; j++ )
+		{
+			int nSpan = i - nLast;
+			int nCH1j = nLastCH1 + (nCH1 - nLastCH1) * (j - nLast) / nSpan;
+			int nCH2j = nLastCH2 + (nCH2 - nLastCH2) * (j - nLast) / nSpan;
+			CCaptureStore::Set( m_nFirst + j, nCH1j | (nCH2j << 8) );
+		}
+		CCaptureStore::Set( m_nFirst + i, nCH1 | (nCH2 << 8) );
+		nLast = i;
+		nLastCH1 = nCH1;
+		nLastCH2 = nCH2;
+	}
+	if ( nLast < 0 )
+		return;
+	for ( int i = nLast + 1; i < Bins; i++ )
+		CCaptureStore::Set( m_nFirst + i, nLastCH1 | (nLastCH2 << 8) );
+	CCaptureStore::SetValid( m_nFirst, Bins );
+}
+
+/*static*/ int CCoreEts::GetProgress()
+{
+	if ( !CCoreShared::IsOwner( CCoreShared::Ets ) )
+		return 0;
+	int nFilled = 0;
+	for ( int i = 0; i < Bins; i++ )
+		if ( _GetBins().arrCount[i] )
+			nFilled++;
+	return nFilled * 100 / Bins;
+}
+
+/*static*/ int CCoreEts::GetCount()
+{
+	return m_nAcquired;
+}
@@ -0,0 +1,56 @@
+#ifndef __COREETS_H__
+#define __COREETS_H__
+
+#include <Source/HwLayer/Types.h>
+
+// Random interleaved equivalent time sampling for repetitive signals. Every
+// triggered capture is placed on a grid Factor times finer than the display
+// samples of the selected timebase by the sub-sample position of its own
+// trigger crossing, CH1 and CH2 are averaged per bin. The grid covers Bins
+// samples of the capture store starting at Time.Shift. The bins are kept in
+// the buffer of CCoreShared
+class CCoreEts
+{
+public:
+	enum {
+		Factor = 4,
+#ifdef _ARM
+		// one screen, the shared buffer is short
+		Bins = 300,
+#else
+		Bins = 512,
+#endif
+		MaxCount = 255,
+		// raw samples searched before the expected trigger position
+		Search = 16
+	};
+
+	struct TBins
+	{
+		ui16 arrSum[2][Bins];
+		ui8 arrCount[Bins];
+	};
+
+private:
+	static int m_nFirst;
+	static int m_nAcquired;
+
+public:
+	static bool IsActive();
+	static void Reset();
+	// bins the raw (not resampled) capture in the capture store, returns false
+	// when the trigger crossing was not found
+	static bool Acquire();
+	// writes the grid into the capture store, empty bins are interpolated
+	static void Render();
+	// percentage of filled bins
+	static int GetProgress();
+	static int GetCount();
+	// level crossing after nBegin with sub-sample precision, 8 bit fraction
+	static int FindCrossing(const ui8* pPlane, int nBegin, int nEnd, int nLevel, int nPolarity);
+
+private:
+	static TBins& _GetBins();
+};
+
+#endif
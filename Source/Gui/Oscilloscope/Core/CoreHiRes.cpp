@@ -0,0 +1,49 @@
+#include "CoreHiRes.h"
+#include "CorePeak.h"
+#include "CaptureStore.h"
+#include <Source/Core/Settings.h>
+
+/*static*/ bool CCoreHiRes::IsActive()
+{
+	return Settings.Time.Acquire == CSettings::TimeBase::_AcqHiRes && CCorePeak::IsDecimating();
+}
+
+/*static*/ void CCoreHiRes::Process()
+{
+	int nFirst, nCount;
+	CCorePeak::GetRecord( nFirst, nCount );
+	nCount = min( nCount, (int)CCaptureStore::FineLength );
+
+	// the reduced record is written over the planes
+	CCaptureStore::Update();
+	int nSplit = min( CCaptureStore::GetReduceSplit( nFirst, CCorePeak::Decimation ), nCount );
+	for ( int i = nSplit; i < nCount; i++ )
+		_Reduce( nFirst, i );
+	for ( int i = nSplit-1; i >= 0; i-- )
+		_Reduce( nFirst, i );
+	CCaptureStore::m_nFineFirst = nFirst;
+	CCaptureStore::m_nFineCount = nCount;
+	CCaptureStore::Crop( nFirst, nCount );
+}
+
+/*static*/ void CCoreHiRes::_Reduce(int nFirst, int i)
+{
+	const int N = CCorePeak::Decimation;
+	int nBegin = i * N;
+	int nFine1 = ( (int)CCaptureStore::GetSum( CCaptureStore::CH1, nBegin, nBegin + N ) * 256 + N/2 ) / N;
+	int nFine2 = ( (int)CCaptureStore::GetSum( CCaptureStore::CH2, nBegin, nBegin + N ) * 256 + N/2 ) / N;
+	CCaptureStore::m_arrFine[CCaptureStore::CH1][i] = (ui16)nFine1;
+	CCaptureStore::m_arrFine[CCaptureStore::CH2][i] = (ui16)nFine2;
+
+	int nCH1 = min( (nFine1 + 0x80) >> 8, 255 );
+	int nCH2 = min( (nFine2 + 0x80) >> 8, 255 );
+	CCaptureStore::Set( nFirst + i, nCH1 | (nCH2 << 8) | (CCaptureStore::GetAt( nBegin ) & 0x30000) );
+}
+
+/*static*/ int CCoreHiRes::GetEffectiveBits10()
+{
+	// log2(N)/2 in tenths of a bit for averaging N = 1..16 samples
+	static const ui8 arrGain10[] = { 0, 5, 8, 10, 12, 13, 14, 15, 16, 17, 17, 18, 19, 19, 20, 20 };
+	_ASSERT( CCorePeak::Decimation >= 1 && CCorePeak::Decimation <= (int)COUNT(arrGain10) );
+	return 80 + arrGain10[CCorePeak::Decimation - 1];
+}
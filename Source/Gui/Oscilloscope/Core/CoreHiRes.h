@@ -0,0 +1,25 @@
+#ifndef __COREHIRES_H__
+#define __COREHIRES_H__
+
+#include <Source/HwLayer/Types.h>
+
+// High resolution acquisition. The ADC runs CCorePeak::Decimation times
+// faster than the selected timebase like for peak detect, every interval is
+// averaged into a 16 bit sample with 8 bit fraction kept in the fine plane
+// of the capture store. Averaging N samples of uncorrelated noise adds
+// log2(N)/2 effective bits
+class CCoreHiRes
+{
+public:
+	static bool IsActive();
+	// reduces the full rate capture in the ADC buffer into the capture store
+	static void Process();
+	// effective resolution in tenths of a bit
+	static int GetEffectiveBits10();
+
+private:
+	// average of the interval i into the record sample nFirst+i
+	static void _Reduce(int nFirst, int i);
+};
+
+#endif
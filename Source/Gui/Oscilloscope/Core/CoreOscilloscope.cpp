@@ -23,7 +23,8 @@
 	ui8 nBRange = (ui8)(NATIVEENUM)Settings.CH2.Resolution;
 	ui16 nBPosition = Settings.CH2.u16Position;
 
-	float fTimePerDiv = CSettings::TimeBase::pfValueResolution[ (NATIVEENUM)Settings.Time.Resolution ];
+	// peak detect samples faster than the selected timebase
+	float fTimePerDiv = CSettings::TimeBase::pfValueResolution[ CCorePeak::GetResolution() ];
 	//ui16 nTimePsc = arrPsc[ (NATIVEENUM)Settings.Time.Resolution ];
 	//ui16 nTimeArr = arrArr[ (NATIVEENUM)Settings.Time.Resolution ];
 	
@@ -31,13 +32,19 @@
 	BIOS::ADC::Configure( nACouple, nARange, nAOffset, nBCouple, nBRange, nBPosition, fTimePerDiv );
 //	BIOS::ADC::ConfigureBuffer( arrLen[ (NATIVEENUM)Settings.Time.Resolution ] );
 	BIOS::ADC::Restart();
+	CCoreRoll::Reset();
+	CCoreEts::Reset();
+	CCoreAverage::Reset();
+	CCorePhosphor::Reset();
 
 	UpdateConstants();
 }
 
 /*static*/ void CCoreOscilloscope::ConfigureTrigger()
 {
-	if ( Settings.Trig.Sync == CSettings::Trigger::_None || Settings.Trig.Sync == CSettings::Trigger::_Scan )
+	// the software trigger picks the position in the capture by itself
+	if ( Settings.Trig.Sync == CSettings::Trigger::_None || Settings.Trig.Sync == CSettings::Trigger::_Scan ||
+		Settings.Trig.Sync == CSettings::Trigger::_Roll || Settings.Trig.Soft != CSettings::Trigger::_SoftOff )
 	{
 		BIOS::ADC::ConfigureTrigger(0, 0, 0, -1 );
 	} else {
@@ -50,6 +57,9 @@
 /*static*/ void CCoreOscilloscope::UpdateConstants()
 {
 	Settings.Runtime.m_fTimeRes = CSettings::TimeBase::pfValueResolution[ Settings.Time.Resolution ];
+	// equivalent time sampling shows a finer grid than the selected timebase
+	if ( Settings.Trig.Sync == CSettings::Trigger::_Ets )
+		Settings.Runtime.m_fTimeRes /= CCoreEts::Factor;
 	Settings.Runtime.m_fCH1Res  = 
 		CSettings::AnalogChannel::pfValueResolution[ Settings.CH1.Resolution ] *
 		CSettings::AnalogChannel::pfValueProbe[ Settings.CH1.Probe ];
@@ -3,6 +3,17 @@
 
 #include <Source/HwLayer/Types.h>
 #include <Source/Framework/Classes.h>
+#include "CaptureStore.h"
+#include "CoreSequence.h"
+#include "CoreRoll.h"
+#include "Resampler.h"
+#include "SoftTrigger.h"
+#include "CoreEts.h"
+#include "CorePeak.h"
+#include "CoreHiRes.h"
+#include "CoreAverage.h"
+#include "CorePhosphor.h"
+#include "CoreRecorder.h"
 
 class CCoreOscilloscope
 {
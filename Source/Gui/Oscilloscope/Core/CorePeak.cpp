@@ -0,0 +1,73 @@
+#include "CorePeak.h"
+#include "CaptureStore.h"
+#include <Source/Core/Settings.h>
+#include <Source/Core/Utils.h>
+
+/*static*/ int CCorePeak::m_nFirst = 0;
+/*static*/ int CCorePeak::m_nCount = 0;
+
+/*static*/ bool CCorePeak::IsDecimating()
+{
+	if ( Settings.Time.Acquire == CSettings::TimeBase::_AcqNormal )
+		return false;
+	// these modes build the record by themselves
+	if ( Settings.Trig.Sync == CSettings::Trigger::_Roll || Settings.Trig.Sync == CSettings::Trigger::_Seq ||
+		Settings.Trig.Sync == CSettings::Trigger::_Ets )
+		return false;
+	// the BIOS accepts only the values of the timebase table and the fastest
+	// timebases are resampled, the envelope would not be uniform
+	int nResolution = (NATIVEENUM)Settings.Time.Resolution - Steps;
+	return nResolution >= 0 && CSettings::TimeBase::pfValueResolutionCorrection[nResolution] == 1024;
+}
+
+/*static*/ bool CCorePeak::IsActive()
+{
+	return Settings.Time.Acquire == CSettings::TimeBase::_AcqPeak && IsDecimating();
+}
+
+/*static*/ int CCorePeak::GetResolution()
+{
+	int nResolution = (NATIVEENUM)Settings.Time.Resolution;
+	return IsDecimating() ? nResolution - Steps : nResolution;
+}
+
+/*static*/ void CCorePeak::GetRecord(int& nFirst, int& nCount)
+{
+	// raw sample nPosition is the trigger, its point is moved back there
+	int nPosition = Settings.Trig.nPosition;
+	UTILS.Clamp<int>( nPosition, 0, CCaptureStore::Length-1 );
+	nFirst = nPosition - nPosition / Decimation;
+	nCount = min( CCaptureStore::Length / Decimation, CCaptureStore::Length - nFirst );
+}
+
+/*static*/ void CCorePeak::Process()
+{
+	// the envelope comes from the planes of the full rate capture
+	CCaptureStore::Update();
+
+	GetRecord( m_nFirst, m_nCount );
+	m_nCount = min( m_nCount, (int)Points );
+
+	// the reduced record is written over the planes
+	bool bEnvelope = CCoreShared::Claim( CCoreShared::Peak );
+	int nSplit = min( CCaptureStore::GetReduceSplit( m_nFirst, Decimation ), m_nCount );
+	for ( int i = nSplit; i < m_nCount; i++ )
+		_Reduce( i, bEnvelope );
+	for ( int i = nSplit-1; i >= 0; i-- )
+		_Reduce( i, bEnvelope );
+	// the measurements skip the cleared samples around the record
+	CCaptureStore::Crop( m_nFirst, m_nCount );
+}
+
+/*static*/ void CCorePeak::_Reduce(int i, bool bEnvelope)
+{
+	TEnvelope& envelope = *(TEnvelope*)CCoreShared::GetBuffer();
+	for ( int nChannel = CCaptureStore::CH1; bEnvelope && nChannel <= CCaptureStore::CH2; nChannel++ )
+	{
+		int nMin, nMax;
+		CCaptureStore::GetMinMax( nChannel, i * Decimation, (i + 1) * Decimation, nMin, nMax );
+		envelope.arrMin[nChannel][i] = (ui8)nMin;
+		envelope.arrMax[nChannel][i] = (ui8)nMax;
+	}
+	CCaptureStore::Set( m_nFirst + i, CCaptureStore::GetAt( i * Decimation ) );
+}
@@ -0,0 +1,74 @@
+#ifndef __COREPEAK_H__
+#define __COREPEAK_H__
+
+#include <Source/HwLayer/Types.h>
+#include "CoreShared.h"
+
+// Peak detect acquisition. The ADC runs Decimation times faster than the
+// selected timebase and every Decimation raw samples are reduced to one
+// display point, the capture store keeps the first sample of the interval
+// and the envelope keeps min and max of CH1 and CH2 over the interval, so
+// glitches shorter than the sample period of the timebase stay visible.
+// The reduced record starts at m_nFirst, the trigger stays at Trig.nPosition.
+// The envelope is kept in the buffer of CCoreShared
+class CCorePeak
+{
+public:
+	enum {
+		// three steps of the 1-2-5 timebase table
+		Steps = 3,
+		Decimation = 10,
+#ifdef _ARM
+		// the shared buffer has no room for the envelope of the whole capture,
+		// the record is cut to Points
+		Points = 384
+#else
+		Points = 512
+#endif
+	};
+
+	struct TEnvelope
+	{
+		ui8 arrMin[2][Points];
+		ui8 arrMax[2][Points];
+	};
+
+private:
+	static int m_nFirst;
+	static int m_nCount;
+
+public:
+	// peak detect or high resolution is selected and the faster timebase
+	// exists without correction
+	static bool IsDecimating();
+	static bool IsActive();
+	// timebase the ADC has to be configured to
+	static int GetResolution();
+	// position and length of the reduced record in the capture store
+	static void GetRecord(int& nFirst, int& nCount);
+	// reduces the full rate capture in the ADC buffer into the capture store
+	static void Process();
+	// follows CCaptureStore::Align
+	static void Shift(int nOffset)
+	{
+		m_nFirst -= nOffset;
+	}
+	// envelope of the store sample i, false outside of the reduced record
+	static bool GetEnvelope(int nChannel, int i, int& nMin, int& nMax)
+	{
+		i -= m_nFirst;
+		if ( i < 0 || i >= m_nCount || !CCoreShared::IsOwner( CCoreShared::Peak ) )
+			return false;
+		const TEnvelope& envelope = *(const TEnvelope*)CCoreShared::GetBuffer();
+		nMin = envelope.arrMin[nChannel][i];
+		nMax = envelope.arrMax[nChannel][i];
+		return true;
+	}
+
+private:
+	// envelope and first sample of the interval i, the envelope is skipped
+	// when the shared buffer is held by another engine
+	static void _Reduce(int i, bool bEnvelope);
+};
+
+#endif
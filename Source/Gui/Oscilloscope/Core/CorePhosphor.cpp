@@ -0,0 +1,197 @@
+#include "CorePhosphor.h"
+#include <Source/Core/Settings.h>
+#include <Source/Core/Utils.h>
+
+/*static*/ const ui16 CCorePhosphor::m_arrPalette[CCorePhosphor::Colors] = {
+	RGB565(000060), RGB565(0000a0), RGB565(0020e0), RGB565(0060ff),
+	RGB565(00a0ff), RGB565(00e0e0), RGB565(00ff80), RGB565(40ff00),
+	RGB565(a0ff00), RGB565(ffff00), RGB565(ffc000), RGB565(ff8000),
+	RGB565(ff4000), RGB565(ff0000), RGB565(ff8080), RGB565(ffffff) };
+
+/*static*/ void CCorePhosphor::Reset()
+{
+	// the buffer may hold the state of another engine
+	if ( CCoreShared::IsOwner( CCoreShared::Phosphor ) )
+		memset( &_GetCells(), 0, sizeof(TCells) );
+}
+
+/*static*/ bool CCorePhosphor::IsActive()
+{
+	// the XY graph needs the counters with any persistence
+	if ( Settings.Disp.Axes != CSettings::Display::_TY )
+		return true;
+	return Settings.Disp.Persist == CSettings::Display::_PerPhosphor;
+}
+
+// the counter is multiplied by nMul/256 in every acquisition, 2^(-1/half-life),
+// nAdd is the hit that keeps a steady trace at Level
+/*static*/ void CCorePhosphor::_GetDecay(int& nMul, int& nAdd)
+{
+	static const ui8 arrMul[] = {128, 181, 215, 235, 245, 250, 253};
+	int nHalfLife = (NATIVEENUM)Settings.Disp.HalfLife;
+	UTILS.Clamp<int>( nHalfLife, 0, COUNT(arrMul)-1 );
+	nMul = arrMul[nHalfLife];
+	nAdd = ( Level * (256 - nMul) + 255 ) >> 8;
+}
+
+// the products of the even and odd bytes stay in their 16 bit lanes
+/*static*/ void CCorePhosphor::_Decay(TWord* pWords, int nCount, int nMul)
+{
+	for ( int i = 0; i < nCount; i++ )
+	{
+		TWord nWord = pWords[i];
+		pWords[i] = ( ( ( nWord & 0x00ff00ff ) * nMul >> 8 ) & 0x00ff00ff ) |
+			( ( ( nWord >> 8 ) & 0x00ff00ff ) * nMul & 0xff00ff00 );
+	}
+}
+
+/*static*/ void CCorePhosphor::Process()
+{
+	bool bOwner = CCoreShared::IsOwner( CCoreShared::Phosphor );
+	if ( !CCoreShared::Claim( CCoreShared::Phosphor ) )
+		return;
+	if ( !bOwner )
+		Reset();
+
+	if ( Settings.Disp.Axes != CSettings::Display::_TY )
+	{
+		_ProcessXY();
+		return;
+	}
+
+	int nMul, nAdd;
+	_GetDecay( nMul, nAdd );
+
+	bool arrEnabled[2] = {
+		Settings.CH1.Enabled == CSettings::AnalogChannel::_YES,
+		Settings.CH2.Enabled == CSettings::AnalogChannel::_YES };
+	CSettings::Calibrator::FastCalc arrFast[2];
+	Settings.CH1Calib.Prepare( &Settings.CH1, arrFast[0] );
+	Settings.CH2Calib.Prepare( &Settings.CH2, arrFast[1] );
+	const ui8* arrPlane[2] = {
+		CCaptureStore::GetAnalog( CCaptureStore::CH1 ),
+		CCaptureStore::GetAnalog( CCaptureStore::CH2 ) };
+
+	int nIndex = Settings.Time.Shift;
+	int nMaxIndex = BIOS::ADC::GetCount();
+	int arrPrev[2] = {-1, -1};
+
+	for ( int x = 0; x < Width; x++ )
+	{
+		TWord* pWords = _GetCells()[x];
+		_Decay( pWords, Height/4, nMul );
+
+		// the counters are hit by the span joining two samples as drawn in lines mode
+		ui8* pCells = (ui8*)pWords;
+		for ( int i = 0; i < ScaleX && nIndex < nMaxIndex; i++, nIndex++ )
+			for ( int nChannel = 0; nChannel < 2; nChannel++ )
+			{
+				if ( !arrEnabled[nChannel] )
+					continue;
+				CSettings::Calibrator& calib = nChannel == 0 ? Settings.CH1Calib : Settings.CH2Calib;
+				int nSample = calib.Correct( arrFast[nChannel], arrPlane[nChannel][nIndex] );
+				UTILS.Clamp<int>( nSample, 0, 255 );
+				int nY = ( (nSample * GraphHeight) >> 8 ) / ScaleY;
+				int nPrev = arrPrev[nChannel] < 0 ? nY : arrPrev[nChannel];
+				arrPrev[nChannel] = nY;
+				for ( int y = min( nY, nPrev ); y <= max( nY, nPrev ); y++ )
+					pCells[y] = (ui8)min( pCells[y] + nAdd, 255 );
+			}
+	}
+}
+
+// hits the cells of the vector from (x0, y0) to (x1, y1), the first cell was
+// hit by the previous vector
+/*static*/ void CCorePhosphor::_Line(ui8* pCells, int x0, int y0, int x1, int y1, int nAdd)
+{
+	int nDx = abs( x1 - x0 ), nDy = abs( y1 - y0 );
+	int nSx = x0 < x1 ? 1 : -1, nSy = y0 < y1 ? 1 : -1;
+	int nErr = nDx - nDy;
+	while ( x0 != x1 || y0 != y1 )
+	{
+		int nErr2 = nErr * 2;
+		if ( nErr2 > -nDy )
+		{
+			nErr -= nDy;
+			x0 += nSx;
+		}
+		if ( nErr2 < nDx )
+		{
+			nErr += nDx;
+			y0 += nSy;
+		}
+		ui8& nCell = pCells[x0 * SizeXY + y0];
+		nCell = (ui8)min( nCell + nAdd, 255 );
+	}
+}
+
+/*static*/ void CCorePhosphor::_ProcessXY()
+{
+	// the square is stored column after column without the padding of the
+	// TY layout, SizeXY*SizeXY fits into the buffer on all platforms
+	TWord* pWords = &_GetCells()[0][0];
+	ui8* pCells = (ui8*)pWords;
+	int nAdd = HitXY;
+	switch ( Settings.Disp.Persist )
+	{
+	case CSettings::Display::_PerNo:
+		memset( pCells, 0, SizeXY*SizeXY );
+		break;
+	case CSettings::Display::_PerPhosphor:
+	{
+		// a cell of the XY trace gets several hits in every acquisition
+		int nMul;
+		_GetDecay( nMul, nAdd );
+		_Decay( pWords, SizeXY*SizeXY/4, nMul );
+		nAdd = max( nAdd / HitsXY, 1 );
+		break;
+	}
+	default:
+		break;
+	}
+
+	if ( Settings.CH1.Enabled != CSettings::AnalogChannel::_YES ||
+		Settings.CH2.Enabled != CSettings::AnalogChannel::_YES )
+		return;
+
+	// calibrated position of every raw value, the correction is not repeated
+	// for each of the samples
+	ui8 arrLut[2][256];
+	CSettings::Calibrator::FastCalc arrFast[2];
+	Settings.CH1Calib.Prepare( &Settings.CH1, arrFast[0] );
+	Settings.CH2Calib.Prepare( &Settings.CH2, arrFast[1] );
+	for ( int nChannel = 0; nChannel < 2; nChannel++ )
+	{
+		CSettings::Calibrator& calib = nChannel == 0 ? Settings.CH1Calib : Settings.CH2Calib;
+		for ( int i = 0; i < 256; i++ )
+		{
+			int nSample = calib.Correct( arrFast[nChannel], i );
+			UTILS.Clamp<int>( nSample, 0, 255 );
+			arrLut[nChannel][i] = (ui8)( ( (nSample * GraphHeight) >> 8 ) / ScaleXY );
+		}
+	}
+
+	bool bSwap = Settings.Disp.Axes == CSettings::Display::_YX;
+	const ui8* pPlaneX = CCaptureStore::GetAnalog( bSwap ? CCaptureStore::CH2 : CCaptureStore::CH1 );
+	const ui8* pPlaneY = CCaptureStore::GetAnalog( bSwap ? CCaptureStore::CH1 : CCaptureStore::CH2 );
+	const ui8* pLutX = arrLut[bSwap ? 1 : 0];
+	const ui8* pLutY = arrLut[bSwap ? 0 : 1];
+	bool bVectors = Settings.Disp.Draw != CSettings::Display::_Points;
+
+	int nCount = BIOS::ADC::GetCount();
+	int nPrevX = -1, nPrevY = -1;
+	for ( int i = 0; i < nCount; i++ )
+	{
+		int nX = pLutX[ pPlaneX[i] ];
+		int nY = pLutY[ pPlaneY[i] ];
+		if ( bVectors && nPrevX >= 0 && ( nX != nPrevX || nY != nPrevY ) )
+			_Line( pCells, nPrevX, nPrevY, nX, nY, nAdd );
+		else
+		{
+			ui8& nCell = pCells[nX * SizeXY + nY];
+			nCell = (ui8)min( nCell + nAdd, 255 );
+		}
+		nPrevX = nX;
+		nPrevY = nY;
+	}
+}
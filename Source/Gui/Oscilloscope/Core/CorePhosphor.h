@@ -0,0 +1,90 @@
+#ifndef __COREPHOSPHOR_H__
+#define __COREPHOSPHOR_H__
+
+#include <Source/HwLayer/Types.h>
+#include "CaptureStore.h"
+#include "CoreShared.h"
+
+// Digital phosphor persistence. Every acquisition adds the hits of the CH1
+// and CH2 traces into a grid of 8 bit saturating counters covering the graph
+// area, the counters decay exponentially with the half-life selected by
+// Settings.Disp.HalfLife. The graph paints the counters through a palette
+// instead of the analog traces.
+// The XY graph is always painted from the same counters, every acquisition
+// plots all sample pairs of the capture into a square of GraphHeight pixels.
+// The counters are kept in the buffer of CCoreShared
+class CCorePhosphor
+{
+public:
+	typedef CCaptureStore::TWord TWord;
+
+	enum {
+		GraphWidth = 300,
+		GraphHeight = 200,
+#ifdef _ARM
+		// the application RAM has no room for a counter per pixel, one
+		// counter covers 10x5 pixels
+		ScaleX = 10,
+		ScaleY = 5,
+		// 20x20 counters of the XY square fit into the same buffer
+		ScaleXY = 10,
+#else
+		ScaleX = 1,
+		ScaleY = 1,
+		ScaleXY = 1,
+#endif
+		Width = GraphWidth / ScaleX,
+		Height = GraphHeight / ScaleY,
+		SizeXY = GraphHeight / ScaleXY,
+		// a trace hit in every acquisition settles at this count
+		Level = 224,
+		// hit of a XY sample without decay, four hits saturate the counter
+		HitXY = 64,
+		// hits of a cell in one acquisition with the decay of the phosphor
+		HitsXY = 4,
+		Colors = 16
+	};
+
+	// column major, the decay runs over four counters of a word at once
+	typedef TWord TCells[Width][Height/4];
+
+private:
+	static const ui16 m_arrPalette[Colors];
+
+public:
+	static void Reset();
+	static bool IsActive();
+	// active and holding the shared buffer, the graph paints the counters
+	static bool IsShown()
+	{
+		return IsActive() && CCoreShared::IsOwner( CCoreShared::Phosphor );
+	}
+	// decay and accumulation of the current capture in a single pass
+	static void Process();
+	// counters of the graph column x, the counter of pixel y is [y/ScaleY]
+	static const ui8* GetColumn(int x)
+	{
+		return (const ui8*)_GetCells()[x / ScaleX];
+	}
+	// counters of the XY square column x, the counter of pixel y is [y/ScaleXY]
+	static const ui8* GetColumnXY(int x)
+	{
+		return (const ui8*)_GetCells() + (x / ScaleXY) * SizeXY;
+	}
+	static ui16 GetColor(int nCount)
+	{
+		return m_arrPalette[nCount * Colors >> 8];
+	}
+
+private:
+	static TCells& _GetCells()
+	{
+		return *(TCells*)CCoreShared::GetBuffer();
+	}
+	static void _GetDecay(int& nMul, int& nAdd);
+	static void _Decay(TWord* pWords, int nCount, int nMul);
+	static void _ProcessXY();
+	static void _Line(ui8* pCells, int x0, int y0, int x1, int y1, int nAdd);
+};
+
+#endif
@@ -0,0 +1,286 @@
+#include "CoreRecorder.h"
+#include "CoreOscilloscope.h"
+#include <Source/Core/Settings.h>
+#include <Source/Core/Serialize.h>
+
+/*static*/ const char* const CCoreRecorder::ppszTextSpeed[] = {"x1", "x2", "x4", "x8", "Max"};
+
+/*static*/ char CCoreRecorder::m_strName[16] = "";
+/*static*/ bool CCoreRecorder::m_bRecording = false;
+/*static*/ bool CCoreRecorder::m_bReplaying = false;
+/*static*/ int CCoreRecorder::m_nFrames = 0;
+/*static*/ int CCoreRecorder::m_nFrame = 0;
+/*static*/ ui32 CCoreRecorder::m_nLastTick = 0;
+/*static*/ ui32 CCoreRecorder::m_nWait = 0;
+/*static*/ CCoreRecorder::ESpeed CCoreRecorder::m_eSpeed = CCoreRecorder::Speed1x;
+
+// header: magic, frame, tick, interval to the previous frame (4 bytes each),
+// the enumerated settings (1 byte each), the signed values (2 bytes each)
+// and the number of invalid samples at the beginning
+/*static*/ void CCoreRecorder::_GetFields(NATIVEENUM** arrEnums, si16** arrValues)
+{
+	arrEnums[0] = _E(Settings.Time.Resolution);
+	arrEnums[1] = _E(Settings.Time.Acquire);
+	arrEnums[2] = _E(Settings.CH1.Resolution);
+	arrEnums[3] = _E(Settings.CH1.Coupling);
+	arrEnums[4] = _E(Settings.CH2.Resolution);
+	arrEnums[5] = _E(Settings.CH2.Coupling);
+	arrEnums[6] = _E(Settings.Trig.Type);
+	arrEnums[7] = _E(Settings.Trig.Source);
+	arrValues[0] = &Settings.CH1.u16Position;
+	arrValues[1] = &Settings.CH2.u16Position;
+	arrValues[2] = &Settings.Trig.nLevel;
+	arrValues[3] = &Settings.Trig.nPosition;
+}
+
+/*static*/ void CCoreRecorder::_PutWord(ui8* pData, ui32 nValue, int nBytes)
+{
+	for ( int i = 0; i < nBytes; i++ )
+		pData[i] = (ui8)( nValue >> (i*8) );
+}
+
+/*static*/ ui32 CCoreRecorder::_GetWord(const ui8* pData, int nBytes)
+{
+	ui32 nValue = 0;
+	for ( int i = nBytes-1; i >= 0; i-- )
+		nValue = (nValue << 8) | pData[i];
+	return nValue;
+}
+
+/*static*/ void CCoreRecorder::_Snapshot(ui8* pHeader)
+{
+	NATIVEENUM* arrEnums[Enums];
+	si16* arrValues[Values];
+	_GetFields( arrEnums, arrValues );
+	ui8* pData = pHeader + 16;
+	for ( int i = 0; i < Enums; i++ )
+		*pData++ = (ui8)*arrEnums[i];
+	for ( int i = 0; i < Values; i++, pData += 2 )
+		_PutWord( pData, (ui16)*arrValues[i], 2 );
+	_PutWord( pData, (ui16)Settings.Time.InvalidFirst, 2 );
+}
+
+/*static*/ bool CCoreRecorder::_Apply(const ui8* pHeader)
+{
+	NATIVEENUM* arrEnums[Enums];
+	si16* arrValues[Values];
+	_GetFields( arrEnums, arrValues );
+	bool bChanged = false;
+	const ui8* pData = pHeader + 16;
+	for ( int i = 0; i < Enums; i++ )
+	{
+		NATIVEENUM nValue = *pData++;
+		bChanged |= *arrEnums[i] != nValue;
+		*arrEnums[i] = nValue;
+	}
+	for ( int i = 0; i < Values; i++, pData += 2 )
+	{
+		si16 nValue = (si16)_GetWord( pData, 2 );
+		bChanged |= *arrValues[i] != nValue;
+		*arrValues[i] = nValue;
+	}
+	Settings.Time.InvalidFirst = (int)_GetWord( pData, 2 );
+	if ( bChanged )
+		CCoreOscilloscope::UpdateConstants();
+	return bChanged;
+}
+
+// first unused name, or the last used one
+/*static*/ bool CCoreRecorder::_FindName(bool bUnused)
+{
+#ifdef _VERSION2
+	for ( int i = 0; i < 1000; i++ )
+	{
+		char strName[16] = "REC000.DSR";
+		strName[3] = (char)( '0' + i / 100 );
+		strName[4] = (char)( '0' + (i / 10) % 10 );
+		strName[5] = (char)( '0' + i % 10 );
+		if ( BIOS::FAT::Open( strName, BIOS::DSK::IoRead ) != BIOS::FAT::EOk )
+		{
+			if ( bUnused )
+				_SetName( strName );
+			return bUnused || i > 0;
+		}
+		BIOS::FAT::Close();
+		_SetName( strName );
+	}
+#endif
+	return false;
+}
+
+// longer names are cut, the terminator is always there
+/*static*/ void CCoreRecorder::_SetName(const char* strName)
+{
+	int i;
+	for ( i = 0; i < (int)sizeof(m_strName)-1 && strName[i]; i++ )
+		m_strName[i] = strName[i];
+	m_strName[i] = 0;
+}
+
+/*static*/ bool CCoreRecorder::StartRecording(const char* strName /*= NULL*/)
+{
+	StopReplay();
+	if ( strName )
+		_SetName( strName );
+	else
+	{
+		if ( !_FindName( true ) )
+			return false;
+	}
+	m_nFrame = 0;
+	m_nFrames = 0;
+	m_bRecording = true;
+	return true;
+}
+
+/*static*/ void CCoreRecorder::StopRecording()
+{
+	m_bRecording = false;
+}
+
+/*static*/ bool CCoreRecorder::Record()
+{
+#ifdef _VERSION2
+	if ( !m_bRecording )
+		return false;
+	// the first frame replaces an older recording of the same name
+	if ( BIOS::FAT::Open( m_strName, m_nFrames ? BIOS::DSK::IoAppend : BIOS::DSK::IoWrite ) != BIOS::FAT::EOk )
+	{
+		m_bRecording = false;
+		return false;
+	}
+
+	ui32 nTick = BIOS::SYS::GetTick();
+	ui8* pSector = (ui8*)BIOS::DSK::GetSharedBuffer();
+	memset( pSector, 0, SectorSize );
+	_PutWord( pSector, Magic, 4 );
+	_PutWord( pSector + 4, m_nFrame, 4 );
+	_PutWord( pSector + 8, nTick, 4 );
+	_PutWord( pSector + 12, m_nFrame ? nTick - m_nLastTick : 0, 4 );
+	_Snapshot( pSector );
+	bool bOk = BIOS::FAT::Write( pSector ) == BIOS::FAT::EOk;
+
+	// the samples run over the sector boundaries
+	int j = 0;
+	for ( int i = 0; i < BIOS::ADC::Length && bOk; i++ )
+	{
+		BIOS::ADC::TSample nSample = BIOS::ADC::GetAt(i);
+		ui8 arrBytes[SampleBytes] = { (ui8)nSample, (ui8)(nSample >> 8), (ui8)((nSample >> 16) & 3) };
+		for ( int k = 0; k < SampleBytes; k++ )
+		{
+			pSector[j++] = arrBytes[k];
+			if ( j == SectorSize )
+			{
+				bOk = BIOS::FAT::Write( pSector ) == BIOS::FAT::EOk;
+				j = 0;
+			}
+		}
+	}
+	BIOS::FAT::Close();
+
+	// disk full, the file ends with the last complete record
+	if ( !bOk )
+	{
+		m_bRecording = false;
+		return false;
+	}
+	m_nLastTick = nTick;
+	m_nFrames = ++m_nFrame;
+	return true;
+#else
+	return false;
+#endif
+}
+
+/*static*/ bool CCoreRecorder::StartReplay(const char* strName /*= NULL*/)
+{
+#ifdef _VERSION2
+	StopRecording();
+	if ( strName )
+		_SetName( strName );
+	else
+	{
+		if ( !_FindName( false ) )
+			return false;
+	}
+	if ( BIOS::FAT::Open( m_strName, BIOS::DSK::IoRead ) != BIOS::FAT::EOk )
+		return false;
+	m_nFrames = BIOS::FAT::GetFileSize() / (Sectors * SectorSize);
+	BIOS::FAT::Close();
+	if ( m_nFrames == 0 )
+		return false;
+
+	m_nFrame = -1;
+	m_nWait = 0;
+	m_nLastTick = BIOS::SYS::GetTick();
+	m_bReplaying = true;
+	return true;
+#else
+	return false;
+#endif
+}
+
+/*static*/ void CCoreRecorder::StopReplay()
+{
+	m_bReplaying = false;
+}
+
+/*static*/ bool CCoreRecorder::IsDue()
+{
+	if ( !m_bReplaying )
+		return false;
+	if ( m_eSpeed == SpeedMax )
+		return true;
+	// long breaks in the recording are not waited for
+	ui32 nWait = min( m_nWait, (ui32)2000 ) >> (int)m_eSpeed;
+	return BIOS::SYS::GetTick() - m_nLastTick >= nWait;
+}
+
+/*static*/ bool CCoreRecorder::Replay()
+{
+#ifdef _VERSION2
+	if ( !m_bReplaying )
+		return false;
+	if ( BIOS::FAT::Open( m_strName, BIOS::DSK::IoRead ) != BIOS::FAT::EOk )
+	{
+		m_bReplaying = false;
+		return false;
+	}
+	int nFrame = ( m_nFrame + 1 ) % m_nFrames;
+	BIOS::FAT::Seek( nFrame * Sectors * SectorSize );
+	ui8* pSector = (ui8*)BIOS::DSK::GetSharedBuffer();
+	if ( BIOS::FAT::Read( pSector ) != BIOS::FAT::EOk || _GetWord( pSector, 4 ) != Magic )
+	{
+		BIOS::FAT::Close();
+		m_bReplaying = false;
+		return false;
+	}
+	m_nWait = _GetWord( pSector + 12, 4 );
+	bool bChanged = _Apply( pSector );
+
+	int j = SectorSize;
+	for ( int i = 0; i < BIOS::ADC::Length; i++ )
+	{
+		ui8 arrBytes[SampleBytes];
+		for ( int k = 0; k < SampleBytes; k++ )
+		{
+			if ( j == SectorSize )
+			{
+				BIOS::FAT::Read( pSector );
+				j = 0;
+			}
+			arrBytes[k] = pSector[j++];
+		}
+		// top byte is used by the application, it is kept like BIOS::ADC::Copy does
+		BIOS::ADC::TSample& nSample = BIOS::ADC::GetAt(i);
+		nSample = ( nSample & 0xff000000 ) | arrBytes[0] | (arrBytes[1] << 8) | (arrBytes[2] << 16);
+	}
+	BIOS::FAT::Close();
+
+	m_nFrame = nFrame;
+	m_nLastTick = BIOS::SYS::GetTick();
+	return bChanged;
+#else
+	return false;
+#endif
+}
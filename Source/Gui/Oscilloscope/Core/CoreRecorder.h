@@ -0,0 +1,104 @@
+#ifndef __CORERECORDER_H__
+#define __CORERECORDER_H__
+
+#include <Source/HwLayer/Types.h>
+#include <Source/HwLayer/Bios.h>
+
+// Recording of the raw captures into a growing file and their replay through
+// the same processing. Every capture is a record of Sectors sectors, a header
+// with the frame number, its time and a snapshot of the settings needed to
+// interpret the samples, followed by the samples packed into three bytes
+// (CH1, CH2, CH3 and CH4 bits). The file is opened in append mode for every
+// record, so it stays complete when the recording is interrupted. Replay
+// loads the frames into the buffer of BIOS::ADC in place of Copy and
+// starts again with the first frame at the end of the file
+class CCoreRecorder
+{
+public:
+	enum {
+		SectorSize = 512,
+		SampleBytes = 3,
+		Sectors = 1 + BIOS::ADC::Length * SampleBytes / SectorSize,
+		Magic = 0x31525344,	// "DSR1"
+		// settings in the header
+		Enums = 8,
+		Values = 4
+	};
+
+	enum ESpeed {
+		Speed1x,
+		Speed2x,
+		Speed4x,
+		Speed8x,
+		SpeedMax,
+		_SpeedMax = SpeedMax
+	};
+	static const char* const ppszTextSpeed[];
+
+private:
+	static char m_strName[16];
+	static bool m_bRecording;
+	static bool m_bReplaying;
+	static int m_nFrames;
+	static int m_nFrame;
+	static ui32 m_nLastTick;
+	static ui32 m_nWait;
+	static ESpeed m_eSpeed;
+
+public:
+	// a new file RECnnn.DSR is created by the first record
+	static bool StartRecording(const char* strName = NULL);
+	static void StopRecording();
+	static bool IsRecording()
+	{
+		return m_bRecording;
+	}
+	// appends the capture in the buffer of BIOS::ADC
+	static bool Record();
+
+	// NULL replays the last recording
+	static bool StartReplay(const char* strName = NULL);
+	static void StopReplay();
+	static bool IsReplaying()
+	{
+		return m_bReplaying;
+	}
+	// the recorded interval since the previous frame has passed, scaled by the speed
+	static bool IsDue();
+	// loads the next frame into the ADC buffer and applies its settings,
+	// returns true when the settings changed
+	static bool Replay();
+
+	static void SetSpeed(ESpeed eSpeed)
+	{
+		m_eSpeed = eSpeed;
+	}
+	static ESpeed GetSpeed()
+	{
+		return m_eSpeed;
+	}
+	// frames written while recording, frame being shown while replaying
+	static int GetFrame()
+	{
+		return m_nFrame;
+	}
+	static int GetFrames()
+	{
+		return m_nFrames;
+	}
+	static const char* GetName()
+	{
+		return m_strName;
+	}
+
+private:
+	static bool _FindName(bool bUnused);
+	static void _SetName(const char* strName);
+	static void _PutWord(ui8* pData, ui32 nValue, int nBytes);
+	static ui32 _GetWord(const ui8* pData, int nBytes);
+	static void _GetFields(NATIVEENUM** arrEnums, si16** arrValues);
+	static void _Snapshot(ui8* pHeader);
+	static bool _Apply(const ui8* pHeader);
+};
+
+#endif
@@ -0,0 +1,67 @@
+#include "CoreRoll.h"
+#include "CaptureStore.h"
+#include <Source/Core/Settings.h>
+
+/*static*/ int CCoreRoll::m_nRead = 0;
+/*static*/ int CCoreRoll::m_nColumn = 0;
+/*static*/ int CCoreRoll::m_nNew = 0;
+
+/*static*/ void CCoreRoll::Reset()
+{
+	m_nRead = 0;
+	m_nColumn = 0;
+	m_nNew = 0;
+	// the columns are written over the last capture
+	CCaptureStore::SetValid( 0, CCaptureStore::Length );
+}
+
+/*static*/ int CCoreRoll::Acquire()
+{
+	int nCount = BIOS::ADC::GetCount();
+	int nPointer = BIOS::ADC::Ready() ? nCount : BIOS::ADC::GetPointer() - Lag;
+	if ( nPointer > nCount )
+		nPointer = nCount;
+
+	m_nNew = 0;
+	while ( m_nRead < nPointer )
+	{
+		// every word has to be read to advance the FIFO read pointer, the first
+		// samples after restart are noise and are not shown
+		BIOS::ADC::TSample arrChunk[32];
+		int nChunk = min( nPointer - m_nRead, (int)COUNT(arrChunk) );
+		BIOS::ADC::Read( arrChunk, nChunk );
+
+		for ( int i = 0; i < nChunk; i++, m_nRead++ )
+		{
+			if ( m_nRead < Settings.Time.InvalidFirst )
+				continue;
+
+			int nIndex = Settings.Time.Shift + m_nColumn;
+			if ( nIndex < CCaptureStore::Length )
+				CCaptureStore::Set( nIndex, (CCaptureStore::TWord)arrChunk[i] );
+			if ( ++m_nColumn >= Width )
+				m_nColumn = 0;
+			m_nNew++;
+		}
+	}
+
+	if ( m_nRead >= nCount )
+	{
+		BIOS::ADC::Restart();
+		m_nRead = 0;
+	}
+
+	if ( m_nNew > Width )
+		m_nNew = Width;
+	return m_nNew;
+}
+
+/*static*/ int CCoreRoll::GetColumn()
+{
+	return m_nColumn;
+}
+
+/*static*/ int CCoreRoll::GetNew()
+{
+	return m_nNew;
+}
@@ -0,0 +1,35 @@
+#ifndef __COREROLL_H__
+#define __COREROLL_H__
+
+#include <Source/HwLayer/Types.h>
+
+// Roll mode for slow timebases, the FIFO is read while it is being filled and
+// every sample is appended to a circular window of the capture store (one
+// sample per column starting at Time.Shift). The trace is not scrolled, that
+// would repaint every column, a sweep cursor moves over the window instead
+// and only the new columns are repainted.
+class CCoreRoll
+{
+public:
+	enum {
+		Width = 300,
+		// the write pointer is estimated from the time since the restart,
+		// the reads stay behind it until the FIFO reports full
+		Lag = 8
+	};
+
+private:
+	static int m_nRead;
+	static int m_nColumn;
+	static int m_nNew;
+
+public:
+	static void Reset();
+	// read all samples written since the last call, returns number of new columns
+	static int Acquire();
+	// column following the newest sample
+	static int GetColumn();
+	static int GetNew();
+};
+
+#endif
@@ -0,0 +1,98 @@
+#include "CoreSequence.h"
+#include "CaptureStore.h"
+#include "Resampler.h"
+#include "Interpolator.h"
+#include <Source/Core/Settings.h>
+#include <Source/Core/Utils.h>
+
+/*static*/ ui32 CCoreSequence::m_arrTimestamp[CCoreSequence::MaxSegments];
+/*static*/ int CCoreSequence::m_nSegments = 0;
+/*static*/ int CCoreSequence::m_nCaptured = 0;
+/*static*/ int CCoreSequence::m_nLength = 0;
+/*static*/ int CCoreSequence::m_nFirst = 0;
+/*static*/ int CCoreSequence::m_nCorrection = CResampler::Unity;
+/*static*/ int CCoreSequence::m_nRawFirst = 0;
+/*static*/ int CCoreSequence::m_nPhase = 0;
+
+/*static*/ void CCoreSequence::Reset()
+{
+	m_nCaptured = 0;
+	m_nSegments = 0;
+}
+
+/*static*/ bool CCoreSequence::Acquire()
+{
+	if ( m_nSegments == 0 || m_nCaptured >= m_nSegments )
+	{
+		// new sequence, each segment covers the same part of the capture
+		// starting at the left edge of the visible window
+		m_nSegments = Settings.Trig.nSegments;
+		UTILS.Clamp<int>( m_nSegments, 1, MaxSegments );
+		// the segments stay in the part of the ADC buffer below the planes
+		m_nLength = CCaptureStore::RawLength / m_nSegments;
+		m_nFirst = Settings.Time.Shift;
+		UTILS.Clamp<int>( m_nFirst, 0, CCaptureStore::Length - m_nLength );
+		m_nCaptured = 0;
+
+		// the display sample i is the raw sample i * nCorrection / Unity, at the
+		// fast timebases the segment covers less raw samples than it shows
+		m_nCorrection = Settings.Time.pfValueResolutionCorrection[ (NATIVEENUM)Settings.Time.Resolution ];
+		m_nRawFirst = ( m_nFirst * m_nCorrection ) >> CResampler::FractionBits;
+		m_nPhase = ( m_nFirst * m_nCorrection ) & (CResampler::Unity-1);
+	}
+
+	BIOS::ADC::CopySegment( m_nRawFirst, m_nLength, m_nCaptured * m_nLength );
+	m_arrTimestamp[m_nCaptured++] = BIOS::SYS::GetTick();
+	return IsComplete();
+}
+
+/*static*/ bool CCoreSequence::IsComplete()
+{
+	return m_nSegments > 0 && m_nCaptured >= m_nSegments;
+}
+
+/*static*/ int CCoreSequence::GetCount()
+{
+	return m_nCaptured;
+}
+
+/*static*/ int CCoreSequence::GetLength()
+{
+	return m_nLength;
+}
+
+/*static*/ ui32 CCoreSequence::GetTimestamp(int nSegment)
+{
+	_ASSERT( nSegment >= 0 && nSegment < m_nCaptured );
+	return m_arrTimestamp[nSegment] - m_arrTimestamp[0];
+}
+
+/*static*/ void CCoreSequence::Replay(int nSegment)
+{
+	if ( m_nCaptured == 0 )
+		return;
+	UTILS.Clamp<int>( nSegment, 0, m_nCaptured-1 );
+	if ( m_nCorrection == CResampler::Unity )
+	{
+		CCaptureStore::Load( nSegment * m_nLength, m_nFirst, m_nLength );
+		return;
+	}
+
+	// same reconstruction as CResampler, the kernel is limited to the segment
+	const BIOS::ADC::TSample* pSegment = &BIOS::ADC::GetAt( nSegment * m_nLength );
+	const ui8* pCH1 = (const ui8*)pSegment;
+	const ui8* pCH2 = (const ui8*)pSegment + 1;
+	const int nStride = sizeof(BIOS::ADC::TSample);
+	const int nShift = CResampler::FractionBits - CInterpolator::FractionBits;
+
+	CCaptureStore::Clear();
+	for ( int i = 0; i < m_nLength; i++ )
+	{
+		int nPosition = ( m_nPhase + i * m_nCorrection ) >> nShift;
+		int nBase = min( nPosition >> CInterpolator::FractionBits, m_nLength-1 );
+		int nCH1 = CInterpolator::GetAt( pCH1, nStride, m_nLength, nPosition );
+		int nCH2 = CInterpolator::GetAt( pCH2, nStride, m_nLength, nPosition );
+		CCaptureStore::Set( m_nFirst + i, ( pSegment[nBase] & 0x00ff0000 ) | ( nCH2 << 8 ) | nCH1 );
+	}
+	CCaptureStore::SetValid( m_nFirst, m_nLength );
+}
@@ -0,0 +1,45 @@
+#ifndef __CORESEQUENCE_H__
+#define __CORESEQUENCE_H__
+
+#include <Source/HwLayer/Types.h>
+#include "CaptureStore.h"
+
+// Segmented (sequence) acquisition, the ADC memory is split into equal segments
+// and every trigger fills the next one. Segments are stored directly in the
+// ADC buffer, the capture store is used to replay them one by one. The
+// segments hold raw samples, the replay corrects their rate like CResampler
+class CCoreSequence
+{
+public:
+	enum {
+		// a segment is at least one screen wide, only a few of them fit into
+		// the part of the ADC buffer surviving Update on ARM
+		MinLength = 300,
+		MaxSegments = CCaptureStore::RawLength / MinLength
+	};
+
+private:
+	static ui32 m_arrTimestamp[MaxSegments];
+	static int m_nSegments;
+	static int m_nCaptured;
+	static int m_nLength;
+	static int m_nFirst;
+	// timebase correction of the sequence, the raw segment starts at m_nFirst
+	// * m_nCorrection / Unity, m_nPhase is the fraction of that position
+	static int m_nCorrection;
+	static int m_nRawFirst;
+	static int m_nPhase;
+
+public:
+	static void Reset();
+	// read the segment after the ADC is ready, returns true when the sequence is complete
+	static bool Acquire();
+	static bool IsComplete();
+	static int GetCount();
+	static int GetLength();
+	// trigger time relative to the first segment in ms
+	static ui32 GetTimestamp(int nSegment);
+	static void Replay(int nSegment);
+};
+
+#endif
@@ -0,0 +1,38 @@
+#include "CoreShared.h"
+#include "CoreEts.h"
+#include "CorePeak.h"
+#include "CoreAverage.h"
+#include "CorePhosphor.h"
+#include <Source/Gui/Spectrum/Controls/SpectrumGraph.h>
+
+// the engines are laid over each other
+union TShared
+{
+	CCoreEts::TBins ets;
+	CCorePeak::TEnvelope peak;
+	CCoreAverage::TAccumulators average;
+	CCorePhosphor::TCells phosphor;
+	CWndSpectrographTempl::TRing spectrograph;
+};
+
+static TShared g_shared;
+/*static*/ CCoreShared::EOwner CCoreShared::m_eOwner = CCoreShared::None;
+
+/*static*/ bool CCoreShared::Claim(EOwner eOwner)
+{
+	if ( eOwner < Ets && CCoreEts::IsActive() )
+		return false;
+	if ( eOwner < Peak && CCorePeak::IsActive() )
+		return false;
+	if ( eOwner < Average && CCoreAverage::IsActive() )
+		return false;
+	if ( eOwner < Phosphor && CCorePhosphor::IsActive() )
+		return false;
+	m_eOwner = eOwner;
+	return true;
+}
+
+/*static*/ void* CCoreShared::GetBuffer()
+{
+	return &g_shared;
+}
@@ -0,0 +1,37 @@
+#ifndef __CORESHARED_H__
+#define __CORESHARED_H__
+
+#include <Source/HwLayer/Types.h>
+
+// Buffer shared by the engines that keep their state between acquisitions.
+// Only one of them can hold it, the enabled engine of the highest priority
+// wins and the others are paused until it is disabled. An engine taking the
+// buffer over from another one starts again from its reset state
+class CCoreShared
+{
+public:
+	// ascending priority
+	enum EOwner {
+		None,
+		Spectrograph,
+		Phosphor,
+		Average,
+		Peak,
+		Ets
+	};
+
+private:
+	static EOwner m_eOwner;
+
+public:
+	// false while an engine of higher priority is enabled, the caller has to
+	// reset its state when it was not the owner before
+	static bool Claim(EOwner eOwner);
+	static bool IsOwner(EOwner eOwner)
+	{
+		return m_eOwner == eOwner;
+	}
+	static void* GetBuffer();
+};
+
+#endif
@@ -0,0 +1,55 @@
+#include "Interpolator.h"
+#include <Source/Core/Utils.h>
+
+// Blackman windowed sinc, phase p is the position p/Phases after the sample
+// Taps/2-1 of the window. The phases sum to unity with the rounding error in
+// the largest tap, phase 0 passes the sample through with 0x7fff
+/*static*/ const si16 CInterpolator::m_arrKernel[CInterpolator::Phases][CInterpolator::Taps] = {
+	{ 0, 0, 0, 32767, 0, 0, 0, 0 },
+	{ -38, 312, -1432, 32523, 1733, -383, 53, 0 },
+	{ -63, 549, -2560, 31803, 3750, -831, 121, -1 },
+	{ -76, 715, -3389, 30625, 6024, -1332, 204, -3 },
+	{ -79, 814, -3935, 29029, 8516, -1869, 299, -7 },
+	{ -75, 854, -4223, 27062, 11178, -2419, 404, -13 },
+	{ -67, 845, -4281, 24782, 13952, -2955, 513, -21 },
+	{ -56, 796, -4146, 22261, 16771, -3446, 620, -32 },
+	{ -44, 718, -3855, 19565, 19565, -3855, 718, -44 },
+	{ -32, 620, -3446, 16771, 22261, -4146, 796, -56 },
+	{ -21, 513, -2955, 13952, 24782, -4281, 845, -67 },
+	{ -13, 404, -2419, 11178, 27062, -4223, 854, -75 },
+	{ -7, 299, -1869, 8516, 29029, -3935, 814, -79 },
+	{ -3, 204, -1332, 6024, 30625, -3389, 715, -76 },
+	{ -1, 121, -831, 3750, 31803, -2560, 549, -63 },
+	{ 0, 53, -383, 1733, 32523, -1432, 312, -38 }
+};
+
+/*static*/ void CInterpolator::Process(const ui8* pSamples, int nStride, int nLength, int nBegin, int nStep, ui8* pOut, int nCount)
+{
+	for ( int i = 0; i < nCount; i++, nBegin += nStep )
+	{
+		const si16* pKernel = GetKernel( nBegin );
+		int nFirst = ( nBegin >> FractionBits ) - (Taps/2 - 1);
+		if ( nFirst >= 0 && nFirst + Taps <= nLength )
+		{
+			pOut[i] = (ui8)Apply( pKernel, pSamples + nFirst * nStride, nStride );
+			continue;
+		}
+
+		// the kernel reaches over the ends of the record
+		ui8 arrWindow[Taps];
+		for ( int j = 0; j < Taps; j++ )
+		{
+			int nIndex = nFirst + j;
+			UTILS.Clamp<int>( nIndex, 0, nLength-1 );
+			arrWindow[j] = pSamples[nIndex * nStride];
+		}
+		pOut[i] = (ui8)Apply( pKernel, arrWindow );
+	}
+}
+
+/*static*/ int CInterpolator::GetAt(const ui8* pSamples, int nStride, int nLength, int nPosition)
+{
+	ui8 nValue;
+	Process( pSamples, nStride, nLength, nPosition, 0, &nValue, 1 );
+	return nValue;
+}
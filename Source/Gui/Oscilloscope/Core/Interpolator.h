@@ -0,0 +1,49 @@
+#ifndef __INTERPOLATOR_H__
+#define __INTERPOLATOR_H__
+
+#include <Source/HwLayer/Types.h>
+
+// Band limited interpolation of the analog samples. A Blackman windowed sinc
+// of Taps coefficients is tabulated in Q15 for Phases sub-sample positions,
+// so an output sample costs Taps multiply-accumulates and no float math. At
+// the sample positions the kernel passes the input through unchanged, the
+// record is extended by its first and last sample
+class CInterpolator
+{
+public:
+	enum {
+		// the table takes Taps*Phases*2 bytes of flash
+		Taps = 8,
+		PhaseBits = 4,
+		Phases = 1<<PhaseBits,
+		// positions are given with an 8 bit fraction
+		FractionBits = 8,
+		Unity = 1<<FractionBits,
+		KernelBits = 15
+	};
+
+private:
+	static const si16 m_arrKernel[Phases][Taps];
+
+public:
+	// nCount samples at the positions nBegin + i*nStep, the input samples are
+	// nStride bytes apart
+	static void Process(const ui8* pSamples, int nStride, int nLength, int nBegin, int nStep, ui8* pOut, int nCount);
+	static int GetAt(const ui8* pSamples, int nStride, int nLength, int nPosition);
+
+	// coefficients for the samples base-Taps/2+1 .. base+Taps/2 of the position
+	static const si16* GetKernel(int nFraction)
+	{
+		return m_arrKernel[ (nFraction & (Unity-1)) >> (FractionBits - PhaseBits) ];
+	}
+	static int Apply(const si16* pKernel, const ui8* pSamples, int nStride = 1)
+	{
+		int nSum = 1 << (KernelBits-1);
+		for ( int i = 0; i < Taps; i++, pSamples += nStride )
+			nSum += pKernel[i] * *pSamples;
+		nSum >>= KernelBits;
+		return nSum < 0 ? 0 : nSum > 255 ? 255 : nSum;
+	}
+};
+
+#endif
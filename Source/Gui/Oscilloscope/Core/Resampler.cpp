@@ -0,0 +1,85 @@
+#include "Resampler.h"
+#include "Interpolator.h"
+
+// CH1 and CH2 of the samples covered by the kernel at nBase
+/*static*/ void CResampler::_LoadWindow(const BIOS::ADC::TSample* pSamples, int nCount, int nBase, ui8* pCh1, ui8* pCh2)
+{
+	for ( int i = 0; i < CInterpolator::Taps; i++ )
+	{
+		int nIndex = nBase - (CInterpolator::Taps/2 - 1) + i;
+		nIndex = max( 0, min( nIndex, nCount-1 ) );
+		pCh1[i] = (ui8)pSamples[nIndex];
+		pCh2[i] = (ui8)(pSamples[nIndex] >> 8);
+	}
+}
+
+/*static*/ void CResampler::Process(BIOS::ADC::TSample* pSamples, int nCount, int nCorrection)
+{
+	if ( nCorrection == Unity )
+		return;
+
+	if ( nCorrection < Unity )
+	{
+		// shrink, output sample i is built around the sample i*nCorrection < i,
+		// go backwards so the inputs are not overwritten before they are used.
+		// The kernel reaches a few samples past i, it reads them from windows
+		// holding the original values, the base moves by one sample at most
+		ui8 arrCh1[CInterpolator::Taps], arrCh2[CInterpolator::Taps];
+		ui32 nPhase = (nCount-1) * nCorrection;
+		int nWindow = nPhase >> FractionBits;
+		_LoadWindow( pSamples, nCount, nWindow, arrCh1, arrCh2 );
+		for ( int i = nCount-1; i >= 1; i--, nPhase -= nCorrection )
+		{
+			int nBase = nPhase >> FractionBits;
+			if ( nBase != nWindow )
+			{
+				BIOS::ADC::TSample nFirst = pSamples[ max( nBase - (CInterpolator::Taps/2 - 1), 0 ) ];
+				memmove( arrCh1 + 1, arrCh1, CInterpolator::Taps - 1 );
+				memmove( arrCh2 + 1, arrCh2, CInterpolator::Taps - 1 );
+				arrCh1[0] = (ui8)nFirst;
+				arrCh2[0] = (ui8)(nFirst >> 8);
+				nWindow = nBase;
+			}
+
+			const si16* pKernel = CInterpolator::GetKernel( (nPhase & (Unity-1)) >> (FractionBits - CInterpolator::FractionBits) );
+			ui32 nA = (ui32)pSamples[nBase];
+			int nCh1 = CInterpolator::Apply( pKernel, arrCh1 );
+			int nCh2 = CInterpolator::Apply( pKernel, arrCh2 );
+			pSamples[i] = ( pSamples[i] & 0xff000000 ) | ( nA & 0x00ff0000 ) | ( nCh2 << 8 ) | nCh1;
+		}
+	} else
+	{
+		// expand, output sample i is built around the sample i*nCorrection >= i,
+		// go forward. The kernel reaches a few samples behind i, the windows keep
+		// their original values, the end of the record is padded with the last sample
+		ui8 arrCh1[CInterpolator::Taps], arrCh2[CInterpolator::Taps];
+		ui32 nPhase = 0;
+		ui32 nLast = (nCount-1) << FractionBits;
+		int nWindow = 0;
+		_LoadWindow( pSamples, nCount, nWindow, arrCh1, arrCh2 );
+		for ( int i = 0; i < nCount; i++, nPhase += nCorrection )
+		{
+			if ( nPhase >= nLast )
+			{
+				pSamples[i] = ( pSamples[nCount-1] & 0x00ffffff ) | ( pSamples[i] & 0xff000000 );
+				continue;
+			}
+
+			int nBase = nPhase >> FractionBits;
+			for ( ; nWindow < nBase; nWindow++ )
+			{
+				BIOS::ADC::TSample nNext = pSamples[ min( nWindow + 1 + CInterpolator::Taps/2, nCount-1 ) ];
+				memmove( arrCh1, arrCh1 + 1, CInterpolator::Taps - 1 );
+				memmove( arrCh2, arrCh2 + 1, CInterpolator::Taps - 1 );
+				arrCh1[CInterpolator::Taps-1] = (ui8)nNext;
+				arrCh2[CInterpolator::Taps-1] = (ui8)(nNext >> 8);
+			}
+
+			const si16* pKernel = CInterpolator::GetKernel( (nPhase & (Unity-1)) >> (FractionBits - CInterpolator::FractionBits) );
+			ui32 nA = (ui32)pSamples[nBase];
+			int nCh1 = CInterpolator::Apply( pKernel, arrCh1 );
+			int nCh2 = CInterpolator::Apply( pKernel, arrCh2 );
+			pSamples[i] = ( pSamples[i] & 0xff000000 ) | ( nA & 0x00ff0000 ) | ( nCh2 << 8 ) | nCh1;
+		}
+	}
+}
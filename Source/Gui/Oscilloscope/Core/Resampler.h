@@ -0,0 +1,29 @@
+#ifndef __RESAMPLER_H__
+#define __RESAMPLER_H__
+
+#include <Source/HwLayer/Types.h>
+#include <Source/HwLayer/Bios.h>
+
+// Resampler correcting the sample rate of the fast timebases. The phase of
+// output sample i is i*nCorrection/1024 samples of the input, it is tracked
+// by a fixed point accumulator (10 bit fraction), so there is no division in
+// the loop. Works in place, CH1/CH2 are interpolated, CH3/CH4 are taken from
+// the preceding sample and the top byte (application scratch) is preserved.
+// Both directions reconstruct CH1/CH2 by the windowed sinc of CInterpolator
+class CResampler
+{
+public:
+	enum {
+		FractionBits = 10,
+		Unity = 1<<FractionBits
+	};
+
+public:
+	// nCorrection < Unity shrinks the time axis, > Unity expands it
+	static void Process(BIOS::ADC::TSample* pSamples, int nCount, int nCorrection);
+
+private:
+	static void _LoadWindow(const BIOS::ADC::TSample* pSamples, int nCount, int nBase, ui8* pCh1, ui8* pCh2);
+};
+
+#endif
@@ -0,0 +1,332 @@
+#include "SoftTrigger.h"
+#include <Source/Core/Settings.h>
+
+/*static*/ CSoftTrigger::TSource CSoftTrigger::GetSource(int nSource, TGetSample pMath /*= NULL*/)
+{
+	TSource src = { NULL, NULL, NULL };
+	switch ( nSource )
+	{
+	case CSettings::Trigger::_CH1:
+		src.pAnalog = CCaptureStore::GetAnalog( CCaptureStore::CH1 );
+		break;
+	case CSettings::Trigger::_CH2:
+		src.pAnalog = CCaptureStore::GetAnalog( CCaptureStore::CH2 );
+		break;
+	case CSettings::Trigger::_CH3:
+		src.pDigital = CCaptureStore::GetDigital( CCaptureStore::CH3 );
+		break;
+	case CSettings::Trigger::_CH4:
+		src.pDigital = CCaptureStore::GetDigital( CCaptureStore::CH4 );
+		break;
+	default:
+		src.pGetSample = pMath;
+	}
+	return src;
+}
+
+/*static*/ void CSoftTrigger::GetCondition(TCondition& cond)
+{
+	// the hardware trigger type selects the polarity and the time condition
+	bool bRising = false;
+	switch ( Settings.Trig.Type )
+	{
+	case CSettings::Trigger::_EdgeLH:
+	case CSettings::Trigger::_LevelHigh:
+	case CSettings::Trigger::_LowerDTHigh:
+	case CSettings::Trigger::_GreaterDTHigh:
+		bRising = true;
+		break;
+	default:
+		break;
+	}
+
+	cond.eType = (EType)(NATIVEENUM)Settings.Trig.Soft;
+	cond.nPolarity = bRising ? 1 : -1;
+	cond.nLevel = Settings.Trig.nLevel;
+	cond.nLevel2 = Settings.Trig.nLevel2;
+	cond.nHysteresis = Hysteresis;
+	cond.nTime = Settings.Trig.nTime;
+	cond.bLower = Settings.Trig.Type == CSettings::Trigger::_LowerDTLow ||
+		Settings.Trig.Type == CSettings::Trigger::_LowerDTHigh;
+}
+
+/*static*/ int CSoftTrigger::_GetAt(const TSource& src, int i)
+{
+	if ( src.pAnalog )
+		return src.pAnalog[i];
+	if ( src.pDigital )
+		return ( (src.pDigital[i >> 5] >> (i & 31)) & 1 ) ? 255 : 0;
+	return src.pGetSample( i );
+}
+
+// end of the word containing sample i, the scalar source has no words
+/*static*/ int CSoftTrigger::_GetGranule(const TSource& src, int i, int nEnd)
+{
+	if ( src.pAnalog )
+		return min( (i | 3) + 1, nEnd );
+	if ( src.pDigital )
+		return min( (i | 31) + 1, nEnd );
+	return nEnd;
+}
+
+// skips whole words where every sample is inside (bInside) or every sample is
+// outside of [nLow, nHigh], returns the first sample that has to be examined
+/*static*/ int CSoftTrigger::_Skip(const TSource& src, int i, int nEnd, int nLow, int nHigh, bool bInside)
+{
+	if ( src.pAnalog )
+	{
+		if ( i & 3 )
+			return i;
+		nLow = max( nLow, 0 );
+		nHigh = min( nHigh, 255 );
+		if ( nLow > nHigh )
+			return bInside ? i : i + ( (nEnd - i) & ~3 );
+
+		// a bound at the end of the sample range does not need a comparison,
+		// that is the case of the comparator in FindEdge
+		const TWord* pWords = (const TWord*)src.pAnalog;
+		TWord nLowLanes = nLow * 0x01010101;
+		TWord nHighLanes = nHigh * 0x01010101;
+		TWord nAll = bInside ? 0x01010101 : 0;
+		if ( nLow == 0 )
+		{
+			for ( ; i + 4 <= nEnd; i += 4 )
+				if ( CCaptureStore::_GreaterEqualBytes( nHighLanes, pWords[i >> 2] ) != nAll )
+					break;
+		} else
+		if ( nHigh == 255 )
+		{
+			for ( ; i + 4 <= nEnd; i += 4 )
+				if ( CCaptureStore::_GreaterEqualBytes( pWords[i >> 2], nLowLanes ) != nAll )
+					break;
+		} else
+		{
+			for ( ; i + 4 <= nEnd; i += 4 )
+			{
+				TWord nWord = pWords[i >> 2];
+				TWord nInside = CCaptureStore::_GreaterEqualBytes( nWord, nLowLanes ) &
+					CCaptureStore::_GreaterEqualBytes( nHighLanes, nWord );
+				if ( nInside != nAll )
+					break;
+			}
+		}
+		return i;
+	}
+	if ( src.pDigital )
+	{
+		if ( i & 31 )
+			return i;
+		bool bZero = ( nLow <= 0 && 0 <= nHigh ) == bInside;
+		bool bOne = ( nLow <= 255 && 255 <= nHigh ) == bInside;
+		for ( ; i + 32 <= nEnd; i += 32 )
+		{
+			TWord nWord = src.pDigital[i >> 5];
+			if ( ( nWord != 0 && !bOne ) || ( nWord != 0xffffffff && !bZero ) )
+				break;
+		}
+		return i;
+	}
+	return i;
+}
+
+// digital source with both thresholds between the rails, the comparator output
+// is the bit itself. A word holding only the current state is skipped, the
+// others are walked bit by bit, with an edge every few samples nothing can be
+// skipped and this runs at the speed of a plain per sample loop
+/*static*/ int CSoftTrigger::_FindBitEdge(const TWord* pBits, int nBegin, int nEnd, int nRising, int& nState)
+{
+	int i = nBegin;
+	int nCur = nState;
+	if ( nCur == -1 && i < nEnd )
+	{
+		nCur = (pBits[i >> 5] >> (i & 31)) & 1;
+		i++;
+	}
+	while ( i < nEnd )
+	{
+		TWord nWord = pBits[i >> 5];
+		int nLast = min( (i | 31) + 1, nEnd );
+		if ( !(i & 31) && nWord == ( nCur ? 0xffffffff : 0 ) )
+		{
+			i = nLast;
+			continue;
+		}
+		for ( ; i < nLast; i++ )
+		{
+			int nBit = (nWord >> (i & 31)) & 1;
+			if ( nBit == nCur )
+				continue;
+			nCur = nBit;
+			if ( nRising == 0 || (nRising > 0) == (nBit == 1) )
+			{
+				nState = nCur;
+				return i;
+			}
+		}
+	}
+	nState = nCur;
+	return -1;
+}
+
+/*static*/ int CSoftTrigger::FindEdge(const TSource& src, int nBegin, int nEnd, int nLow, int nHigh, int nRising, int& nState)
+{
+	if ( src.pDigital && nLow > 0 && nHigh < 255 )
+		return _FindBitEdge( src.pDigital, nBegin, nEnd, nRising, nState );
+
+	for ( int i = nBegin; i < nEnd; )
+	{
+		// while the output is known only a sample beyond the opposite
+		// threshold can change it
+		if ( nState == 0 )
+			i = _Skip( src, i, nEnd, -0x8000, nHigh, true );
+		else if ( nState == 1 )
+			i = _Skip( src, i, nEnd, nLow, 0x7fff, true );
+
+		for ( int nGranule = _GetGranule( src, i, nEnd ); i < nGranule; i++ )
+		{
+			int nSample = _GetAt( src, i );
+			int nNewState = nState;
+			if ( nSample > nHigh )
+				nNewState = 1;
+			if ( nSample < nLow )
+				nNewState = 0;
+			if ( nNewState == nState )
+				continue;
+
+			bool bKnown = nState != -1;
+			nState = nNewState;
+			if ( bKnown && ( nRising == 0 || (nRising > 0) == (nNewState == 1) ) )
+				return i;
+		}
+	}
+	return -1;
+}
+
+/*static*/ int CSoftTrigger::FindRange(const TSource& src, int nBegin, int nEnd, int nLow, int nHigh, bool bInside)
+{
+	for ( int i = nBegin; i < nEnd; )
+	{
+		i = _Skip( src, i, nEnd, nLow, nHigh, !bInside );
+		for ( int nGranule = _GetGranule( src, i, nEnd ); i < nGranule; i++ )
+		{
+			int nSample = _GetAt( src, i );
+			if ( ( nSample >= nLow && nSample <= nHigh ) == bInside )
+				return i;
+		}
+	}
+	return -1;
+}
+
+/*static*/ int CSoftTrigger::Scan(const TSource& src, const TCondition& cond, int nBegin, int nEnd, ui16* pCandidates, int nMax)
+{
+	if ( !src.pAnalog && !src.pDigital && !src.pGetSample )
+		return 0;
+
+	int nLow = min( cond.nLevel, cond.nLevel2 );
+	int nHigh = max( cond.nLevel, cond.nLevel2 );
+	int nHyst = cond.nHysteresis;
+	bool bPositive = cond.nPolarity > 0;
+	int nState = -1;
+	int nCount = 0;
+
+	for ( int i = nBegin; i < nEnd && nCount < nMax; )
+	{
+		int nCandidate = -1;
+		switch ( cond.eType )
+		{
+		case Edge:
+		{
+			nCandidate = FindEdge( src, i, nEnd, cond.nLevel - nHyst, cond.nLevel + nHyst, cond.nPolarity, nState );
+			if ( nCandidate < 0 )
+				return nCount;
+			i = nCandidate + 1;
+			break;
+		}
+		case Pulse:
+		{
+			// pulse between the leading and trailing edge, the candidate is the
+			// trailing edge where the width is known
+			int nLead = FindEdge( src, i, nEnd, cond.nLevel - nHyst, cond.nLevel + nHyst, cond.nPolarity, nState );
+			if ( nLead < 0 )
+				return nCount;
+			int nTrail = FindEdge( src, nLead + 1, nEnd, cond.nLevel - nHyst, cond.nLevel + nHyst, -cond.nPolarity, nState );
+			if ( nTrail < 0 )
+				return nCount;
+			int nWidth = nTrail - nLead;
+			if ( cond.bLower ? nWidth < cond.nTime : nWidth > cond.nTime )
+				nCandidate = nTrail;
+			i = nTrail + 1;
+			break;
+		}
+		case Runt:
+		{
+			// positive runt crosses the low level and falls back without reaching
+			// the high level, negative runt is the mirror image
+			int nLevel = bPositive ? nLow : nHigh;
+			int nLead = FindEdge( src, i, nEnd, nLevel - nHyst, nLevel + nHyst, cond.nPolarity, nState );
+			if ( nLead < 0 )
+				return nCount;
+			int nTrail = FindEdge( src, nLead + 1, nEnd, nLevel - nHyst, nLevel + nHyst, -cond.nPolarity, nState );
+			if ( nTrail < 0 )
+				return nCount;
+			int nPeak = bPositive ? FindRange( src, nLead, nTrail, -0x8000, nHigh, false ) :
+				FindRange( src, nLead, nTrail, nLow, 0x7fff, false );
+			if ( nPeak < 0 )
+				nCandidate = nTrail;
+			i = nTrail + 1;
+			break;
+		}
+		case Window:
+		{
+			// the signal has to settle inside the window (with hysteresis margin)
+			// before leaving it counts
+			int nInside = FindRange( src, i, nEnd, nLow + nHyst, nHigh - nHyst, true );
+			if ( nInside < 0 )
+				return nCount;
+			nCandidate = FindRange( src, nInside, nEnd, nLow, nHigh, false );
+			if ( nCandidate < 0 )
+				return nCount;
+			i = nCandidate + 1;
+			break;
+		}
+		case Slew:
+		{
+			// transition time from one level to the other, a transition that turns
+			// back before reaching the far level is dropped
+			int nFrom = bPositive ? nLow : nHigh;
+			int nStart = FindEdge( src, i, nEnd, nFrom - nHyst, nFrom + nHyst, cond.nPolarity, nState );
+			if ( nStart < 0 )
+				return nCount;
+			int nStop = bPositive ? FindRange( src, nStart, nEnd, -0x8000, nHigh, false ) :
+				FindRange( src, nStart, nEnd, nLow, 0x7fff, false );
+			int nBack = FindEdge( src, nStart + 1, nStop < 0 ? nEnd : nStop, nFrom - nHyst, nFrom + nHyst, -cond.nPolarity, nState );
+			if ( nBack >= 0 )
+			{
+				i = nBack + 1;
+				break;
+			}
+			if ( nStop < 0 )
+				return nCount;
+			int nTime = nStop - nStart;
+			if ( cond.bLower ? nTime < cond.nTime : nTime > cond.nTime )
+				nCandidate = nStop;
+			i = nStop + 1;
+			break;
+		}
+		default:
+			return nCount;
+		}
+
+		if ( nCandidate >= 0 )
+			pCandidates[nCount++] = (ui16)nCandidate;
+	}
+	return nCount;
+}
+
+/*static*/ int CSoftTrigger::Find(const TSource& src, const TCondition& cond, int nBegin, int nEnd)
+{
+	ui16 nCandidate;
+	if ( Scan( src, cond, nBegin, nEnd, &nCandidate, 1 ) == 0 )
+		return -1;
+	return nCandidate;
+}
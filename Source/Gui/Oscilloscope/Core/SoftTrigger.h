@@ -0,0 +1,78 @@
+#ifndef __SOFTTRIGGER_H__
+#define __SOFTTRIGGER_H__
+
+#include <Source/HwLayer/Types.h>
+#include "CaptureStore.h"
+
+// Software trigger working on the capture store. All trigger types are built
+// from two primitives, a comparator with hysteresis (FindEdge) and a window
+// test (FindRange). Both skip whole words of the plane that can not change
+// their result, so only the words containing a crossing are examined sample
+// by sample. Positions are sample indices of the capture, -1 means not found
+class CSoftTrigger
+{
+public:
+	typedef CCaptureStore::TWord TWord;
+	// scalar source, used for the Math channel
+	typedef int (*TGetSample)(int i);
+
+	// same order as CSettings::Trigger::Soft
+	enum EType {
+		Off,
+		Edge,
+		Pulse,
+		Runt,
+		Window,
+		Slew
+	};
+
+	enum {
+		Hysteresis = 2,
+		MaxCandidates = 64
+	};
+
+	// exactly one of the members is set, digital samples are 0 or 255
+	struct TSource
+	{
+		const ui8* pAnalog;
+		const TWord* pDigital;
+		TGetSample pGetSample;
+	};
+
+	struct TCondition
+	{
+		EType eType;
+		int nPolarity;		// 1 rising edge / positive pulse, -1 falling / negative
+		int nLevel;			// edge and pulse threshold
+		int nLevel2;		// runt, window and slew use both levels
+		int nHysteresis;
+		int nTime;			// pulse width or slew time in samples
+		bool bLower;		// time condition is "shorter than nTime"
+	};
+
+public:
+	// nSource as in CSettings::Trigger::Source, Math needs the scalar getter
+	static TSource GetSource(int nSource, TGetSample pMath = NULL);
+	// condition configured by the trigger menu
+	static void GetCondition(TCondition& cond);
+
+	// comparator output goes 1 above nHigh and 0 below nLow, returns the first
+	// change of the output in the direction of nRising (1, -1 or 0 for both).
+	// nState (-1 unknown, 0, 1) is carried between calls, the first resolution
+	// of an unknown state is not reported
+	static int FindEdge(const TSource& src, int nBegin, int nEnd, int nLow, int nHigh, int nRising, int& nState);
+	// first sample inside (bInside) or outside of [nLow, nHigh]
+	static int FindRange(const TSource& src, int nBegin, int nEnd, int nLow, int nHigh, bool bInside);
+
+	// one pass over [nBegin, nEnd) reporting up to nMax candidates, returns their number
+	static int Scan(const TSource& src, const TCondition& cond, int nBegin, int nEnd, ui16* pCandidates, int nMax);
+	static int Find(const TSource& src, const TCondition& cond, int nBegin, int nEnd);
+
+private:
+	static int _GetAt(const TSource& src, int i);
+	static int _Skip(const TSource& src, int i, int nEnd, int nLow, int nHigh, bool bInside);
+	static int _GetGranule(const TSource& src, int i, int nEnd);
+	static int _FindBitEdge(const TWord* pBits, int nBegin, int nEnd, int nRising, int& nState);
+};
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef __LISTAVERAGE_H__
+#define __LISTAVERAGE_H__
+
+class CWndListAverage : public CListBox
+{
+public:
+	CProviderEnum	m_proMode;
+	CProviderEnum	m_proCount;
+	CProviderEnum	m_proAccumulator;
+
+	CLPItem			m_itmMode;
+	CLPItem			m_itmCount;
+	CLPItem			m_itmAccumulator;
+
+public:
+	void Create( CWnd* pParent )
+	{
+		CListBox::Create( "Average", WsVisible | WsModal, CRect(120, 120, 319, 202), RGB565(404040), pParent );
+
+		m_proMode.Create( (const char**)CSettings::Display::ppszTextAverage,
+			(NATIVEENUM*)&Settings.Disp.Average, CSettings::Display::_AverageMax );
+		m_proCount.Create( (const char**)CSettings::Display::ppszTextAverageCount,
+			(NATIVEENUM*)&Settings.Disp.AverageCount, CSettings::Display::_AverageCountMax );
+		m_proAccumulator.Create( (const char**)CSettings::Display::ppszTextAccumulator,
+			(NATIVEENUM*)&Settings.Disp.Accumulator, CSettings::Display::_AccumulatorMax );
+
+		m_itmMode.Create( "Mode", CWnd::WsVisible, &m_proMode, this );
+		m_itmCount.Create( "Sweeps", CWnd::WsVisible, &m_proCount, this );
+		m_itmAccumulator.Create( "Accumulator", CWnd::WsVisible, &m_proAccumulator, this );
+	}
+};
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef __LISTPERSIST_H__
+#define __LISTPERSIST_H__
+
+class CWndListPersist : public CListBox
+{
+public:
+	CProviderEnum	m_proMode;
+	CProviderEnum	m_proHalfLife;
+
+	CLPItem			m_itmMode;
+	CLPItem			m_itmHalfLife;
+
+public:
+	void Create( CWnd* pParent )
+	{
+		CListBox::Create( "Persist", WsVisible | WsModal, CRect(120, 140, 319, 202), RGB565(404040), pParent );
+
+		m_proMode.Create( (const char**)CSettings::Display::ppszTextPersist,
+			(NATIVEENUM*)&Settings.Disp.Persist, CSettings::Display::_PersistMax );
+		m_proHalfLife.Create( (const char**)CSettings::Display::ppszTextHalfLife,
+			(NATIVEENUM*)&Settings.Disp.HalfLife, CSettings::Display::_HalfLifeMax );
+
+		m_itmMode.Create( "Mode", CWnd::WsVisible, &m_proMode, this );
+		m_itmHalfLife.Create( "Half-life", CWnd::WsVisible, &m_proHalfLife, this );
+	}
+};
+
+#endif
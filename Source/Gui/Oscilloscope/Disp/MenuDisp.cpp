@@ -46,26 +46,57 @@
 		MainWnd.m_wndTReferences.ShowWindow( SwShow );
 	}
 
+	// Average settings
 	if ( code == ToWord('l', 'e') && data == (ui32)&m_proAverage )
 	{
-		MainWnd.m_wndGraph.ClearAverage();
+		m_wndListAverage.Create( this );
+		m_wndListAverage.StartModal( &m_wndListAverage.m_itmCount );
 	}
+	if ( code == ToWord('o', 'k') && pSender->m_pParent == &m_wndListAverage )
+	{
+		m_wndListAverage.StopModal();
+		m_itmAverage.Invalidate();
+	}
+	if ( code == ToWord('e', 'x') && pSender == &m_wndListAverage )
+	{
+		m_wndListAverage.StopModal();
+		m_itmAverage.Invalidate();
+	}
+	if ( code == ToWord('u', 'p') && ( pSender == &m_itmAverage || pSender->m_pParent == &m_wndListAverage ) )
+	{
+		// the sweeps in the accumulators do not match the new settings
+		CCoreAverage::Reset();
+	}
+	// Persistence settings
 	if ( code == ToWord('l', 'e') && data == (ui32)&m_proPersist )
 	{	
 		MainWnd.m_wndGraph.ClearPersist();
+		m_wndListPersist.Create( this );
+		m_wndListPersist.StartModal( &m_wndListPersist.m_itmHalfLife );
+	}
+	if ( code == ToWord('o', 'k') && pSender->m_pParent == &m_wndListPersist )
+	{
+		m_wndListPersist.StopModal();
+		m_itmPersist.Invalidate();
+	}
+	if ( code == ToWord('e', 'x') && pSender == &m_wndListPersist )
+	{
+		m_wndListPersist.StopModal();
+		m_itmPersist.Invalidate();
+	}
+	if ( code == ToWord('u', 'p') && ( pSender == &m_itmPersist || pSender->m_pParent == &m_wndListPersist ) )
+	{
+		// the counters were collected with another half-life
+		CCorePhosphor::Reset();
 	}
 	if ( code == ToWord('u', 'p') && pSender == &m_itmAxes )
 	{	
+		// XY uses the counters of the phosphor in another layout
+		CCorePhosphor::Reset();
 		// force redraw background (invalidate is not enough)
 		MainWnd.m_wndGraph.ShowWindow( CWnd::SwHide );
 		MainWnd.m_wndGraph.ShowWindow( CWnd::SwShow );
 	}
-
-	/* // produces nice effect when not cleared :)
-	if ( code == ToWord('u', 'p') && pSender == &m_itmAverage )
-	{
-		MainWnd.m_wndGraph.ClearAverage();
-	}*/
 }
 
 
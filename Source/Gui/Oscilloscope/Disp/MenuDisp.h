@@ -7,6 +7,8 @@
 #include <Source/Gui/Oscilloscope/Controls/GraphOsc.h>
 
 #include "ItemDisp.h"
+#include "ListAverage.h"
+#include "ListPersist.h"
 
 class CWndMenuDisplay : public CWnd
 {
@@ -26,6 +28,9 @@ public:
 	CMPItem m_itmGrid;
 	CMPItem m_itmAxis;
 
+	CWndListAverage	m_wndListAverage;
+	CWndListPersist	m_wndListPersist;
+
 	virtual void		Create(CWnd *pParent, ui16 dwFlags);
 	virtual void		OnMessage(CWnd* pSender, ui16 code, ui32 data);
 };
@@ -54,7 +54,7 @@ public:
 		}
 		if ( nKey & BIOS::KEY::KeyEnter )
 		{
-			SendMessage(m_pParent, ToWord('m', 't'), (ui32)(NATIVEPTR)&m_proResolution);
+			SendMessage(m_pParent, ToWord('m', 't'), (ui32)(NATIVEPTR)m_pInfo);
 		}
 		CWnd::OnKey( nKey );
 	}
@@ -0,0 +1,28 @@
+#ifndef __LISTTIME_H__
+#define __LISTTIME_H__
+
+class CWndListTime : public CListBox
+{
+public:
+	CProviderEnum	m_proResolution;
+	CProviderEnum	m_proAcquire;
+
+	CLPItem			m_itmResolution;
+	CLPItem			m_itmAcquire;
+
+public:
+	void Create( CWnd* pParent )
+	{
+		CListBox::Create( "Timebase", WsVisible | WsModal, CRect(120, 80, 319, 150), RGB565(ffffff), pParent );
+
+		m_proResolution.Create( (const char**)CSettings::TimeBase::ppszTextResolution,
+			(NATIVEENUM*)&Settings.Time.Resolution, CSettings::TimeBase::_ResolutionMax );
+		m_proAcquire.Create( (const char**)CSettings::TimeBase::ppszTextAcquire,
+			(NATIVEENUM*)&Settings.Time.Acquire, CSettings::TimeBase::_AcquireMax );
+
+		m_itmResolution.Create( "Resolution", CWnd::WsVisible, &m_proResolution, this );
+		m_itmAcquire.Create( "Acquire", CWnd::WsVisible, &m_proAcquire, this );
+	}
+};
+
+#endif
@@ -11,6 +11,10 @@ public:
 	CProviderNum	m_proTime;
 	CProviderNum	m_proHoldoff;
 	CProviderNum	m_proTrigPosition;
+	CProviderNum	m_proSegments;
+	CProviderNum	m_proSegment;
+	CProviderEnum	m_proSoft;
+	CProviderNum	m_proLevel2;
 
 	CLPItem			m_itmSync;
 	CLPItem			m_itmType;
@@ -19,12 +23,16 @@ public:
 	CLPItem			m_itmTime;
 	CLPItem			m_itmHoldoff;
 	CLPItem			m_itmTrigPosition;
+	CLPItem			m_itmSegments;
+	CLPItem			m_itmSegment;
+	CLPItem			m_itmSoft;
+	CLPItem			m_itmLevel2;
 	// DSO does not allow to change the time offset
 
 public:
 	void Create( CWnd* pParent )
 	{
-		CListBox::Create( "Trigger", WsVisible | WsModal, CRect(120, 55, 319, 201), RGB565(404040), pParent );
+		CListBox::Create( "Trigger", WsVisible | WsModal, CRect(120, 7, 319, 233), RGB565(404040), pParent );
 
 		m_proSync.Create( (const char**)CSettings::Trigger::ppszTextSync,
 			(NATIVEENUM*)&Settings.Trig.Sync, CSettings::Trigger::_SyncMax );
@@ -36,6 +44,11 @@ public:
 		m_proTime.Create( &Settings.Trig.nTime, 0, 4096 );
 		m_proHoldoff.Create( &Settings.Trig.nHoldOff, 0, 4096 );
 		m_proTrigPosition.Create( &Settings.Trig.nPosition, 0, 4096 );
+		m_proSegments.Create( &Settings.Trig.nSegments, 2, CCoreSequence::MaxSegments );
+		m_proSegment.Create( &Settings.Trig.nSegment, 0, CCoreSequence::MaxSegments-1 );
+		m_proSoft.Create( (const char**)CSettings::Trigger::ppszTextSoft,
+			(NATIVEENUM*)&Settings.Trig.Soft, CSettings::Trigger::_SoftMax );
+		m_proLevel2.Create( &Settings.Trig.nLevel2, 0, 255 );
 
 		m_itmSync.Create( "Mode", CWnd::WsVisible, &m_proSync, this );
 		m_itmType.Create( "Type", CWnd::WsVisible, &m_proType, this );
@@ -44,6 +57,10 @@ public:
 		m_itmTime.Create( "Time", CWnd::WsVisible, &m_proTime, this );
 		m_itmHoldoff.Create( "HoldOff", CWnd::WsVisible, &m_proHoldoff, this );
 		m_itmTrigPosition.Create( "Trig. pos", CWnd::WsVisible, &m_proTrigPosition, this );
+		m_itmSegments.Create( "Segments", CWnd::WsVisible, &m_proSegments, this );
+		m_itmSegment.Create( "Segment", CWnd::WsVisible, &m_proSegment, this );
+		m_itmSoft.Create( "Software", CWnd::WsVisible, &m_proSoft, this );
+		m_itmLevel2.Create( "Threshold 2", CWnd::WsVisible, &m_proLevel2, this );
 	}
 };
 
@@ -56,6 +56,13 @@ LINKERSECTION(".extra")
 		// cancel
 		m_wndListTrigger.StopModal();
 	}
+	if ( code == ToWord('u', 'p') && pSender == &m_wndListTrigger.m_itmSegment )
+	{
+		// browse captured segments, acquisition is not affected
+		CCoreSequence::Replay( Settings.Trig.nSegment );
+		MainWnd.ShowCapture();
+		return;
+	}
 	if ( code == ToWord('u', 'p') && pSender->m_pParent == &m_wndListTrigger )
 	{
 		if ( pSender == &m_wndListTrigger.m_itmLevel )
@@ -76,10 +83,18 @@ LINKERSECTION(".extra")
 			BIOS::ADC::Restart();
 		}
 
-		Settings.Trig.State = (Settings.Trig.Sync == CSettings::Trigger::_Single) ? 
+		Settings.Trig.State = (Settings.Trig.Sync == CSettings::Trigger::_Single ||
+			Settings.Trig.Sync == CSettings::Trigger::_Seq) ? 
 			CSettings::Trigger::_Wait : CSettings::Trigger::_Run;;
+		CCoreSequence::Reset();
+		CCoreRoll::Reset();
+		CCoreEts::Reset();
+		// peak detect changes the sampling rate and is not used in every mode
+		if ( pSender == &m_wndListTrigger.m_itmSync )
+			CCoreOscilloscope::ConfigureAdc();
 
 		CCoreOscilloscope::ConfigureTrigger();
+		CCoreOscilloscope::UpdateConstants();
 		Settings.Trig.nLastChange = BIOS::SYS::GetTick();
 		// update
 		CWnd::GetTopModal().m_pPrevFocus->Invalidate();
@@ -93,17 +108,34 @@ LINKERSECTION(".extra")
 		// if the osccilloscope window is freezed, inform to redraw it
 		if ( !BIOS::ADC::Enabled() )
 		{
-			MainWnd.WindowMessage( CWnd::WmBroadcast, ToWord('d', 'g') );
+			MainWnd.ShowCapture();
 		}
 	}
 
 	// Timebase
 	if (code == ToWord('m', 't') )	// more timebase
 	{
-		m_wndComboSelector.Create( GetFocus()->m_pszId, WsVisible | WsModal, 
-			CRect( 30, 100, 370, 140), RGB565(ffffff), (CValueProvider*)(NATIVEPTR)data, this);
-
-		m_wndComboSelector.StartModal();
+		m_wndListTime.Create( this );
+		m_wndListTime.StartModal( &m_wndListTime.m_itmResolution );
+	}
+	if ( code == ToWord('o', 'k') && pSender->m_pParent == &m_wndListTime )
+	{
+		// done
+		m_wndListTime.StopModal();
+	}
+	if ( code == ToWord('e', 'x') && pSender == &m_wndListTime )
+	{
+		// cancel
+		m_wndListTime.StopModal();
+	}
+	if ( code == ToWord('u', 'p') && pSender->m_pParent == &m_wndListTime )
+	{
+		// both change the sampling rate, peak detect and high resolution
+		// also the processing of the capture
+		CCoreOscilloscope::ConfigureAdc();
+		CCoreOscilloscope::UpdateConstants();
+		// update
+		CWnd::GetTopModal().m_pPrevFocus->Invalidate();
 	}
 
 	// Digital
@@ -5,10 +5,12 @@
 #include <Source/Core/ListItems.h>
 #include <Source/Core/Settings.h>
 #include <Source/Gui/Oscilloscope/Controls/GraphOsc.h>
+#include <Source/Gui/Oscilloscope/Core/CoreOscilloscope.h>
 
 #include "ListAnalog.h"
 #include "ListDigital.h"
 #include "ListTrigger.h"
+#include "ListTime.h"
 #include "ItemAnalog.h"
 #include "ItemDigital.h"
 #include "ItemTime.h"
@@ -32,6 +34,7 @@ public:
 	CWndListDInput	m_wndListDInput;
 	CComboSelector	m_wndComboSelector;
 	CWndListTrigger	m_wndListTrigger;
+	CWndListTime	m_wndListTime;
 
 	CWndMenuInput();
 
@@ -28,13 +28,14 @@ public:
 			( m_pMarker2->Mode == CSettings::Marker::_Off );
 
 		ui16 clr = bDisabled ? RGB565(808080) : RGB565(000000);
+		ui16 clrBack = CDesign::MenuItemTextBack( HasFocus() );
 
 		CWndMenuItem::OnPaint();
 		int x = m_rcClient.left + 12 + MarginLeft;
 		int y = m_rcClient.top;
 		int _x = x;
 		x += 8;
-		x += BIOS::LCD::Print( x, y, clr, RGBTRANS, m_strId );
+		x += BIOS::LCD::Print( x, y, clr, clrBack, m_strId );
 		if ( bDisabled )
 			return;
 
@@ -45,7 +46,7 @@ public:
 		if ( m_pMarker1->Display == CSettings::Marker::_Raw )
 		{
 			int nResult = m_pMarker1->nValue - m_pMarker2->nValue;
-			x += BIOS::LCD::Print( x, y, clr, RGBTRANS, CUtils::itoa(nResult) );
+			x += BIOS::LCD::Print( x, y, clr, clrBack, CUtils::itoa(nResult) );
 		}
 		else
 		{
@@ -53,13 +54,13 @@ public:
 			{ 
 				float fTimeRes = Settings.Runtime.m_fTimeRes / CWndGraph::BlkX;
 				float fValue = fTimeRes * ( m_pMarker2->nValue - m_pMarker1->nValue );
-				x += BIOS::LCD::Printf( x, y, clr, RGBTRANS, "%f", fValue*1000 ) * 8;
+				x += BIOS::LCD::Printf( x, y, clr, clrBack, "%f", fValue*1000 ) * 8;
 				x += 2;
-				BIOS::LCD::Print( x, y, RGB565(404040), RGBTRANS, "ms");
+				BIOS::LCD::Print( x, y, RGB565(404040), clrBack, "ms");
 				x = _x;
 				y += 16;
 				if ( fValue == 0 )
-					BIOS::LCD::Print( x, y, clr, RGBTRANS, "Error");
+					BIOS::LCD::Print( x, y, clr, clrBack, "Error");
 				else
 				{
 					if ( fValue < 0 )
@@ -68,16 +69,16 @@ public:
 						fValue = 1.0f / fValue;
 					fValue /= 1000.0f; // kHz
 					fValue += 0.0001f; // sprintf rounding 
-					x += BIOS::LCD::Printf( x, y, clr, RGBTRANS, "%f", fValue ) * 8;
+					x += BIOS::LCD::Printf( x, y, clr, clrBack, "%f", fValue ) * 8;
 					x += 2;
-					BIOS::LCD::Print( x, y, RGB565(404040), RGBTRANS, "kHz");
+					BIOS::LCD::Print( x, y, RGB565(404040), clrBack, "kHz");
 				}
 			}
 			if ( m_pMarker1->Type == CSettings::Marker::_Voltage )
 			{
 				if ( m_pMarker1->Source != m_pMarker2->Source )
 				{
-					BIOS::LCD::Print( x, y, RGB565(808080), RGBTRANS, "Error");
+					BIOS::LCD::Print( x, y, RGB565(808080), clrBack, "Error");
 				} else
 				{
 					CSettings::Calibrator::FastCalc fastCalc;
@@ -89,9 +90,9 @@ public:
 					float fValue1 = Settings.CH1Calib.Voltage( fastCalc, (float)m_pMarker1->nValue );
 					float fValue2 = Settings.CH1Calib.Voltage( fastCalc, (float)m_pMarker2->nValue );
 					float fResult = fValue2 - fValue1;
-					x += BIOS::LCD::Printf( x, y, clr, RGBTRANS, "%f", fResult ) * 8;
+					x += BIOS::LCD::Printf( x, y, clr, clrBack, "%f", fResult ) * 8;
 					x += 2;
-					BIOS::LCD::Print( x, y, RGB565(404040), RGBTRANS, "V");
+					BIOS::LCD::Print( x, y, RGB565(404040), clrBack, "V");
 				}
 			}
 		}
@@ -21,6 +21,7 @@ public:
 			CSettings::Marker::_Off ) ? RGB565(000000) : RGB565(808080);
 		ui16 clr2 = ( m_pMarker->Mode != 
 			CSettings::Marker::_Off ) ? RGB565(404040) : RGB565(909090);
+		ui16 clrBack = CDesign::MenuItemTextBack( HasFocus() );
 
 		CWndMenuItem::OnPaint();
 		int x = m_rcClient.left + 12 + MarginLeft;
@@ -53,18 +54,18 @@ public:
 			x += 4;
 
 		if ( m_pMarker->Display == CSettings::Marker::_Raw )
-			x += BIOS::LCD::Print( x, y, clr, RGBTRANS, CUtils::itoa(m_pMarker->nValue) );
+			x += BIOS::LCD::Print( x, y, clr, clrBack, CUtils::itoa(m_pMarker->nValue) );
 		else
 		{
 			if ( m_pMarker->Type == CSettings::Marker::_Time )
 			{ 
 				float fTimeRes = Settings.Runtime.m_fTimeRes / CWndGraph::BlkX;
 				float fValue = fTimeRes * ( m_pMarker->nValue - ( Settings.Trig.nTime - Settings.Time.Shift) );
-				x += BIOS::LCD::Printf( x, y, clr, RGBTRANS, "%f", fValue*1000 ) * 8;
+				x += BIOS::LCD::Printf( x, y, clr, clrBack, "%f", fValue*1000 ) * 8;
 				if (!HasFocus())
 				{
 					x += 2;
-					BIOS::LCD::Print( x, y, clr2, RGBTRANS, "ms");
+					BIOS::LCD::Print( x, y, clr2, clrBack, "ms");
 				}
 			}
 			if ( m_pMarker->Type == CSettings::Marker::_Voltage )
@@ -76,11 +77,11 @@ public:
 					Settings.CH2Calib.Prepare( &Settings.CH2, fastCalc );
 
 				float fValue = Settings.CH1Calib.Voltage( fastCalc, (float)m_pMarker->nValue );
-				x += BIOS::LCD::Printf( x, y, clr, RGBTRANS, "%f", fValue ) * 8;
+				x += BIOS::LCD::Printf( x, y, clr, clrBack, "%f", fValue ) * 8;
 				if (!HasFocus())
 				{
 					x += 2;
-					BIOS::LCD::Print( x, y, clr2, RGBTRANS, "V");
+					BIOS::LCD::Print( x, y, clr2, clrBack, "V");
 				}
 			}
 		}
@@ -1,6 +1,7 @@
 #include "MenuMarker.h"
 
 #include <Source/Gui/MainWnd.h>
+#include <Source/Gui/Oscilloscope/Core/CaptureStore.h>
 
 CWndMenuCursor::CWndMenuCursor()
 {
@@ -15,6 +16,8 @@ CWndMenuCursor::CWndMenuCursor()
 	m_itmY2.Create( (char*)"Y2", &Settings.MarkY2, this );
 	m_itmDeltaY.Create( (char*)"dY", &Settings.MarkY1, &Settings.MarkY2, this);
 	m_itmDeltaX.Create( (char*)"dX", &Settings.MarkT1, &Settings.MarkT2, this);
+	m_bChangedY1 = false;
+	m_bChangedY2 = false;
 }
 
 /*virtual*/ void CWndMenuCursor::OnMessage(CWnd* pSender, ui16 code, ui32 data)
@@ -61,17 +64,26 @@ CWndMenuCursor::CWndMenuCursor()
 	}
 
 	// new waveform acquired, update the Y values 	
+	if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'a') )
+	{
+		if ( Sample( &Settings.MarkY1, &Settings.MarkT1 ) )
+			m_bChangedY1 = true;
+		if ( Sample( &Settings.MarkY2, &Settings.MarkT2 ) )
+			m_bChangedY2 = true;
+		return;
+	}
+
+	// the frame is painted, redraw the values which changed
 	if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'g') )
 	{
-		if ( Settings.MarkY1.Mode == CSettings::Marker::_Auto )
+		if ( m_bChangedY1 )
 			m_itmY1.Invalidate();
-		if ( Settings.MarkY2.Mode == CSettings::Marker::_Auto )
+		if ( m_bChangedY2 )
 			m_itmY2.Invalidate();
-		if ( Settings.MarkY1.Mode == CSettings::Marker::_Auto ||
-			 Settings.MarkY1.Mode == CSettings::Marker::_Auto )
-		{
+		if ( m_bChangedY1 || m_bChangedY2 )
 			m_itmDeltaY.Invalidate();
-		}
+		m_bChangedY1 = false;
+		m_bChangedY2 = false;
 		return;
 	}
 
@@ -111,7 +123,7 @@ void CWndMenuCursor::Find(CSettings::Marker* pMarker, CSettings::Marker::EFind m
 
 	for ( int i = nSampleBegin; i < nSampleEnd; i++ )
 	{
-		int nAdc = BIOS::ADC::GetAt(i);
+		int nAdc = CCaptureStore::GetAt(i);
 		if ( pMarker->Source == CSettings::Marker::_CH1 )
 			nAdc = (ui8)((nAdc) & 0xff);
 		else
@@ -164,3 +176,16 @@ void CWndMenuCursor::Find(CSettings::Marker* pMarker, CSettings::Marker::EFind m
 	}
 }
 
+bool CWndMenuCursor::Sample(CSettings::Marker* pMarker, const CSettings::Marker* pMarkerTime)
+{
+	// the same sample the graph reads for the marker line
+	if ( pMarker->Mode != CSettings::Marker::_Auto )
+		return false;
+	int nChannel = pMarker->Source == CSettings::Marker::_CH1 ? CCaptureStore::CH1 : CCaptureStore::CH2;
+	int nValue = CCaptureStore::GetAnalogAt( nChannel, pMarkerTime->nValue );
+	if ( nValue == pMarker->nValue )
+		return false;
+	pMarker->nValue = nValue;
+	return true;
+}
+
@@ -24,6 +24,10 @@ public:
 	
 	CWndListMarker		m_wndListCursor;
 
+	// automatic Y markers changed by the waveforms since the last frame
+	bool				m_bChangedY1;
+	bool				m_bChangedY2;
+
 	CWndMenuCursor();
 
 	virtual void		Create(CWnd *pParent, ui16 dwFlags);
@@ -31,6 +35,7 @@ public:
 
 private:
 	void				Find(CSettings::Marker* pMarker, CSettings::Marker::EFind mode);
+	bool				Sample(CSettings::Marker* pMarker, const CSettings::Marker* pMarkerTime);
 };
 
 #endif
\ No newline at end of file
@@ -47,12 +47,13 @@ int BlurFilter( int a, int b, int c )
 
 /*virtual*/ void CWndMenuMask::OnMessage(CWnd* pSender, ui16 code, ui32 data)
 {
-	if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'g') )
+	if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'a') )
 	{
 		if ( m_btnCollect.m_pszId != m_strStart )
 		{
 			CSettings::Calibrator::FastCalc Ch1fast;
 			Settings.CH1Calib.Prepare( &Settings.CH1, Ch1fast );
+			const ui8* pCH1 = CCaptureStore::GetAnalog( CCaptureStore::CH1, Settings.Time.Shift );
 
 			for ( int i = 0; i < CWndGraph::DivsX*CWndGraph::BlkX; i++ )
 			{
@@ -60,10 +61,7 @@ int BlurFilter( int a, int b, int c )
 				ui8* bHigh = NULL;
 				CCoreOscilloscope::GetMaskAt( i, &bLow, &bHigh );
 		
-				BIOS::ADC::SSample Sample;
-				Sample.nValue = BIOS::ADC::GetAt( Settings.Time.Shift + i );
-
-				si16 ch1 = Sample.CH1;
+				si16 ch1 = pCH1[i];
 				ch1 = Settings.CH1Calib.Correct( Ch1fast, ch1 );
 				UTILS.Clamp<si16>( ch1, 0, 255 );
 			
@@ -76,6 +74,7 @@ int BlurFilter( int a, int b, int c )
 			bool bFailure = false;
 			CSettings::Calibrator::FastCalc Ch1fast;
 			Settings.CH1Calib.Prepare( &Settings.CH1, Ch1fast );
+			const ui8* pCH1 = CCaptureStore::GetAnalog( CCaptureStore::CH1, Settings.Time.Shift );
 
 			for ( int i = 0; i < CWndGraph::DivsX*CWndGraph::BlkX; i++ )
 			{
@@ -83,10 +82,7 @@ int BlurFilter( int a, int b, int c )
 				ui8* bHigh = NULL;
 				CCoreOscilloscope::GetMaskAt( i, &bLow, &bHigh );
 		
-				BIOS::ADC::SSample Sample;
-				Sample.nValue = BIOS::ADC::GetAt( Settings.Time.Shift + i );
-
-				si16 ch1 = Sample.CH1;
+				si16 ch1 = pCH1[i];
 				ch1 = Settings.CH1Calib.Correct( Ch1fast, ch1 );
 				UTILS.Clamp<si16>( ch1, 0, 255 );
 
@@ -159,6 +155,7 @@ int BlurFilter( int a, int b, int c )
 	{
 		CSettings::Calibrator::FastCalc Ch1fast;
 		Settings.CH1Calib.Prepare( &Settings.CH1, Ch1fast );
+		const ui8* pCH1 = CCaptureStore::GetAnalog( CCaptureStore::CH1, Settings.Time.Shift );
 
 		for ( int i = 0; i < CWndGraph::DivsX*CWndGraph::BlkX; i++ )
 		{
@@ -166,10 +163,7 @@ int BlurFilter( int a, int b, int c )
 			ui8* bHigh = NULL;
 			CCoreOscilloscope::GetMaskAt( i, &bLow, &bHigh );
 		
-			BIOS::ADC::SSample Sample;
-			Sample.nValue = BIOS::ADC::GetAt( Settings.Time.Shift + i );
-
-			si16 ch1 = Sample.CH1;
+			si16 ch1 = pCH1[i];
 			ch1 = Settings.CH1Calib.Correct( Ch1fast, ch1 );
 			UTILS.Clamp<si16>( ch1, 0, 255 );
 			*bLow = (ui8)ch1;
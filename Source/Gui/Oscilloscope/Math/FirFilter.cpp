@@ -3,6 +3,7 @@
 #include <Source/Core/Utils.h>
 #include <Source/Core/BufferedIo.h>
 #include <Source/Gui/MainWnd.h>
+#include <Source/Gui/Oscilloscope/Core/CaptureStore.h>
 
 
 CFirFilter::CFirFilter()
@@ -16,17 +17,20 @@ ui8& CFirFilter::GetFirLength()
 	return m_nLength;
 }
 
+// the coefficients follow the mask below the capture store planes, the
+// ring buffer is reset every pass and takes the last 256 bytes of the store
+// scratch
 si8& CFirFilter::GetFirCoefficient(int nAt)
 {
-	BIOS::ADC::TSample& ts1 = BIOS::ADC::GetAt( nAt + 1024 + 256 );
+	BIOS::ADC::TSample& ts1 = BIOS::ADC::GetAt( nAt + 600 );
 	return ((si8*)&ts1)[3];
 
 }
 
 ui8& CFirFilter::GetRingBuffer(int nAt)
 {
-	BIOS::ADC::TSample& ts1 = BIOS::ADC::GetAt( nAt + 1024 );
-	return ((ui8*)&ts1)[3];
+	ui8* pScratch = (ui8*)&BIOS::ADC::GetAt( CCaptureStore::AtScratch );
+	return pScratch[CCaptureStore::ScratchLength - 256 + nAt];
 }
 
 void CFirFilter::PushRingBuffer(int n)
@@ -1,6 +1,6 @@
 class CBitDecoder {
 public:
-	virtual bool operator << (int nBit) = NULL;
+	virtual bool operator << (int nBit) = 0;
 };
 
 class CSerialDecoder : public CBitDecoder
@@ -59,8 +59,7 @@ public:
 		int nHigh = 0, nLow = 0;
 		for ( int i = nBegin; i < nEnd; i++ )
 		{
-			int nSample = BIOS::ADC::GetAt(i);
-			nSample = This()->_GetSample( nSample );
+			int nSample = This()->_GetSample( i );
 
 			if ( nSample > nTrigMax )
 				nHigh++;
@@ -72,25 +71,14 @@ public:
 
 	bool Do(TProcessFunc ProcessEdge)
 	{
-		int nNewState = -1, nTrigState = -1;
-		for ( int i = nBegin; i < nEnd; i++ )
+		int nTrigState = -1;
+		CSoftTrigger::TSource source = This()->_GetSource();
+		for ( int i = nBegin; ( i = CSoftTrigger::FindEdge( source, i, nEnd, nTrigMin, nTrigMax, 0, nTrigState ) ) >= 0; i++ )
 		{
-			int nSample = BIOS::ADC::GetAt(i);
-			nSample = This()->_GetSample( nSample );
-
-			if ( nSample > nTrigMax )
-				nNewState = 1;
-			if ( nSample < nTrigMin )
-				nNewState = 0;
-
-			if ( nTrigState != -1 && nNewState != nTrigState )
-			{
-				if ( nLast != -1 )
-					if ( !(this->*ProcessEdge)( i-nLast, nNewState ) )
-						return false;
-				nLast = i;
-			}
-			nTrigState = nNewState;
+			if ( nLast != -1 )
+				if ( !(this->*ProcessEdge)( i-nLast, nTrigState ) )
+					return false;
+			nLast = i;
 		}
 		//if ( !(this->*ProcessEdge)( nEnd-nLast, 1-nNewState ) )
 		//	return false;
@@ -6,6 +6,8 @@ class CItemMeas : public CWndMenuItem
 public:
 	CSettings::Measure* m_pMeas;
 	ui16	m_color;
+	// sign and digits as painted
+	char	m_strValue[10];
 
 public:
 	virtual void Create(CSettings::Measure* pMeas, CWnd *pParent) 
@@ -13,6 +15,7 @@ public:
 		_ASSERT( pMeas );
 		m_pMeas = pMeas;
 		m_color = Settings.CH1.u16Color;
+		m_strValue[0] = 0;
 		CWndMenuItem::Create( NULL, RGB565(000000), 2, pParent);
 		CWndMenuItem::SetColorPtr( &m_color );
 	}
@@ -22,6 +25,7 @@ public:
 		bool bEnabled = m_pMeas->Enabled == CSettings::Measure::_On;
 		ui16 clr = bEnabled ? RGB565(000000) : RGB565(808080);
 		ui16 clr2 = RGB565(404040);
+		ui16 clrBack = CDesign::MenuItemTextBack( HasFocus() );
 
 		switch ( m_pMeas->Source )
 		{
@@ -34,33 +38,36 @@ public:
 
 		int x = m_rcClient.left + 10 + MarginLeft;
 		int y = m_rcClient.top;
-		BIOS::LCD::Print( x, y, clr, RGBTRANS, CSettings::Measure::ppszTextType[ (int)m_pMeas->Type ] );
+		BIOS::LCD::Print( x, y, clr, clrBack, CSettings::Measure::ppszTextType[ (int)m_pMeas->Type ] );
 
 		if ( bEnabled )
 		{
 			y += 16;
-			char str[32]; 
 			const char* suffix = CSettings::Measure::ppszTextSuffix[ (int)m_pMeas->Type ];
-			float fValue = m_pMeas->fValue;
-			if ( fValue < 0 )
-			{
+			_Format( m_strValue );
+			if ( m_strValue[0] == '-' )
 				x += BIOS::LCD::Draw( x, y, clr, RGBTRANS, CShapes::minus);
-				fValue = -fValue;
-			} else
+			else
 				x += 6;
 
-			BIOS::DBG::sprintf(str, "%3f", fValue);
-		
-			while ( strlen(str) + strlen(suffix) > 7 )
-				str[strlen(str)-1] = 0;
-		
-			x += BIOS::LCD::Print( x, y, clr, RGBTRANS, str );
+			x += BIOS::LCD::Print( x, y, clr, clrBack, m_strValue+1 );
 			x += 4;
 			if ( suffix && *suffix )
-				BIOS::LCD::Print( x, y, clr2, RGBTRANS, suffix );
+				BIOS::LCD::Print( x, y, clr2, clrBack, suffix );
 		}
 	}
 
+	// returns false when the value would be painted the same as before
+	bool Update()
+	{
+		char str[sizeof(m_strValue)];
+		_Format( str );
+		if ( strcmp( str, m_strValue ) == 0 )
+			return false;
+		strcpy( m_strValue, str );
+		return true;
+	}
+
 	virtual void OnKey(ui16 nKey)
 	{
 		_ASSERT( m_pMeas );
@@ -72,6 +79,22 @@ public:
 		CWnd::OnKey( nKey );
 	}
 
+private:
+	void _Format(char* strValue)
+	{
+		char str[32]; 
+		const char* suffix = CSettings::Measure::ppszTextSuffix[ (int)m_pMeas->Type ];
+		float fValue = m_pMeas->fValue;
+		strValue[0] = fValue < 0 ? '-' : ' ';
+		if ( fValue < 0 )
+			fValue = -fValue;
+
+		BIOS::DBG::sprintf(str, "%3f", fValue);
+	
+		while ( strlen(str) + strlen(suffix) > 7 )
+			str[strlen(str)-1] = 0;
+		strcpy( strValue+1, str );
+	}
 };
 
 #endif
\ No newline at end of file
@@ -37,9 +37,18 @@
 	}
 
 	// new waveform acquired, update the Y values 	
-	if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'g') )
+	if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'a') )
 	{
+		CPerf::Begin( CPerf::Meas );
 		_UpdateAll();
+		CPerf::End( CPerf::Meas );
+		return;
+	}
+
+	// the frame is painted, show the values of the last waveform
+	if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'g') )
+	{
+		_UpdateItems();
 		return;
 	}
 
@@ -47,6 +56,7 @@
 	if (code == ToWord('u', 'p') )
 	{
 		_UpdateAll();
+		_UpdateItems();
 		if ( m_wndListMeas.m_pMeas == m_itmMeas[0].m_pMeas )
 			m_itmMeas[0].Invalidate();
 		if ( m_wndListMeas.m_pMeas == m_itmMeas[1].m_pMeas )
@@ -108,7 +118,6 @@ void CWndMenuMeas::_UpdateAll()
 				nLastRange = meas.Range;
 			}
 			
-			float fPrev = meas.fValue;
 			meas.fValue = -1;
 			switch ( meas.Type )
 			{
@@ -149,9 +158,15 @@ void CWndMenuMeas::_UpdateAll()
 				default:
 					_ASSERT( !!!"Unknown measurement type" );
 			}
-			if ( fPrev != meas.fValue )
-				m_itmMeas[i].Invalidate();
 		}
 	}
 }
 
+void CWndMenuMeas::_UpdateItems()
+{
+	// compared as displayed, the noise below the shown digits does not repaint
+	for ( int i = 0; i < (int)COUNT( m_itmMeas ); i++ )
+		if ( Settings.Meas[i].Enabled != CSettings::Measure::_Off && m_itmMeas[i].Update() )
+			m_itmMeas[i].Invalidate();
+}
+
@@ -22,6 +22,7 @@ public:
 
 private:
 	void				_UpdateAll();
+	void				_UpdateItems();
 };
 
 #endif
\ No newline at end of file
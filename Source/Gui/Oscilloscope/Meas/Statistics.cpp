@@ -5,47 +5,68 @@
 #include "Decoders/Serial.h"
 #include "Decoders/CanBus.h"
 
-float CMeasStatistics::_GetSamplef( BIOS::ADC::TSample& nSample )
+float CMeasStatistics::_GetVoltage( float fSample )
 {
-	float fSample = 0;
 	if ( m_curSrc == CSettings::Measure::_CH1 )
+		return Settings.CH1Calib.Voltage( fastCalc1, fSample );
+	if ( m_curSrc == CSettings::Measure::_CH2 )
+		return Settings.CH2Calib.Voltage( fastCalc2, fSample );
+	_ASSERT( 0 );
+	return 0;
+}
+
+float CMeasStatistics::_GetSamplef( int i, int& nSample )
+{
+	float fSample = 0;
+	if ( m_curSrc == CSettings::Measure::_Math )
 	{
-		nSample = (ui8)((nSample) & 0xff);
-		fSample = Settings.CH1Calib.Voltage( fastCalc1, (float)nSample );
-	}
-	else if ( m_curSrc == CSettings::Measure::_CH2 )
-	{
-		nSample = (ui8)((nSample>>8) & 0xff);
-		fSample = Settings.CH2Calib.Voltage( fastCalc2, (float)nSample );
-	}
-	else if ( m_curSrc == CSettings::Measure::_Math )
-	{
-		//nSample = ;
-		int s = MainWnd.m_wndGraph.MathCalc( nSample );
+		int s = MainWnd.m_wndGraph.MathCalc( CCaptureStore::GetAt( i ) );
 		nSample = (s < 0) ? 0 : s;
 		fSample = (s - Settings.Math.Position) / 32.0f * (Settings.CH1Calib.GetMultiplier(Settings.Math.Resolution) / 1);	// matches the vertical grid
 	} else
-	_ASSERT( 0 );
+	{
+		// 16 bit path, the high resolution samples keep their fraction
+		nSample = _GetSample( i );
+		int nChannel = m_curSrc == CSettings::Measure::_CH1 ? CCaptureStore::CH1 : CCaptureStore::CH2;
+		fSample = _GetVoltage( CCaptureStore::GetFineAt( nChannel, i ) / 256.0f );
+	}
 	return fSample;
 }
 
-int CMeasStatistics::_GetSample( BIOS::ADC::TSample nSample )
+int CMeasStatistics::_GetSample( int i )
 {
 	if ( m_curSrc == CSettings::Measure::_CH1 )
-	{
-		nSample = (ui8)((nSample) & 0xff);
-	}
-	else if ( m_curSrc == CSettings::Measure::_CH2 )
-	{
-		nSample = (ui8)((nSample>>8) & 0xff);
-	}
-	else if ( m_curSrc == CSettings::Measure::_Math )
-	{
-		nSample = MainWnd.m_wndGraph.MathCalc( nSample );
-	}
-	return nSample;
+		return CCaptureStore::GetAnalogAt( CCaptureStore::CH1, i );
+	if ( m_curSrc == CSettings::Measure::_CH2 )
+		return CCaptureStore::GetAnalogAt( CCaptureStore::CH2, i );
+	if ( m_curSrc == CSettings::Measure::_Math )
+		return MainWnd.m_wndGraph.MathCalc( CCaptureStore::GetAt( i ) );
+	return 0;
+}
+
+const ui8* CMeasStatistics::_GetPlane()
+{
+	if ( m_curSrc == CSettings::Measure::_CH1 )
+		return CCaptureStore::GetAnalog( CCaptureStore::CH1 );
+	if ( m_curSrc == CSettings::Measure::_CH2 )
+		return CCaptureStore::GetAnalog( CCaptureStore::CH2 );
+	return NULL;
 }
 
+static int _GetMathSample( int i )
+{
+	return MainWnd.m_wndGraph.MathCalc( CCaptureStore::GetAt( i ) );
+}
+
+CSoftTrigger::TSource CMeasStatistics::_GetSource()
+{
+	if ( m_curSrc == CSettings::Measure::_CH1 )
+		return CSoftTrigger::GetSource( CSettings::Trigger::_CH1 );
+	if ( m_curSrc == CSettings::Measure::_CH2 )
+		return CSoftTrigger::GetSource( CSettings::Trigger::_CH2 );
+	return CSoftTrigger::GetSource( CSettings::Trigger::_Math, _GetMathSample );
+}
+
 bool CMeasStatistics::_GetEffectiveValuesForPower(float &fVoltage, float &fCurrent)
 {
 	fVoltage = sqrt(m_fSum2/m_nCount);
@@ -63,9 +84,9 @@ bool CMeasStatistics::_GetEffectiveValuesForPower(float &fVoltage, float &fCurre
 
 		for ( int i = nBegin; i < nEnd; i++ )
 		{
-			BIOS::ADC::TSample nSample = BIOS::ADC::GetAt( i );
+			int nSample;
 			float fSample, fSample2;
-			fSample = _GetSamplef( nSample );
+			fSample = _GetSamplef( i, nSample );
 			fSample2 = fSample * fSample;
 
 			fSum2 += fSample2;
@@ -86,42 +107,13 @@ int CMeasStatistics::_FindEdge( CSettings::Measure::ESource src, CSettings::Meas
 	if (nOffset > nBegin)
 		nBegin = nOffset;
 
-	int nThresh = 2;
+	int nThresh = CSoftTrigger::Hysteresis;
 	int nTrigMin = Settings.Trig.nLevel - nThresh;
 	int nTrigMax = Settings.Trig.nLevel + nThresh;
 
-	int nNewState = -1;
-
 	m_curSrc = src;
-	for ( int i = nBegin; i < nEnd; i++ )
-	{
-		int nSample_ = BIOS::ADC::GetAt(i);
-		int nSample = _GetSample( nSample_ );
-
-		if ( nSample > nTrigMax )
-			nNewState = 1;
-		if ( nSample < nTrigMin )
-			nNewState = 0;
-
-		if ( nTrigState != -1 && nNewState != nTrigState )
-		{
-			// trigger changing it's output
-	 		nTrigState = nNewState;
-			if ( ( nNewState == 1 ) && (nRising >= 0) )
-			{
-				// rising edge
-				return i;
-			}
-			if ( ( nNewState == 0 ) && (nRising <= 0) )
-			{
-				// falling edge
-				return i;
-			}
-		}
- 		nTrigState = nNewState;
-	}
-
-	return 0;
+	int nEdge = CSoftTrigger::FindEdge( _GetSource(), nBegin, nEnd, nTrigMin, nTrigMax, nRising, nTrigState );
+	return nEdge < 0 ? 0 : nEdge;
 }
 
 bool CMeasStatistics::Process( CSettings::Measure::ESource src, CSettings::Measure::ERange range )
@@ -152,11 +144,48 @@ bool CMeasStatistics::Process( CSettings::Measure::ESource src, CSettings::Measu
 	m_fSum2 = 0;
 	m_nCount = 0;
 
+	if ( src != CSettings::Measure::_Math && !CCaptureStore::HasFine() )
+	{
+		// an analog channel has only 256 possible values, the calibration is
+		// evaluated once per value present instead of once per sample. The
+		// high resolution record goes through the per sample loop below
+		ui16 arrHistogram[256];
+		CCaptureStore::GetHistogram( src == CSettings::Measure::_CH1 ? CCaptureStore::CH1 : CCaptureStore::CH2,
+			nBegin, nEnd, arrHistogram );
+
+		for ( int nSample = 0; nSample < 256; nSample++ )
+		{
+			int nHits = arrHistogram[nSample];
+			if ( nHits == 0 )
+				continue;
+
+			float fSample = _GetVoltage( nSample );
+			if ( m_nCount == 0 )
+			{
+				m_fMin = m_fMax = fSample;
+				m_nRawMin = nSample;
+			}
+			m_nRawMax = nSample;
+
+			if ( fSample > m_fMax )
+				m_fMax = fSample;
+			if ( fSample < m_fMin )
+				m_fMin = fSample;
+
+			m_fSum += fSample * nHits;
+			m_fSum2 += fSample * fSample * nHits;
+			m_fSumR += abs(fSample) * nHits;
+
+			m_nCount += nHits;
+		}
+		return m_nCount > 0 ? true : false;
+	}
+
 	for ( int i = nBegin; i < nEnd; i++ )
 	{
-		BIOS::ADC::TSample nSample = BIOS::ADC::GetAt( i );
+		int nSample;
 		float fSample, fSample2;
-		fSample = _GetSamplef( nSample );
+		fSample = _GetSamplef( i, nSample );
 		fSample2 = fSample * fSample;
 
 		if ( i == nBegin )
@@ -195,43 +224,32 @@ float CMeasStatistics::GetPeriod()
 	int nThresh = ( m_nRawMax - m_nRawMin ) / 4;
 	int nTrigMin = m_nRawMin + nThresh;
 	int nTrigMax = m_nRawMax - nThresh;
-	int nTrigState = -1, nNewState = -1;
+	int nTrigState = -1;
 	int nLastRise = -1, nLastFall = -1;
 	int nTotalRise = 0, nTotalFall = 0;
 	int nSumRise = 0, nSumFall = 0;
 
-	for ( int i = nBegin; i < nEnd; i++ )
+	CSoftTrigger::TSource source = _GetSource();
+	for ( int i = nBegin; ( i = CSoftTrigger::FindEdge( source, i, nEnd, nTrigMin, nTrigMax, 0, nTrigState ) ) >= 0; i++ )
 	{
-		int nSample_ = BIOS::ADC::GetAt(i);
-		int nSample = _GetSample( nSample_ );
-
-		if ( nSample > nTrigMax )
-			nNewState = 1;
-		if ( nSample < nTrigMin )
-			nNewState = 0;
-
-		if ( nTrigState != -1 && nNewState != nTrigState )
+		// trigger changing it's output
+		if ( nTrigState == 1 ) // rising edge
 		{
-			// trigger changing it's output
-			if ( nNewState == 1 ) // rising edge
+			if ( nLastRise != -1 )
 			{
-				if ( nLastRise != -1 )
-				{
-					nSumRise += i - nLastRise; // period length
-					nTotalRise++;
-				}
-				nLastRise = i;
-			} else
-			{	// falling edge
-				if ( nLastFall != -1 )
-				{
-					nSumFall += i - nLastFall; // period length
-					nTotalFall++;
-				}
-				nLastFall = i;
+				nSumRise += i - nLastRise; // period length
+				nTotalRise++;
 			}
+			nLastRise = i;
+		} else
+		{	// falling edge
+			if ( nLastFall != -1 )
+			{
+				nSumFall += i - nLastFall; // period length
+				nTotalFall++;
+			}
+			nLastFall = i;
 		}
- 		nTrigState = nNewState;
 	}
 			
 	if ( nTotalRise + nTotalFall == 0 )
@@ -302,10 +320,15 @@ float CMeasStatistics::GetPwm()
 	int nThresh = ( m_nRawMax + m_nRawMin ) / 2;
 	int nLow = 0, nHigh = 0;
 
+	if ( m_curSrc != CSettings::Measure::_Math )
+	{
+		nHigh = CCaptureStore::GetAbove( m_curSrc == CSettings::Measure::_CH1 ? CCaptureStore::CH1 : CCaptureStore::CH2,
+			nBegin, nEnd, nThresh );
+		nLow = nEnd - nBegin - nHigh;
+	} else
 	for ( int i = nBegin; i < nEnd; i++ )
 	{
-		int nSample_ = BIOS::ADC::GetAt(i);
-		int nSample = _GetSample( nSample_ );
+		int nSample = _GetSample( i );
 
 		if ( nSample > nThresh )
 			nHigh++;
@@ -446,10 +469,10 @@ float CMeasStatistics::GetEdgeTime(bool bRising)
 	int nTotal = 0;
 	int nSum = 0;
 
+	const ui8* pPlane = _GetPlane();
 	for ( int i = nBegin; i < nEnd; i++ )
 	{
-		int nSample_ = BIOS::ADC::GetAt(i);
-		int nSample = _GetSample( nSample_ );
+		int nSample = pPlane ? pPlane[i] : _GetSample( i );
 
 		if ( (nTrig90 - 10 < nSample) && ( nSample < nTrig90 + 10) )
 		{
@@ -551,5 +574,7 @@ bool CMeasStatistics::_GetRange( int& nBegin, int& nEnd, CSettings::Measure::ERa
 			nEnd = BIOS::ADC::GetCount();
 			break;
 	}
-	return true;
+	// peak detect, high resolution and ETS leave the samples outside of
+	// their shorter record empty
+	return CCaptureStore::ClipValid( nBegin, nEnd );
 }
\ No newline at end of file
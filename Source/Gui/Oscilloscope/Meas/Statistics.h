@@ -2,6 +2,7 @@
 #define __MEASURE_H__
 
 #include <Source/Core/Settings.h>
+#include <Source/Gui/Oscilloscope/Core/SoftTrigger.h>
 
 class CMeasStatistics
 {
@@ -39,8 +40,11 @@ public:
 
 private:
 	bool _GetRange( int& nBegin, int& nEnd, CSettings::Measure::ERange range );
-	float _GetSamplef( BIOS::ADC::TSample& nSample );
-	int _GetSample( BIOS::ADC::TSample nSample );
+	float _GetVoltage( float fSample );
+	float _GetSamplef( int i, int& nSample );
+	int _GetSample( int i );
+	const ui8* _GetPlane();
+	CSoftTrigger::TSource _GetSource();
 	bool _GetEffectiveValuesForPower(float &fVoltage, float &fCurrent);
 	// nRising - 1(rising), 0(both), -1(falling)
 	int _FindEdge( CSettings::Measure::ESource src, CSettings::Measure::ERange range, si8 nRising, int nOffset, int &nTrigState ); 
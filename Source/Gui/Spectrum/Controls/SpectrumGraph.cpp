@@ -1,6 +1,7 @@
 #include <Source/Core/Utils.h>
 #include "SpectrumGraph.h"
 #include "../Core/FFT.h"
+#include <Source/Gui/Oscilloscope/Core/CaptureStore.h>
 
 #ifdef _TESTSIGNAL
 #include <math.h> // for testing
@@ -17,7 +18,6 @@ void CWndSpectrumGraphTempl::OnPaint()
 	// maximum size
 	ui16 column[CWndGraph::DivsY*CWndGraph::BlkY];
 
-	if ( !CWnd::GetOverlay().IsValid() )
 	{
 		CRect rc = m_rcClient;
 		rc.Inflate( 1, 1, 1, 1 );
@@ -37,22 +37,19 @@ void CWndSpectrumGraphTempl::OnPaint()
 
 	_ASSERT( nLength == 512 );
 	// share the ADC buffer with fft calculations
-	si16* pWaveformR = (si16*)(PVOID)&BIOS::ADC::GetAt(4096-2048);
+	si16* pWaveformR = (si16*)(PVOID)CCaptureStore::GetScratch();
 	si16* pWaveformI = pWaveformR + 512;
-	si16* pDataOut1 =  (si16*)(PVOID)&BIOS::ADC::GetAt(1024);
+	si16* pDataOut1 =  pWaveformI + 512;
 	si16* pDataOut2 =  pDataOut1+256;
 
 	bool bHann = Settings.Spec.Window == CSettings::Spectrum::_Hann;
 	int nOffset = Settings.Time.InvalidFirst;
 
-	int nSum[] = {0, 0};
-	for ( int i = 0; i < 512; i++ )
-	{
-		BIOS::ADC::SSample Sample;
-		Sample.nValue = BIOS::ADC::GetAt( nOffset + i );
-		nSum[0] += Sample.CH1;
-		nSum[1] += Sample.CH2;
-	}
+	const ui8* pCH1 = CCaptureStore::GetAnalog( CCaptureStore::CH1, nOffset );
+	const ui8* pCH2 = CCaptureStore::GetAnalog( CCaptureStore::CH2, nOffset );
+	int nSum[] = {
+		(int)CCaptureStore::GetSum( CCaptureStore::CH1, nOffset, nOffset + 512 ),
+		(int)CCaptureStore::GetSum( CCaptureStore::CH2, nOffset, nOffset + 512 ) };
 	nSum[0] /= 512;
 	nSum[1] /= 512;
 
@@ -67,9 +64,7 @@ void CWndSpectrumGraphTempl::OnPaint()
 
 		for ( int i = 0; i < 512; i++ )
 		{
-			BIOS::ADC::SSample Sample;
-			Sample.nValue = BIOS::ADC::GetAt( nOffset + i );
-			int nSample = nInput == 1 ? Sample.CH1 : Sample.CH2;
+			int nSample = nInput == 1 ? pCH1[i] : pCH2[i];
 #ifdef _TESTSIGNAL
 			float f = 10.0f; //(GetTickCount()/1000)&1 ? 30.0f : 60.0f;
 			nSample = (int)(sin(i/512.0f*2.0f*3.141592*f)*128.0f+64);
@@ -145,7 +140,7 @@ void CWndSpectrumGraphTempl::OnPaint()
 					column[t] = clr2;
 		}
 
-		BIOS::LCD::Buffer( m_rcClient.left + i, m_rcClient.top, column, DivsY*m_nBlkY );
+		BIOS::LCD::BlitColumns( CRect( m_rcClient.left + i, m_rcClient.top, m_rcClient.left + i + 1, m_rcClient.top + DivsY*m_nBlkY ), column, DivsY*m_nBlkY );
 		if ( i == nMarkerX+3 )
 		{
 			BIOS::LCD::Draw( m_rcClient.left+nMarkerX-3, m_rcClient.bottom-nMarkerY-4, RGB565(ff0000), RGBTRANS, CShapes::markerX);
@@ -167,12 +162,11 @@ void CWndTimeGraphTempl::OnPaint()
 	else	\
 		for (int _y = ynew; _y <= ylast; _y++)	\
 			buf[_y] = clr;	\
-		ylast = ynew;	
+	ylast = ynew;
 
 	// maximum size
 	ui16 column[CWndGraph::DivsY*CWndGraph::BlkY];
 
-	if ( !CWnd::GetOverlay().IsValid() )
 	{
 		CRect rc = m_rcClient;
 		rc.Inflate( 1, 1, 1, 1 );
@@ -193,14 +187,11 @@ void CWndTimeGraphTempl::OnPaint()
 	int nLastY1 = -1;
 	int nLastY2 = -1;
 
-	int nSum[] = {0, 0};
-	for ( int i = 0; i < 512; i++ )
-	{
-		BIOS::ADC::SSample Sample;
-		Sample.nValue = BIOS::ADC::GetAt( nOffset + i );
-		nSum[0] += Sample.CH1;
-		nSum[1] += Sample.CH2;
-	}
+	const ui8* pCH1 = CCaptureStore::GetAnalog( CCaptureStore::CH1, nOffset );
+	const ui8* pCH2 = CCaptureStore::GetAnalog( CCaptureStore::CH2, nOffset );
+	int nSum[] = {
+		(int)CCaptureStore::GetSum( CCaptureStore::CH1, nOffset, nOffset + 512 ),
+		(int)CCaptureStore::GetSum( CCaptureStore::CH2, nOffset, nOffset + 512 ) };
 	nSum[0] /= 512;
 	nSum[1] /= 512;
 
@@ -218,17 +209,15 @@ void CWndTimeGraphTempl::OnPaint()
 
 		for (int nTest=nSampleIndex; nTest < nCurSampleIndex && !bSatur; nTest++ )
 		{
-			BIOS::ADC::SSample Sample;
-			Sample.nValue = BIOS::ADC::GetAt(nOffset + nSampleIndex);
 			if ( en2 )
 			{
-				int y2 = Sample.CH2;
+				int y2 = pCH2[nSampleIndex];
 				if ( y2 == 0 || y2 == 255 )
 					bSatur = true;
 			}
 			if ( en1 )
 			{
-				int y1 = Sample.CH1;
+				int y1 = pCH1[nSampleIndex];
 				if ( y1 == 0 || y1 == 255 )
 					bSatur = true;
 			}
@@ -239,11 +228,9 @@ void CWndTimeGraphTempl::OnPaint()
 
 		for (; nSampleIndex < nCurSampleIndex; nSampleIndex++ )
 		{
-			BIOS::ADC::SSample Sample;
-			Sample.nValue = BIOS::ADC::GetAt(nOffset + nSampleIndex);
 			if ( en2 )
 			{
-				int y2 = Sample.CH2;
+				int y2 = pCH2[nSampleIndex];
 				if ( bHann )
 				{
 					y2 -= nSum[1];
@@ -258,7 +245,7 @@ void CWndTimeGraphTempl::OnPaint()
 
 			if ( en1 )
 			{
-				int y1 = Sample.CH1;
+				int y1 = pCH1[nSampleIndex];
 				if ( bHann )
 				{
 					y1 -= nSum[0];
@@ -272,50 +259,49 @@ void CWndTimeGraphTempl::OnPaint()
 			}
 		}
 
-		BIOS::LCD::Buffer( m_rcClient.left + i, m_rcClient.top, column, DivsY*m_nBlkY );
+		BIOS::LCD::BlitColumns( CRect( m_rcClient.left + i, m_rcClient.top, m_rcClient.left + i + 1, m_rcClient.top + DivsY*m_nBlkY ), column, DivsY*m_nBlkY );
 	}
 }
 
 /*virtual*/ void CWndSpectrographTempl::Create(CWnd *pParent, ui16 dwFlags) 
 {
 	CWnd::Create("CWndSpectrographTempl", dwFlags | CWnd::WsListener, CRect(34+16, 222-m_nHeight, 34+16+m_nWidth, 222), pParent);
-	m_nY = 0;
+	m_nHead = 0;
+	m_bPalette = false;
 }
 
-/*virtual*/ void CWndSpectrographTempl::OnPaint()
+bool CWndSpectrographTempl::_Append()
 {
-	// maximum size
-	ui16 column[256];
-	_ASSERT( m_nWidth == 256 );
-
-	if ( !CWnd::GetOverlay().IsValid() )
+	// the history starts again when the ring was taken over
+	bool bOwner = CCoreShared::IsOwner( CCoreShared::Spectrograph );
+	if ( !CCoreShared::Claim( CCoreShared::Spectrograph ) )
+		return false;
+	if ( !bOwner )
 	{
-		CRect rc = m_rcClient;
-		rc.Inflate( 1, 1, 1, 1 );
-		BIOS::LCD::Rectangle( rc, RGB565(b0b0b0) );
+		memset( _GetRing().arrCells, 0, sizeof(_GetRing().arrCells) );
+		m_nHead = 0;
+		m_bPalette = false;
 	}
 
-	ui16 clr1 = Settings.CH1.u16Color;
 	ui8 en1 = Settings.CH1.Enabled == CSettings::AnalogChannel::_YES;
-	ui16 clr2 = Settings.CH2.u16Color;
 	ui8 en2 = Settings.CH2.Enabled == CSettings::AnalogChannel::_YES;
 
-	ui32 clr32A = RGB32( Get565R( clr1 ), Get565G( clr1 ), Get565B( clr1 ) );
-	ui32 clr32B = RGB32( Get565R( clr2 ), Get565G( clr2 ), Get565B( clr2 ) );
-
 	int nLength = Settings.Spec.nWindowLength;
 
 	_ASSERT( nLength == 512 );
 	// share the ADC buffer with fft calculations
-	si16* pWaveformR = (si16*)(PVOID)&BIOS::ADC::GetAt(4096-2048);
+	si16* pWaveformR = (si16*)(PVOID)CCaptureStore::GetScratch();
 	si16* pWaveformI = pWaveformR + 512;
 
 	bool bHann = Settings.Spec.Window == CSettings::Spectrum::_Hann;
 	int nOffset = Settings.Time.InvalidFirst;
+	const ui8* pCH1 = CCaptureStore::GetAnalog( CCaptureStore::CH1, nOffset );
+	const ui8* pCH2 = CCaptureStore::GetAnalog( CCaptureStore::CH2, nOffset );
 
 	CFft<512> fft;
 
-	memset( column, 0, sizeof(column) );
+	ui8* pRow = _GetRing().arrCells[m_nHead];
+	memset( pRow, 0, Cells );
 	for ( int nInput = 2; nInput >= 1; nInput-- )
 	{
 		if ( nInput == 1 && !en1 )
@@ -325,9 +311,7 @@ void CWndTimeGraphTempl::OnPaint()
 
 		for ( int i = 0; i < 512; i++ )
 		{
-			BIOS::ADC::SSample Sample;
-			Sample.nValue = BIOS::ADC::GetAt( nOffset + i );
-			int nSample = nInput == 1 ? Sample.CH1 : Sample.CH2;
+			int nSample = nInput == 1 ? pCH1[i] : pCH2[i];
 
 			//float f = (GetTickCount()/1000)&1 ? 30.0f : 60.0f;
 			//nSample = (int)(sin(i/512.0f*2.0f*3.141592*f)*128.0f+128);
@@ -358,48 +342,101 @@ void CWndTimeGraphTempl::OnPaint()
 			int nLength = nLength_ / 8;	// amplify it 2x
 			UTILS.Clamp<int>( nLength, 0, 255);
 
-			// store vector lengths in column
-			if ( nInput == 1 )
-				column[i] |= nLength;
-			else
-				column[i] |= nLength << 8;
+			// 4 bit level of the channel, a cell keeps the highest of its bins
+			ui8 nLevel = (ui8)(nLength >> 4);
+			ui8& nCell = pRow[i / ScaleX];
+			if ( nInput == 1 && nLevel > (nCell & 0x0f) )
+				nCell = (nCell & 0xf0) | nLevel;
+			if ( nInput == 2 && nLevel > (nCell >> 4) )
+				nCell = (nCell & 0x0f) | (nLevel << 4);
 		}
 	}
 
-	// convert vector lengths to colors
+	if ( ++m_nHead >= Rows )
+		m_nHead = 0;
+	return true;
+}
+
+/*virtual*/ void CWndSpectrographTempl::OnPaint()
+{
+	_ASSERT( m_nWidth == Width && m_nHeight == Height );
+
+	{
+		CRect rc = m_rcClient;
+		rc.Inflate( 1, 1, 1, 1 );
+		BIOS::LCD::Rectangle( rc, RGB565(b0b0b0) );
+	}
+
+	if ( !CCoreShared::IsOwner( CCoreShared::Spectrograph ) )
+	{
+		BIOS::LCD::Bar( m_rcClient, 0x0101 );
+		return;
+	}
+	_UpdatePalette();
+	for ( int nRow = 0; nRow < Rows; nRow++ )
+		_PaintRow( nRow );
+}
+
+void CWndSpectrographTempl::_UpdatePalette()
+{
+	// a disabled channel has no colour, that leaves the background as it is
+	ui16 clr1 = Settings.CH1.Enabled == CSettings::AnalogChannel::_YES ? Settings.CH1.u16Color : 0;
+	ui16 clr2 = Settings.CH2.Enabled == CSettings::AnalogChannel::_YES ? Settings.CH2.u16Color : 0;
+
+	ui32 nKey = clr1 | ((ui32)clr2 << 16);
+	if ( m_bPalette && nKey == m_nPaletteKey )
+		return;
+	m_bPalette = true;
+	m_nPaletteKey = nKey;
+
+	ui32 clr32A = RGB32( Get565R( clr1 ), Get565G( clr1 ), Get565B( clr1 ) );
+	ui32 clr32B = RGB32( Get565R( clr2 ), Get565G( clr2 ), Get565B( clr2 ) );
+
+	// convert the levels of both channels to colors
 	const ui16 clrBackground = 0x0101;
 	for ( int i = 0; i < 256; i++ )
 	{
-		ui8 ch1 = (ui8)column[i];
-		ui8 ch2 = (ui8)(column[i]>>8);
+		int ch1 = (i & 0x0f) * 17;
+		int ch2 = (i >> 4) * 17;
 
 		ui8 color[3] = {Get565R(clrBackground), Get565G(clrBackground), Get565B(clrBackground)};
-		if ( en1 )
+		int colorA[3] = { 
+			(int) ((GetColorR(clr32A)*ch1) >> 8), 
+			(int) ((GetColorG(clr32A)*ch1) >> 8),
+			(int) ((GetColorB(clr32A)*ch1) >> 8)};
+		int colorB[3] = { 
+			(int) ((GetColorR(clr32B)*ch2) >> 8), 
+			(int) ((GetColorG(clr32B)*ch2) >> 8),
+			(int) ((GetColorB(clr32B)*ch2) >> 8)};
+		for ( int j = 0; j < 3; j++ )
 		{
-			int colorA[3] = { 
-				(int) ((GetColorR(clr32A)*ch1) >> 8), 
-				(int) ((GetColorG(clr32A)*ch1) >> 8),
-				(int) ((GetColorB(clr32A)*ch1) >> 8)};
-			color[0] = max( colorA[0], color[0] );
-			color[1] = max( colorA[1], color[1] );
-			color[2] = max( colorA[2], color[2] );
+			color[j] = max( colorA[j], color[j] );
+			color[j] = max( colorB[j], color[j] );
 		}
-		if ( en2 )
-		{
-			int colorB[3] = { 
-				(int) ((GetColorR(clr32B)*ch2) >> 8), 
-				(int) ((GetColorG(clr32B)*ch2) >> 8),
-				(int) ((GetColorB(clr32B)*ch2) >> 8)};
-			color[0] = max( colorB[0], color[0] );
-			color[1] = max( colorB[1], color[1] );
-			color[2] = max( colorB[2], color[2] );
-		}
-		column[i] = RGB565RGB( color[0], color[1], color[2] );
+		_GetRing().arrPalette[i] = RGB565RGB( color[0], color[1], color[2] );
 	}
+}
 
-	// blit
-	BIOS::LCD::PutImage( CRect( m_rcClient.left, m_rcClient.top + m_nY, m_rcClient.right, m_rcClient.top + m_nY + 1 ), column );
+void CWndSpectrographTempl::_PaintRow(int nRow)
+{
+	const TRing& ring = _GetRing();
+	ui16 row[Width];
+	for ( int nCell = 0; nCell < Cells; nCell++ )
+	{
+		ui16 clr = ring.arrPalette[ring.arrCells[nRow][nCell]];
+		for ( int j = 0; j < ScaleX; j++ )
+			row[nCell*ScaleX + j] = clr;
+	}
 
-	if ( ++m_nY >= m_nHeight )
-		m_nY = 0;
+	// one pixel line per transfer, the top line of the row written next is
+	// the cursor
+	int y = m_rcClient.top + nRow * ScaleY;
+	for ( int j = 0; j < ScaleY; j++ )
+	{
+		CRect rc( m_rcClient.left, y + j, m_rcClient.right, y + j + 1 );
+		if ( j == 0 && nRow == m_nHead )
+			BIOS::LCD::Bar( rc, RGB565(b0b0b0) );
+		else
+			BIOS::LCD::BlitColumns( rc, row, 1 );
+	}
 }
@@ -4,6 +4,8 @@
 #include <Source/Framework/Wnd.h>
 #include <Source/Core/Settings.h>
 #include <Source/Gui/Oscilloscope/Controls/GraphBase.h>
+#include <Source/Gui/Oscilloscope/Controls/ColumnTemplates.h>
+#include <Source/Gui/Oscilloscope/Core/CoreShared.h>
 
 class CWndSpectrumGraphTempl : public CWnd
 {
@@ -16,6 +18,7 @@ public:
 	};
 	int m_nBlkX;
 	int m_nBlkY;
+	CColumnTemplates m_templates;
 
 public:
 	CWndSpectrumGraphTempl(int nBlkX, int nBlkY)
@@ -36,6 +39,26 @@ public:
 	}
 
 	void _PrepareColumn( ui16 *column, ui16 n, ui16 clr )
+	{
+		if ( !m_templates.IsValid( 0 ) )
+		{
+			ui16 arrColumn[CWndGraph::DivsY*CWndGraph::BlkY];
+			m_templates.Begin( 0, DivsX*m_nBlkX, DivsY*m_nBlkY );
+			for ( int i = 0; i < DivsX*m_nBlkX && m_templates.IsValid( 0 ); i++ )
+			{
+				_BuildColumn( arrColumn, i, CColumnTemplates::Background );
+				if ( !m_templates.Add( i, arrColumn ) )
+					break;
+			}
+			m_templates.End();
+		}
+		if ( m_templates.IsValid( 0 ) )
+			m_templates.Get( column, n, clr );
+		else
+			_BuildColumn( column, n, clr );
+	}
+
+	void _BuildColumn( ui16 *column, ui16 n, ui16 clr )
 	{
 		memset( column, clr, DivsY*m_nBlkY*2 );
 		if ( n == 0 )
@@ -66,6 +89,7 @@ public:
 	};
 	int m_nBlkX;
 	int m_nBlkY;
+	CColumnTemplates m_templates;
 
 public:
 	CWndTimeGraphTempl(int nBlkX, int nBlkY)
@@ -86,6 +110,26 @@ public:
 	}
 
 	void _PrepareColumn( ui16 *column, ui16 n, ui16 clr )
+	{
+		if ( !m_templates.IsValid( 0 ) )
+		{
+			ui16 arrColumn[CWndGraph::DivsY*CWndGraph::BlkY];
+			m_templates.Begin( 0, DivsX*m_nBlkX, DivsY*m_nBlkY );
+			for ( int i = 0; i < DivsX*m_nBlkX && m_templates.IsValid( 0 ); i++ )
+			{
+				_BuildColumn( arrColumn, i, CColumnTemplates::Background );
+				if ( !m_templates.Add( i, arrColumn ) )
+					break;
+			}
+			m_templates.End();
+		}
+		if ( m_templates.IsValid( 0 ) )
+			m_templates.Get( column, n, clr );
+		else
+			_BuildColumn( column, n, clr );
+	}
+
+	void _BuildColumn( ui16 *column, ui16 n, ui16 clr )
 	{
 		for (int i=0; i<DivsY*m_nBlkY; i++)
 			column[i] = clr;
@@ -107,12 +151,47 @@ public:
 	virtual void OnPaint();
 };
 
+// Waterfall of the spectra, every painted frame appends one row of quantised
+// magnitudes into the ring. The rows keep their place on the screen, only the
+// new row is drawn and a cursor line below it marks the oldest one, so the
+// screen is not scrolled. A cell holds the 4 bit level of CH1 in the low
+// nibble and CH2 in the high nibble, the colours come from a 256 entry table.
+// The ring and the table are kept in the buffer of CCoreShared, nothing is
+// drawn while an oscilloscope engine holds it
 class CWndSpectrographTempl : public CWnd
 {
 public:
+	enum {
+		Width = 256,
+		Height = 128,
+#ifdef _ARM
+		// the application RAM has no room for a cell per pixel, one cell
+		// covers 4x8 pixels
+		ScaleX = 4,
+		ScaleY = 8,
+#else
+		ScaleX = 1,
+		ScaleY = 1,
+#endif
+		Cells = Width / ScaleX,
+		Rows = Height / ScaleY
+	};
+
+	struct TRing
+	{
+		ui8 arrCells[Rows][Cells];
+		ui16 arrPalette[256];
+	};
+
 	int m_nWidth;
 	int m_nHeight;
-	int m_nY;
+
+private:
+	// row written by the next acquisition
+	int m_nHead;
+	// the palette is built again only when the channel colours change
+	ui32 m_nPaletteKey;
+	bool m_bPalette;
 
 public:
 	CWndSpectrographTempl(int nBlkX, int nBlkY)
@@ -125,13 +204,29 @@ public:
 
 	virtual void OnMessage(CWnd* pSender, ui16 code, ui32 data)
 	{
+		// a row for every frame given to the display, repaints in between
+		// (closed menus) draw the history again without any fft
 		if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'g') )
 		{
-			Invalidate();
+			if ( !IsVisible() || !_Append() )
+				return;
+			_UpdatePalette();
+			_PaintRow( m_nHead == 0 ? Rows-1 : m_nHead-1 );
+			_PaintRow( m_nHead );
 			return;
 		}
 	}
 	virtual void OnPaint();
+
+private:
+	TRing& _GetRing()
+	{
+		return *(TRing*)CCoreShared::GetBuffer();
+	}
+	// false when the ring is held by another engine
+	bool _Append();
+	void _UpdatePalette();
+	void _PaintRow(int nRow);
 };
 
 class CWndSpectrumGraph : public CWndSpectrumGraphTempl
@@ -12,13 +12,23 @@ CWndMenuSpectMarker::CWndMenuSpectMarker()
 	m_itmSource.Create("~Source\nCH1", RGB565(ffff00), 2, this);
 	m_itmTrack.Create("~Position\nAuto", RGB565(8080b0), 2, this);
 	m_itmValue.Create(this);
+	m_fMarkerX = -1;
+	m_fMarkerY = -1;
 }
 
 /*virtual*/ void CWndMenuSpectMarker::OnMessage(CWnd* pSender, ui16 code, ui32 data)
 {
+	// the marker is searched by the spectrum graph while painting, there is
+	// nothing to analyse on 'da', only a changed value is drawn again
 	if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'g') )
 	{
-		m_itmValue.Invalidate();
+		if ( Settings.Spec.fMarkerX != m_fMarkerX || Settings.Spec.fMarkerY != m_fMarkerY )
+		{
+			m_fMarkerX = Settings.Spec.fMarkerX;
+			m_fMarkerY = Settings.Spec.fMarkerY;
+			m_itmValue.Invalidate();
+		}
+		return;
 	}
 
 	// LAYOUT ENABLE/DISABLE FROM TOP MENU BAR
@@ -14,6 +14,10 @@ public:
 	CWndMenuItem m_itmTrack;
 	CItemSpecMarker m_itmValue;
 
+	// marker found by the last paint of the spectrum
+	float m_fMarkerX;
+	float m_fMarkerY;
+
 	CWndMenuSpectMarker();
 
 	virtual void Create(CWnd *pParent, ui16 dwFlags);
@@ -1,7 +1,35 @@
 #include "Export.h"
 #include <Source/Gui/MainWnd.h>
+#include <Source/Gui/Oscilloscope/Core/Interpolator.h>
 //#include <Source/Gui/Oscilloscope/Controls/GraphOsc.h>
 
+// path of the whole record, the window visible on the screen is reconstructed
+// with SvgUpsampling points per sample
+LINKERSECTION(".extra")
+void CExport::_SaveSvgPath(CBufferedWriter& writer, const ui8* pPlane, int nBegin, int nEnd)
+{
+	int nCount = (int)BIOS::ADC::GetCount();
+	for (int i=0; i<nCount; i++)
+	{
+		char line[64];
+		if ( i < nBegin || i >= nEnd || i+1 >= nCount )
+		{
+			BIOS::DBG::sprintf(line, i==0 ? "M%d,%d " : "L%d,%d ", i, 256-pPlane[i]);
+			writer << line;
+			continue;
+		}
+
+		ui8 arrFine[SvgUpsampling];
+		CInterpolator::Process( pPlane, 1, nCount, i << CInterpolator::FractionBits, 
+			CInterpolator::Unity / SvgUpsampling, arrFine, SvgUpsampling );
+		for (int j=0; j<SvgUpsampling; j++)
+		{
+			BIOS::DBG::sprintf(line, i+j==0 ? "M%d.%d,%d " : "L%d.%d,%d ", i, j*100/SvgUpsampling, 256-arrFine[j]);
+			writer << line;
+		}
+	}
+}
+
 LINKERSECTION(".extra")
 void CExport::SaveSvg(char* strName_ /*= NULL*/)
 {
@@ -42,28 +70,15 @@ void CExport::SaveSvg(char* strName_ /*= NULL*/)
 	for (int x=0; x<nCount; x+=32)
 		writer << "<path stroke=\"#404040\" d=\"M" << CUtils::itoa(x) << ",0 V256\"/>\n";
 
-	writer << "<path stroke=\"yellow\" fill=\"none\" stroke-width=\"1\" d=\"";
-	for (int i=0; i<(int)BIOS::ADC::GetCount(); i++)
-	{
-		char line[64];
-		unsigned int nValue = BIOS::ADC::GetAt(i);
-		int nCH1 = (ui8)((nValue) & 0xff);
+	const ui8* pCH1 = CCaptureStore::GetAnalog( CCaptureStore::CH1 );
+	const ui8* pCH2 = CCaptureStore::GetAnalog( CCaptureStore::CH2 );
 
-		BIOS::DBG::sprintf(line, i==0 ? "M%d,%d " : "L%d,%d ", i, 256-nCH1);
-		writer << line;
-	}
+	writer << "<path stroke=\"yellow\" fill=\"none\" stroke-width=\"1\" d=\"";
+	_SaveSvgPath( writer, pCH1, nBegin, nEnd );
 	writer << "\"/>\n";
 
 	writer << "<path stroke=\"cyan\" fill=\"none\" stroke-width=\"1\" d=\"";
-	for (int i=0; i<(int)BIOS::ADC::GetCount(); i++)
-	{
-		char line[64];
-		unsigned int nValue = BIOS::ADC::GetAt(i);
-		int nCH2 = (ui8)((nValue>>8) & 0xff);
-
-		BIOS::DBG::sprintf(line, i==0 ? "M%d,%d " : "L%d,%d ", i, 256-nCH2);
-		writer << line;
-	}
+	_SaveSvgPath( writer, pCH2, nBegin, nEnd );
 	writer << "\"/>\n";
 
 	writer << "<text font-family=\"Arial\" x=\"638\" y=\"230\" fill=\"yellow\" font-size=\"20\" text-anchor=\"end\" id=\"CH1s\">CH1: "
@@ -141,11 +156,13 @@ void CExport::SaveWav(char* strName_ /*= NULL*/)
 	} WaveFormat;
 
 	int nSamplingSpeed = (int)( CWndGraph::BlkX / Settings.Runtime.m_fTimeRes + 0.5f );
+	// high resolution record is written as 16 bit signed PCM
+	bool bFine = CCaptureStore::HasFine();
 
 	WaveFormat.wFormatTag = 1; // WAVE_FORMAT_PCM
 	WaveFormat.nChannels = 2;
 	WaveFormat.nSamplesPerSec = nSamplingSpeed;	
-	WaveFormat.wBitsPerSample = 8;
+	WaveFormat.wBitsPerSample = bFine ? 16 : 8;
 	WaveFormat.cbSize = 0;
 
 	WaveFormat.nAvgBytesPerSec = WaveFormat.nSamplesPerSec * WaveFormat.wBitsPerSample / 8;
@@ -153,7 +170,7 @@ void CExport::SaveWav(char* strName_ /*= NULL*/)
 
 	int nJunkSize = 14*4;
 
-	ui32 dwSize = sizeof( WAVEFORMATEX ) + 4096*2 + 6*4 + nJunkSize;
+	ui32 dwSize = sizeof( WAVEFORMATEX ) + 4096*WaveFormat.nBlockAlign + 6*4 + nJunkSize;
 
 	writer 
 		<< ToDword('R', 'I', 'F', 'F')
@@ -164,15 +181,22 @@ void CExport::SaveWav(char* strName_ /*= NULL*/)
 				<< CStream( &WaveFormat, sizeof(WAVEFORMATEX) )
 
 				<< ToDword('d', 'a', 't', 'a')
-				<< (ui32)BIOS::ADC::GetCount()*2;
+				<< (ui32)BIOS::ADC::GetCount()*WaveFormat.nBlockAlign;
 
+	const ui8* pCH1 = CCaptureStore::GetAnalog( CCaptureStore::CH1 );
+	const ui8* pCH2 = CCaptureStore::GetAnalog( CCaptureStore::CH2 );
 	for (int i=0; i< (int)BIOS::ADC::GetCount(); i++)
 	{
-		BIOS::ADC::SSample Sample;
-		Sample.nValue = BIOS::ADC::GetAt(i);
+		if ( bFine )
+		{
+			writer 
+				<< (ui16)( CCaptureStore::GetFineAt( CCaptureStore::CH1, i ) ^ 0x8000 )
+				<< (ui16)( CCaptureStore::GetFineAt( CCaptureStore::CH2, i ) ^ 0x8000 );
+			continue;
+		}
 		writer 
-			<< Sample.CH1 
-			<< Sample.CH2;
+			<< pCH1[i] 
+			<< pCH2[i];
 	}
 
 	writer 
@@ -6,6 +6,7 @@
 #include <Source/Gui/Oscilloscope/Controls/GraphBase.h>
 #include <Source/Core/BufferedIo.h>
 #include <Source/Core/Utils.h>
+#include <Source/Gui/Oscilloscope/Core/CaptureStore.h>
 
 class CExport
 {
@@ -34,13 +35,16 @@ class CExport
 	};
 #pragma pack(pop)
 
+	enum {
+		// points per sample of the visible window in the SVG traces
+		SvgUpsampling = 4
+	};
+
 public:
 	void FindUnusedFile(char* strName, int nNumbers)
 	{
-		bool bExists;
 		FILEINFO f;
 		do {
-			bExists = false;
 			if ( BIOS::DSK::Open( &f, strName, BIOS::DSK::IoRead ) )
 			{
 				BIOS::DSK::Close( &f );
@@ -84,7 +88,7 @@ public:
 
 		for (int i=0; i</*BIOS::ADC::Length()*/ (int)BIOS::ADC::GetCount(); i++)
 		{
-			unsigned int nValue = BIOS::ADC::GetAt(i);
+			unsigned int nValue = CCaptureStore::GetAt(i);
 
 			for (int j=0; j<4; j++)
 			{
@@ -123,13 +127,12 @@ public:
 		for (int i=0; i<(int)BIOS::ADC::GetCount(); i++)
 		{
 			char line[64];
-			unsigned int nValue = BIOS::ADC::GetAt(i);
-			int nCH1 = (ui8)((nValue) & 0xff);
-			int nCH2 = (ui8)((nValue>>8) & 0xff);
+			unsigned int nValue = CCaptureStore::GetAt(i);
 	
 			float fTime = fTimeRes * ( i - ( Settings.Trig.nTime - Settings.Time.Shift ) );
-			float fCH1 = Settings.CH1Calib.Voltage( fastCalc1, (float)nCH1 );
-			float fCH2 = Settings.CH2Calib.Voltage( fastCalc2, (float)nCH2 );
+			// high resolution samples keep their fraction
+			float fCH1 = Settings.CH1Calib.Voltage( fastCalc1, CCaptureStore::GetFineAt( CCaptureStore::CH1, i ) / 256.0f );
+			float fCH2 = Settings.CH2Calib.Voltage( fastCalc2, CCaptureStore::GetFineAt( CCaptureStore::CH2, i ) / 256.0f );
 
 			BIOS::DBG::sprintf(line, "%4d, %08x, %6f, %6f, %6f\n", i, nValue, fTime, fCH1, fCH2);
 			writer << line;
@@ -140,6 +143,9 @@ public:
 
 	void SaveSvg(char* strName_ = NULL);
 	void SaveWav(char* strName_ = NULL);
+
+private:
+	void _SaveSvgPath(CBufferedWriter& writer, const ui8* pPlane, int nBegin, int nEnd);
 };
 
 #endif
\ No newline at end of file
@@ -21,11 +21,13 @@ bool CImport::LoadWave(char* strName /*= NULL*/)
 	} WaveFormat;
 
 	ui32 nJunkSize = 14*4;
-	ui32 dwCheckSize = sizeof( WAVEFORMATEX ) + 4096*2 + 6*4 + nJunkSize;
+	ui32 dwCheckSize = sizeof( WAVEFORMATEX ) + 6*4 + nJunkSize;
 	ui32 dwRiffChunk, dwRiffSize;
 	reader >> dwRiffChunk >> dwRiffSize;
 
-	if ( dwRiffChunk != ToDword('R', 'I', 'F', 'F') || dwRiffSize != dwCheckSize )
+	// 8 bit or 16 bit (high resolution) samples
+	if ( dwRiffChunk != ToDword('R', 'I', 'F', 'F') || 
+		( dwRiffSize != dwCheckSize + 4096*2 && dwRiffSize != dwCheckSize + 4096*4 ) )
 	{
 		reader.Close();
 		return false;
@@ -45,7 +47,8 @@ bool CImport::LoadWave(char* strName /*= NULL*/)
 
 	ui32 dwDataChunk, dwDataSize;
 	reader >> dwDataChunk >> dwDataSize;
-	if ( dwDataChunk != ToDword('d', 'a', 't', 'a') || dwDataSize != 4096*2 )
+	if ( dwDataChunk != ToDword('d', 'a', 't', 'a') || dwDataSize != 4096*(ui32)WaveFormat.nBlockAlign ||
+		dwRiffSize != dwCheckSize + dwDataSize )
 	{
 		reader.Close();
 		return false;
@@ -54,10 +57,20 @@ bool CImport::LoadWave(char* strName /*= NULL*/)
 	for (int i=0; i< (int)BIOS::ADC::GetCount(); i++)
 	{
 		BIOS::ADC::SSample& Sample = *(BIOS::ADC::SSample*)&BIOS::ADC::GetAt(i);
+		if ( WaveFormat.wBitsPerSample == 16 )
+		{
+			// the capture buffer has 8 bits per sample, rounded
+			ui16 wCH1, wCH2;
+			reader >> CStream( &wCH1, sizeof(wCH1) ) >> CStream( &wCH2, sizeof(wCH2) );
+			Sample.CH[0] = (ui8)min( ( (wCH1 ^ 0x8000) + 0x80 ) >> 8, 255 );
+			Sample.CH[1] = (ui8)min( ( (wCH2 ^ 0x8000) + 0x80 ) >> 8, 255 );
+			continue;
+		}
 		reader 
 			>> Sample.CH[0]
 			>> Sample.CH[1];
 	}
+	CCaptureStore::Update();
 
 	// junk
 	ui32 dwJunkChunk, dwJunkSize, dwJunkHead;
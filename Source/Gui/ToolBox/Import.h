@@ -5,6 +5,7 @@
 #include <Source/Core/Settings.h>
 #include <Source/Gui/Oscilloscope/Controls/GraphBase.h>
 #include <Source/Core/BufferedIo.h>
+#include <Source/Gui/Oscilloscope/Core/CaptureStore.h>
 
 class CImport
 {
@@ -20,6 +21,7 @@ public:
 			reader >> nValue;
 		}
 		reader.Close();
+		CCaptureStore::Update();
 	}
 	bool LoadWave(char* strName);
 };
@@ -38,6 +38,12 @@ void CWndToolbox::Create( CWnd* pParent )
 		m_bAdcEnabled ? "\x10 Pause" : "\x10 Resume" );
 	PrintBold( m_rcClient.left + 8, m_rcClient.top + 2 + 2*16, FOC(2), RGB565(000000), "\x10 Reset setings");
 	PrintBold( m_rcClient.left + 8, m_rcClient.top + 2 + 3*16, FOC(3), RGB565(000000), "\x10 Save setings");
+	PrintBold( m_rcClient.left + 8, m_rcClient.top + 2 + 4*16, FOC(4), RGB565(000000), 
+		CCoreRecorder::IsRecording() ? "\x10 Stop recording" : "\x10 Record captures" );
+	char strReplay[32];
+	BIOS::DBG::sprintf( strReplay, CCoreRecorder::IsReplaying() ? "\x10 Stop replay \x11%s\x10" : "\x10 Replay \x11%s\x10",
+		CCoreRecorder::ppszTextSpeed[ CCoreRecorder::GetSpeed() ] );
+	PrintBold( m_rcClient.left + 8, m_rcClient.top + 2 + 5*16, FOC(5), RGB565(000000), strReplay );
 
 	char str[32];
 	BIOS::DBG::sprintf(str, "bat %d%%", BIOS::SYS::GetBattery());
@@ -96,7 +102,16 @@ void CWndToolbox::PrintBold( int x, int y, ui16 clrFront, ui16 clrBorder, PCSTR
 		return;
 	}
 	if ( nKey == BIOS::KEY::KeyLeft || nKey == BIOS::KEY::KeyRight )
+	{
+		// replay speed
+		int nSpeed = CCoreRecorder::GetSpeed() + ( nKey == BIOS::KEY::KeyLeft ? -1 : 1 );
+		if ( m_nFocus == MenuReplay && nSpeed >= 0 && nSpeed <= CCoreRecorder::_SpeedMax )
+		{
+			CCoreRecorder::SetSpeed( (CCoreRecorder::ESpeed)nSpeed );
+			Invalidate();
+		}
 		return;
+	}
 
 	m_nFocus = -1;
 	m_bRunning = FALSE;
@@ -138,7 +153,7 @@ void CWndToolbox::DoModal()
 	ShowWindow( CWnd::SwHide );
 	/*
 #ifdef _WIN32
-	BIOS::LCD::PutImage( m_rcClient, buffer );
+	BIOS::LCD::BlitColumns( m_rcClient, buffer, m_rcClient.Height() );
 #endif*/
 
 	switch ( GetResult() )
@@ -157,6 +172,26 @@ void CWndToolbox::DoModal()
 		case MenuSave:
 			Settings.Save();
 			break;
+		case MenuRecord:
+			if ( CCoreRecorder::IsRecording() )
+				CCoreRecorder::StopRecording();
+			else if ( CCoreRecorder::StartRecording() )
+				m_bAdcEnabled = true;
+			else
+				MainWnd.m_wndMessage.Show( &MainWnd, "Record", "Cannot create file", RGB565(FFFF00) );
+			break;
+		case MenuReplay:
+			// the acquisition is stopped while the frames are replayed
+			if ( CCoreRecorder::IsReplaying() )
+			{
+				CCoreRecorder::StopReplay();
+				m_bAdcEnabled = true;
+			}
+			else if ( CCoreRecorder::StartReplay() )
+				m_bAdcEnabled = false;
+			else
+				MainWnd.m_wndMessage.Show( &MainWnd, "Replay", "No recording found", RGB565(FFFF00) );
+			break;
 		case -1: break;
 	}
 
@@ -10,7 +10,7 @@ class CWndToolbox : public CWnd, public CThread, public CExport
 public:
 	enum {
 		Width = 200,
-		Height = 88
+		Height = 120
 	};
 
 	enum {
@@ -18,7 +18,9 @@ public:
 		MenuManager = 0,
 		MenuReset = 2,
 		MenuSave = 3,
-		MenuMax = MenuSave
+		MenuRecord = 4,
+		MenuReplay = 5,
+		MenuMax = MenuReplay
 	};
 
 public:
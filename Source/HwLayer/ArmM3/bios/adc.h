@@ -209,6 +209,27 @@ void BIOS::ADC::GetBufferRange(int& nBegin, int& nEnd)
   }
 }
 
+/*static*/ void BIOS::ADC::Read(TSample* pTarget, int nCount)
+{
+	for ( int i = 0; i < nCount; i++ )
+		pTarget[i] = Get();
+}
+
+/*static*/ void BIOS::ADC::CopySegment(int nFirst, int nCount, int nTarget)
+{
+	_ASSERT( nFirst >= 0 && nFirst + nCount <= ADCSIZE && nTarget + nCount <= ADCSIZE );
+
+	// whole FIFO has to be read to keep the read pointer aligned
+	for ( int i = 0; i < ADCSIZE; i++ )
+	{
+		ui32 nSample = Get();
+		if ( i < nFirst || i >= nFirst + nCount )
+			continue;
+		ui32& nTargetSample = g_ADCMem[nTarget + i - nFirst];
+		nTargetSample = ( nSample & 0x00ffffff ) | ( nTargetSample & 0xff000000 );
+	}
+}
+
 /*static*/ unsigned long BIOS::ADC::GetCount()
 {
 	return ADCSIZE;
@@ -14,6 +14,33 @@ int m_nColdBoot = -1;
 	return vu32Tick;
 }
 
+/*static*/ ui32 BIOS::SYS::GetMicros()
+{
+	// DWT cycle counter of the cortex core running at 72 MHz, it overflows
+	// every 59 seconds, so the elapsed cycles are accumulated at every call
+	static ui32 nLastCycles = 0;
+	static ui32 nCycles = 0;
+	static ui32 nMicros = 0;
+
+	vu32* pDemcr = (vu32*)0xE000EDFC;
+	vu32* pDwtCtrl = (vu32*)0xE0001000;
+	vu32* pDwtCycCnt = (vu32*)0xE0001004;
+	if ( !(*pDwtCtrl & 1) )
+	{
+		*pDemcr |= 1<<24;	// TRCENA
+		*pDwtCycCnt = 0;
+		*pDwtCtrl |= 1;		// CYCCNTENA
+		nLastCycles = 0;
+	}
+
+	ui32 nCurrent = *pDwtCycCnt;
+	nCycles += nCurrent - nLastCycles;
+	nLastCycles = nCurrent;
+	nMicros += nCycles / 72;
+	nCycles %= 72;
+	return nMicros;
+}
+
 void BIOS::SYS::Standby( bool bEnterSleep )
 {
     __Set(STANDBY, bEnterSleep ? EN : DN);
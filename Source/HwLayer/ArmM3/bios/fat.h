@@ -37,6 +37,13 @@ BIOS::FAT::EResult Result(FRESULT r)
 	    FRESULT r = f_open(&g_file, strName, FA_READ | FA_OPEN_EXISTING);
 		return Result(r);
 	}
+	if ( nIoMode == BIOS::DSK::IoAppend )
+	{
+	    FRESULT r = f_open(&g_file, strName, FA_WRITE | FA_OPEN_ALWAYS);
+		if ( r == FR_OK )
+			r = f_lseek(&g_file, g_file.fsize);
+		return Result(r);
+	}
     return BIOS::FAT::EIntError;
 }
 
@@ -11,6 +11,7 @@
 
 CRect m_rcBuffer;
 CPoint m_cpBuffer;
+const CClipRegion* m_pClip = NULL;
 
 #include <stdarg.h>
 #include "lowlcd.h"
@@ -65,6 +66,8 @@ CPoint m_cpBuffer;
 {
 	if (!str || !*str)
 		return 0;
+	// the application RAM has no room for the text cache (CTextCache), the
+	// glyphs are always drawn
 	int _x = x;
 	for (;*str; str++)
 	{
@@ -99,6 +102,11 @@ CPoint m_cpBuffer;
 
 /*static*/ void BIOS::LCD::Clear(unsigned short clr)
 {
+	if ( m_pClip && m_pClip->IsActive() )
+	{
+		Bar(0, 0, 400, 240, clr);
+		return;
+	}
   __Point_SCR(0, 0); 
   __LCD_Fill(&clr,240*200);//Clear Half Screen
   __LCD_DMA_Ready();
@@ -144,6 +152,8 @@ CPoint m_cpBuffer;
 		for (int y=y1; y<y2; y++)
 			if ( !_Round(min(x-x1, x2-x-1), min(y-y1, y2-y-1)) )
 			{
+				if ( m_pClip && m_pClip->IsHidden(x, y) )
+					continue;
 			  __Point_SCR(x, 239-y);
 				ui16 nOld = __LCD_GetPixl();
 				//ui16 nOld = GetPixel(x, y);
@@ -162,6 +172,8 @@ CPoint m_cpBuffer;
 
 /*static*/ void BIOS::LCD::PutPixel(int x, int y, unsigned short clr)
 {
+	if ( m_pClip && m_pClip->IsHidden(x, y) )
+		return;
   __Point_SCR(x, 239-y);
   __LCD_SetPixl(clr);
 }
@@ -180,7 +192,18 @@ CPoint m_cpBuffer;
 	BIOS::LCD::Bar(rc.right-1, rc.top, rc.right, rc.bottom, clr);
 }
 
-/*static*/ void BIOS::LCD::Bar(int x1, int y1, int x2, int y2, unsigned short clr)
+/*static*/ void BIOS::LCD::SetClip(const CClipRegion* pClip)
+{
+	m_pClip = pClip;
+}
+
+/*static*/ void BIOS::LCD::GetTextStats(ui32& nHits, ui32& nMisses)
+{
+	nHits = 0;
+	nMisses = 0;
+}
+
+void _Bar(int x1, int y1, int x2, int y2, unsigned short clr)
 {
 	ui32 cnt = (x2-x1)*(y2-y1);
 	if ( cnt >= 48000 )
@@ -200,11 +223,37 @@ CPoint m_cpBuffer;
   __LCD_DMA_Ready();
   __LCD_Set_Block(0, 399, 0, 239);
 }
+
+/*static*/ void BIOS::LCD::Bar(int x1, int y1, int x2, int y2, unsigned short clr)
+{
+	if ( !m_pClip || !m_pClip->IsActive() )
+	{
+		_Bar(x1, y1, x2, y2, clr);
+		return;
+	}
+	CRect arrPieces[CClipRegion::MaxPieces];
+	int nPieces = m_pClip->GetVisible(CRect(x1, y1, x2, y2), arrPieces, COUNT(arrPieces));
+	for (int i=0; i<nPieces; i++)
+		_Bar(arrPieces[i].left, arrPieces[i].top, arrPieces[i].right, arrPieces[i].bottom, clr);
+}
                                                                  
 /*static*/ void BIOS::LCD::Pattern(int x1, int y1, int x2, int y2, const ui16 *pat, int l)
 {
 	const ui16* patb = pat;
 	const ui16* pate = patb + l;
+
+	if ( m_pClip && m_pClip->IsActive() )
+	{
+		// same order as the stream below, the pixels are clipped one by one
+		for (int x=x1; x<x2; x++)
+			for (int y=y2-1; y>=y1; y--)
+			{
+				PutPixel(x, y, *pat);
+				if (++pat == pate)
+					pat = patb;
+			}
+		return;
+	}
 	
   __LCD_Set_Block(x1, x2-1, 240-y2, 239-y1);
 
@@ -236,15 +285,97 @@ CPoint m_cpBuffer;
 
 /*static*/ void BIOS::LCD::PutImage(const CRect& rcRect, ui16* pBuffer )
 {
-  __LCD_Set_Block(rcRect.left, rcRect.right-1, 240-rcRect.bottom, 239-rcRect.top);
+	BlitColumns(rcRect, pBuffer, rcRect.Height());
+}
 
-	for (int y=rcRect.top; y<rcRect.bottom; y++)
-		for (int x=rcRect.left; x<rcRect.right; x++)
-			__LCD_SetPixl(*pBuffer++);
+void _BlitColumns(const CRect& rc, const ui16* pBuffer, int nStride)
+{
+	int nHeight = rc.Height();
+	if ( rc.Width() <= 0 || nHeight <= 0 )
+		return;
 
+  __Row_DMA_Ready();
+  __LCD_Set_Block(rc.left, rc.right-1, 240-rc.bottom, 239-rc.top);
+	if ( nStride == nHeight )
+	{
+		// adjacent columns form one stream, the DMA counter is 16 bit
+		int nCount = rc.Width()*nHeight;
+		while ( nCount > 0 )
+		{
+			int nChunk = min(nCount, 0x8000);
+			__LCD_Copy(pBuffer, nChunk);
+			__LCD_DMA_Ready();
+			pBuffer += nChunk;
+			nCount -= nChunk;
+		}
+	} else
+	{
+		for (int x=rc.left; x<rc.right; x++, pBuffer += nStride)
+		{
+			__LCD_Copy(pBuffer, nHeight);
+			__LCD_DMA_Ready();
+		}
+	}
   __LCD_Set_Block(0, 399, 0, 239);
 }
 
+void _BlitRect(const CRect& rc, const ui16* pBuffer, int nStride)
+{
+	int nWidth = rc.Width();
+	int nHeight = rc.Height();
+	if ( nWidth <= 0 || nHeight <= 0 )
+		return;
+
+	// a single row is a single column-major stream too
+	if ( nHeight == 1 )
+	{
+		_BlitColumns(rc, pBuffer, 1);
+		return;
+	}
+
+  __LCD_Set_Block(rc.left, rc.right-1, 240-rc.bottom, 239-rc.top);
+	const ui16* pBottom = pBuffer + (nHeight-1)*nStride;
+	for (int x=0; x<nWidth; x++)
+	{
+		const ui16* p = pBottom + x;
+		for (int y=nHeight; y--; p -= nStride)
+			__LCD_SetPixl(*p);
+	}
+  __LCD_Set_Block(0, 399, 0, 239);
+}
+
+/*static*/ void BIOS::LCD::BlitColumns(const CRect& rc, const ui16* pBuffer, int nStride)
+{
+	if ( !m_pClip || !m_pClip->IsActive() )
+	{
+		_BlitColumns(rc, pBuffer, nStride);
+		return;
+	}
+	CRect arrPieces[CClipRegion::MaxPieces];
+	int nPieces = m_pClip->GetVisible(rc, arrPieces, COUNT(arrPieces));
+	for (int i=0; i<nPieces; i++)
+	{
+		const CRect& rcPiece = arrPieces[i];
+		_BlitColumns(rcPiece, pBuffer + (rcPiece.left-rc.left)*nStride + (rc.bottom-rcPiece.bottom), nStride);
+	}
+}
+
+/*static*/ void BIOS::LCD::BlitRect(const CRect& rc, const ui16* pBuffer, int nStride)
+{
+	if ( !m_pClip || !m_pClip->IsActive() )
+	{
+		_BlitRect(rc, pBuffer, nStride);
+		return;
+	}
+	CRect arrPieces[CClipRegion::MaxPieces];
+	int nPieces = m_pClip->GetVisible(rc, arrPieces, COUNT(arrPieces));
+	for (int i=0; i<nPieces; i++)
+	{
+		const CRect& rcPiece = arrPieces[i];
+		_BlitRect(rcPiece, pBuffer + (rcPiece.top-rc.top)*nStride + (rcPiece.left-rc.left), nStride);
+	}
+}
+
 /*static*/ void BIOS::LCD::Bar(const CRect& rc, unsigned short clr)
 {
 	Bar(rc.left, rc.top, rc.right, rc.bottom, clr);
@@ -296,6 +427,11 @@ CPoint m_cpBuffer;
 
 /*static*/ void BIOS::LCD::Buffer(int x, int y, unsigned short* pBuffer, int n)
 {
+	if ( m_pClip && m_pClip->IsActive() )
+	{
+		BlitColumns(CRect(x, y, x+1, y+n), pBuffer, n);
+		return;
+	}
   __Row_DMA_Ready();
   __Point_SCR(x, 240-y-n);
   __LCD_Copy(pBuffer, n);
@@ -26,6 +26,9 @@ public:
 
 		static void DelayMs(unsigned short ms);
 		static ui32 GetTick();
+		// free running microsecond counter for measuring short intervals, it wraps
+		// around so only differences are meaningful
+		static ui32 GetMicros();
 		static void Init();
 		static void Beep( int ms );
 		static int GetBattery();
@@ -80,10 +83,23 @@ public:
 		static void BufferPush(ui16 clr);
 		static void BufferEnd();
 		static void Buffer(int x, int y, unsigned short* pBuffer, int n);
+		// whole rectangle in one transfer, the LCD window is set only once.
+		// BlitRect takes rows from top to bottom, nStride pixels apart,
+		// BlitColumns takes columns in the native order of the controller
+		// (bottom to top, as Buffer and GetImage), nStride pixels apart,
+		// nStride 0 repeats the same column over the whole rectangle
+		static void BlitRect(const CRect& rc, const ui16* pBuffer, int nStride);
+		static void BlitColumns(const CRect& rc, const ui16* pBuffer, int nStride);
 		
 		static void GetImage(const CRect& rcRect, ui16* pBuffer );
 		static void PutImage(const CRect& rcRect, ui16* pBuffer );
 		static void Shadow(int x1, int y1, int x2, int y2, unsigned int nColor);
+		// drawing skips the hidden parts of the region, NULL disables clipping.
+		// GetImage and GetPixel are not affected
+		static void SetClip(const CClipRegion* pClip);
+		// opaque runs of Print come from a cache of rasterised strips, these
+		// are its counters since the start
+		static void GetTextStats(ui32& nHits, ui32& nMisses);
 	
 		static const void* GetCharRom();
 	};
@@ -155,6 +171,12 @@ public:
 //		static void GetBufferRange(int& nBegin, int& nEnd);
 
 		static void Copy(int nCount);
+		// Reads the whole capture, but keeps only samples nFirst..nFirst+nCount-1, they
+		// are stored directly into the buffer at nTarget (segmented acquisition)
+		static void CopySegment(int nFirst, int nCount, int nTarget);
+		// Reads next nCount words of the FIFO while it is being filled, caller must not
+		// read past GetPointer (roll mode)
+		static void Read(TSample* pTarget, int nCount);
 		static unsigned long GetCount();
 		static TSample& GetAt(int i);
 	};
@@ -179,7 +201,9 @@ public:
 		enum {
 			IoRead = 1,
 			IoWrite = 2,
-			IoClosed = 3
+			IoClosed = 3,
+			// FAT::Open only, writing continues at the end of an existing file
+			IoAppend = 4
 		};
 		static PVOID GetSharedBuffer();
 		static BOOL Open(FILEINFO* pFileInfo, const char* strName, ui8 nIoMode);
@@ -0,0 +1,1387 @@
+#include <stdio.h>
+#include <string.h>
+#include "device.h"
+#include "bench.h"
+#include "scenario.h"
+#include <Source/Core/Settings.h>
+#include <Source/Gui/Oscilloscope/Core/Resampler.h>
+#include <Source/Gui/Oscilloscope/Core/Interpolator.h>
+#include <Source/Gui/Oscilloscope/Core/SoftTrigger.h>
+#include <Source/Gui/Oscilloscope/Core/CoreEts.h>
+#include <Source/Gui/Oscilloscope/Core/CorePeak.h>
+#include <Source/Gui/Oscilloscope/Core/CoreHiRes.h>
+#include <Source/Gui/Oscilloscope/Core/CoreAverage.h>
+#include <Source/Gui/Oscilloscope/Core/CoreRecorder.h>
+#include <Source/Core/Bitmap.h>
+
+// Fills the buffer with a noisy sine on CH1, saw on CH2 and random digital channels,
+// the top byte is random too, it must survive the processing
+static void _FillSamples(BIOS::ADC::TSample* pSamples, int nCount, unsigned int nSeed)
+{
+	srand( nSeed );
+	for ( int i = 0; i < nCount; i++ )
+	{
+		int nCh1 = (int)( 128 + 100 * sin( i * 0.031f ) ) + (rand() & 7);
+		int nCh2 = (i * 3) & 0xff;
+		nCh1 = max( 0, min( nCh1, 255 ) );
+		pSamples[i] = nCh1 | (nCh2 << 8) | ((rand() & 3) << 16) | ((ui32)(rand() & 0xff) << 24);
+	}
+}
+
+static double _Seconds(ULONGLONG nBegin)
+{
+	return (CDevice::GetMicros() - nBegin) / 1000000.0;
+}
+
+// Resampler used by CMainWnd::Resample before, extended with the expand
+// direction, one division per channel and sample
+static BIOS::ADC::TSample _RefInterpolate(const BIOS::ADC::TSample* pSamples, int nCount, int nSample1024)
+{
+	int nBase = nSample1024 / 1024;
+	int nFraction = nSample1024 & 1023;
+
+	BIOS::ADC::SSample nSampleA;
+	nSampleA.nValue = pSamples[nBase];
+	if ( nBase + 1 >= nCount )
+		return nSampleA.nValue;
+
+	BIOS::ADC::SSample nSampleB;
+	nSampleB.nValue = pSamples[nBase + 1];
+
+	nSampleA.CH1 += (int)(nSampleB.CH1 - nSampleA.CH1) * nFraction / 1024;
+	nSampleA.CH2 += (int)(nSampleB.CH2 - nSampleA.CH2) * nFraction / 1024;
+	return nSampleA.nValue;
+}
+
+// Blackman windowed sinc of CInterpolator evaluated in double precision, the
+// samples beyond the record repeat its first and last sample
+static int _RefSinc(const ui8* pSamples, int nStride, int nLength, double fPosition)
+{
+	const int nTaps = CInterpolator::Taps;
+	int nBase = (int)floor( fPosition );
+	double fSum = 0, fWeights = 0;
+	for ( int i = 0; i < nTaps; i++ )
+	{
+		int nIndex = max( 0, min( nBase - (nTaps/2 - 1) + i, nLength-1 ) );
+		double fTime = nBase - (nTaps/2 - 1) + i - fPosition;
+		double fSinc = fTime == 0 ? 1.0 : sin( M_PI * fTime ) / ( M_PI * fTime );
+		double fWindow = 0.42 + 0.5 * cos( M_PI * fTime / (nTaps/2) ) + 0.08 * cos( 2 * M_PI * fTime / (nTaps/2) );
+		fSum += fSinc * fWindow * pSamples[nIndex * nStride];
+		fWeights += fSinc * fWindow;
+	}
+	return max( 0, min( (int)floor( fSum / fWeights + 0.5 ), 255 ) );
+}
+
+static void _RefResample(BIOS::ADC::TSample* pSamples, int nCount, int nCorrection)
+{
+	if ( nCorrection == 1024 )
+		return;
+
+	// windowed sinc from a copy of the input at the phases of the kernel table,
+	// the first sample of a shrink stays, an expand ends with the last sample
+	static BIOS::ADC::TSample arrInput[BIOS::ADC::Length];
+	memcpy( arrInput, pSamples, nCount * sizeof(BIOS::ADC::TSample) );
+	for ( int i = nCorrection < 1024 ? 1 : 0; i < nCount; i++ )
+	{
+		int nPosition = min( i * nCorrection, (nCount-1) * 1024 );
+		BIOS::ADC::SSample& nSample = (BIOS::ADC::SSample&)pSamples[i];
+		BIOS::ADC::SSample nInterpolated;
+		nInterpolated.nValue = _RefInterpolate( arrInput, nCount, nPosition );
+		int nPhase = ( nPosition & 1023 ) >> ( 10 - CInterpolator::PhaseBits );
+		double fPosition = ( nPosition >> 10 ) + nPhase / (double)CInterpolator::Phases;
+		nSample.CH[0] = _RefSinc( (const ui8*)arrInput, sizeof(BIOS::ADC::TSample), nCount, fPosition );
+		nSample.CH[1] = _RefSinc( (const ui8*)arrInput + 1, sizeof(BIOS::ADC::TSample), nCount, fPosition );
+		nSample.CH[2] = nInterpolated.CH[2];
+	}
+}
+
+static int _BenchResample()
+{
+	const int nCount = BIOS::ADC::Length;
+	const int nLoops = 2000;
+	// the double precision sinc of the reference is slow
+	const int nRefLoops = 100;
+	static BIOS::ADC::TSample arrRef[BIOS::ADC::Length];
+	static BIOS::ADC::TSample arrNew[BIOS::ADC::Length];
+	// corrections used by the timebases and some expand factors
+	const int arrCorrection[] = {492, 614, 819, 983, 1100, 1536, 2048};
+	int nFailed = 0;
+
+	printf( "correction  mismatches  reference Msamples/s  resampler Msamples/s\n" );
+	for ( int c = 0; c < (int)COUNT(arrCorrection); c++ )
+	{
+		int nCorrection = arrCorrection[c];
+
+		_FillSamples( arrRef, nCount, c );
+		memcpy( arrNew, arrRef, sizeof(arrNew) );
+		_RefResample( arrRef, nCount, nCorrection );
+		CResampler::Process( arrNew, nCount, nCorrection );
+
+		// the fixed point kernel may round CH1/CH2 differently by one
+		int nMismatch = 0;
+		for ( int i = 0; i < nCount; i++ )
+		{
+			BIOS::ADC::SSample nRef, nNew;
+			nRef.nValue = (ui32)arrRef[i];
+			nNew.nValue = (ui32)arrNew[i];
+			if ( ( nRef.nValue & 0xffff0000 ) != ( nNew.nValue & 0xffff0000 ) ||
+				abs( nRef.CH1 - nNew.CH1 ) > 1 || abs( nRef.CH2 - nNew.CH2 ) > 1 )
+				nMismatch++;
+		}
+		if ( nMismatch )
+			nFailed++;
+
+		ULONGLONG nBegin = CDevice::GetMicros();
+		for ( int i = 0; i < nRefLoops; i++ )
+			_RefResample( arrRef, nCount, nCorrection );
+		double fRef = nCount * (double)nRefLoops / _Seconds( nBegin ) / 1e6;
+
+		nBegin = CDevice::GetMicros();
+		for ( int i = 0; i < nLoops; i++ )
+			CResampler::Process( arrNew, nCount, nCorrection );
+		double fNew = nCount * (double)nLoops / _Seconds( nBegin ) / 1e6;
+
+		printf( "%10d  %10d  %20.1f  %20.1f\n", nCorrection, nMismatch, fRef, fNew );
+	}
+	return nFailed ? 1 : 0;
+}
+
+// Comparator loop used by CMeasStatistics and CSerialDecoder before, reports
+// every change of the output after the first one
+static int _RefEdges(const CSoftTrigger::TSource& src, int nLow, int nHigh, ui16* pEdges)
+{
+	int nState = -1, nEdges = 0;
+	for ( int i = 0; i < CCaptureStore::Length; i++ )
+	{
+		int nSample = src.pAnalog ? src.pAnalog[i] : CCaptureStore::GetDigitalAt( CCaptureStore::CH3, i ) * 255;
+		int nNewState = nState;
+		if ( nSample > nHigh )
+			nNewState = 1;
+		if ( nSample < nLow )
+			nNewState = 0;
+		if ( nState != -1 && nNewState != nState )
+			pEdges[nEdges++] = i;
+		nState = nNewState;
+	}
+	return nEdges;
+}
+
+static int _ScanEdges(const CSoftTrigger::TSource& src, int nLow, int nHigh, ui16* pEdges)
+{
+	int nState = -1, nEdges = 0;
+	for ( int i = 0; ( i = CSoftTrigger::FindEdge( src, i, CCaptureStore::Length, nLow, nHigh, 0, nState ) ) >= 0; i++ )
+		pEdges[nEdges++] = i;
+	return nEdges;
+}
+
+static int _BenchTrigger()
+{
+	const int nCount = BIOS::ADC::Length;
+	const int nLoops = 20000;
+	static ui16 arrRef[BIOS::ADC::Length];
+	static ui16 arrNew[BIOS::ADC::Length];
+	int nFailed = 0;
+
+	_FillSamples( &BIOS::ADC::GetAt(0), nCount, 1 );
+	CCaptureStore::Update();
+
+	// edge lists of the comparator, CH1 is a noisy sine, CH3 random bits and
+	// then a clock with nPeriod samples
+	const struct {
+		const char* strName;
+		int nSource;
+		int nLevel;
+		int nPeriod;
+	} arrEdge[] = {
+		{"CH1 128", CSettings::Trigger::_CH1, 128, 0},
+		{"CH1 40", CSettings::Trigger::_CH1, 40, 0},
+		{"CH1 250", CSettings::Trigger::_CH1, 250, 0},
+		{"CH3", CSettings::Trigger::_CH3, 128, 0},
+		{"CH3 clock", CSettings::Trigger::_CH3, 128, 100}
+	};
+
+	printf( "edges       count  mismatches  reference Msamples/s  engine Msamples/s\n" );
+	for ( int c = 0; c < (int)COUNT(arrEdge); c++ )
+	{
+		if ( arrEdge[c].nPeriod )
+		{
+			for ( int i = 0; i < nCount; i++ )
+			{
+				BIOS::ADC::TSample& nSample = BIOS::ADC::GetAt(i);
+				nSample = ( nSample & ~(1 << 16) ) | ( ( (i / arrEdge[c].nPeriod) & 1 ) << 16 );
+			}
+			CCaptureStore::Update();
+		}
+		CSoftTrigger::TSource src = CSoftTrigger::GetSource( arrEdge[c].nSource );
+		int nLow = arrEdge[c].nLevel - CSoftTrigger::Hysteresis;
+		int nHigh = arrEdge[c].nLevel + CSoftTrigger::Hysteresis;
+
+		int nRef = _RefEdges( src, nLow, nHigh, arrRef );
+		int nNew = _ScanEdges( src, nLow, nHigh, arrNew );
+		int nMismatch = abs( nRef - nNew );
+		for ( int i = 0; i < min( nRef, nNew ); i++ )
+			if ( arrRef[i] != arrNew[i] )
+				nMismatch++;
+		if ( nMismatch )
+			nFailed++;
+
+		ULONGLONG nBegin = CDevice::GetMicros();
+		for ( int i = 0; i < nLoops; i++ )
+			_RefEdges( src, nLow, nHigh, arrRef );
+		double fRef = nCount * (double)nLoops / _Seconds( nBegin ) / 1e6;
+
+		nBegin = CDevice::GetMicros();
+		for ( int i = 0; i < nLoops; i++ )
+			_ScanEdges( src, nLow, nHigh, arrNew );
+		double fNew = nCount * (double)nLoops / _Seconds( nBegin ) / 1e6;
+
+		printf( "%-10s  %5d  %10d  %20.1f  %17.1f\n", arrEdge[c].strName, nNew, nMismatch, fRef, fNew );
+	}
+
+	// throughput of the full scan for every trigger type on CH1
+	const char* arrTypes[] = {"", "edge", "pulse", "runt", "window", "slew"};
+	printf( "scan        candidates  Msamples/s\n" );
+	for ( int t = CSoftTrigger::Edge; t <= CSoftTrigger::Slew; t++ )
+	{
+		CSoftTrigger::TCondition cond;
+		cond.eType = (CSoftTrigger::EType)t;
+		cond.nPolarity = 1;
+		cond.nLevel = 60;
+		cond.nLevel2 = 200;
+		cond.nHysteresis = CSoftTrigger::Hysteresis;
+		cond.nTime = 50;
+		cond.bLower = false;
+		CSoftTrigger::TSource src = CSoftTrigger::GetSource( CSettings::Trigger::_CH1 );
+
+		int nCandidates = 0;
+		ULONGLONG nBegin = CDevice::GetMicros();
+		for ( int i = 0; i < nLoops; i++ )
+			nCandidates = CSoftTrigger::Scan( src, cond, 0, nCount, arrNew, nCount );
+		double fNew = nCount * (double)nLoops / _Seconds( nBegin ) / 1e6;
+
+		printf( "%-10s  %10d  %10.1f\n", arrTypes[t], nCandidates, fNew );
+	}
+	return nFailed ? 1 : 0;
+}
+
+// Sine with the period of fPeriod raw samples starting at random phase, like
+// captures of a repetitive signal triggered asynchronously to the sample clock
+static void _FillCapture(BIOS::ADC::TSample* pSamples, int nCount, float fPeriod)
+{
+	float fPhase = (rand() & 0xffff) / 65536.0f * fPeriod;
+	for ( int i = 0; i < nCount; i++ )
+	{
+		int nCh1 = (int)( 128.5f + 100 * sin( 2 * 3.14159265f * (i + fPhase) / fPeriod ) ) + (rand() % 3) - 1;
+		pSamples[i] = max( 0, min( nCh1, 255 ) );
+	}
+}
+
+static int _BenchEts()
+{
+	const float fPeriod = 7.3f;
+	const int arrCheckpoints[] = {1, 4, 16, 64, 256};
+	int nFailed = 0;
+
+	// the benchmarks run without the application, the constructor makes these
+	// settings current. Fastest timebase, rising edge at the middle level
+	static CSettings settings;
+	Settings.Time.Resolution = CSettings::TimeBase::_200ns;
+	Settings.Time.Shift = 30;
+	Settings.Trig.nPosition = 150;
+	Settings.Trig.nLevel = 128;
+	Settings.Trig.Type = CSettings::Trigger::_EdgeLH;
+	Settings.Trig.Source = CSettings::Trigger::_CH1;
+	int nCorrection = Settings.Time.pfValueResolutionCorrection[ (NATIVEENUM)Settings.Time.Resolution ];
+	int nOrigin = Settings.Trig.nPosition - Settings.Time.Shift;
+
+	srand( 1 );
+	CCoreEts::Reset();
+	printf( "acquisitions  filled %%  rms error  time/acq us\n" );
+	ULONGLONG nTime = 0;
+	for ( int c = 0, nAcquired = 0; c < (int)COUNT(arrCheckpoints); c++ )
+	{
+		for ( ; nAcquired < arrCheckpoints[c]; nAcquired++ )
+		{
+			_FillCapture( &BIOS::ADC::GetAt(0), BIOS::ADC::Length, fPeriod );
+			ULONGLONG nBegin = CDevice::GetMicros();
+			CCaptureStore::Update();
+			CCoreEts::Acquire();
+			nTime += CDevice::GetMicros() - nBegin;
+		}
+		CCoreEts::Render();
+
+		// compare the rendered grid with the ideal waveform, zero phase is at
+		// the trigger position
+		double fSum2 = 0;
+		for ( int k = 0; k < CCoreEts::Bins; k++ )
+		{
+			float fRaw = (k - nOrigin) * nCorrection / (float)(CCoreEts::Factor * 1024);
+			float fIdeal = 128.0f + 100 * sin( 2 * 3.14159265f * fRaw / fPeriod );
+			float fError = CCaptureStore::GetAnalogAt( CCaptureStore::CH1, Settings.Time.Shift + k ) - fIdeal;
+			fSum2 += fError * fError;
+		}
+		double fRms = sqrt( fSum2 / CCoreEts::Bins );
+		printf( "%12d  %8d  %9.2f  %11.1f\n", nAcquired, CCoreEts::GetProgress(), fRms, nTime / (double)nAcquired );
+		if ( nAcquired >= 64 && ( CCoreEts::GetProgress() < 100 || fRms > 4.0 ) )
+			nFailed++;
+	}
+	return nFailed ? 1 : 0;
+}
+
+static int _BenchPeak()
+{
+	const int nLoops = 2000;
+	const int nGlitches = 40;
+	int nFailed = 0;
+
+	static CSettings settings;
+	Settings.Time.Resolution = CSettings::TimeBase::_500us;
+	Settings.Time.Acquire = CSettings::TimeBase::_AcqPeak;
+	Settings.Trig.nPosition = 150;
+
+	// one sample wide glitches on CH1, plain decimation keeps only those
+	// falling on the kept sample
+	_FillSamples( &BIOS::ADC::GetAt(0), BIOS::ADC::Length, 1 );
+	for ( int i = 0; i < nGlitches; i++ )
+	{
+		BIOS::ADC::TSample& sample = BIOS::ADC::GetAt( 37 + i * 97 );
+		sample = ( sample & ~0xff ) | 255;
+	}
+
+	ULONGLONG nBegin = CDevice::GetMicros();
+	for ( int i = 0; i < nLoops; i++ )
+		CCorePeak::Process();
+	double fTime = _Seconds( nBegin );
+
+	// scalar reference over the raw buffer
+	int nMismatches = 0, nPoints = 0, nGlitchesPeak = 0, nGlitchesPlain = 0;
+	for ( int i = 0; i < CCaptureStore::Length; i++ )
+	{
+		int nMin[2], nMax[2];
+		if ( !CCorePeak::GetEnvelope( CCaptureStore::CH1, i, nMin[0], nMax[0] ) ||
+			!CCorePeak::GetEnvelope( CCaptureStore::CH2, i, nMin[1], nMax[1] ) )
+			continue;
+		int nRaw = ( nPoints++ ) * CCorePeak::Decimation;
+		for ( int c = 0; c < 2; c++ )
+		{
+			int nRefMin = 255, nRefMax = 0;
+			for ( int j = nRaw; j < nRaw + CCorePeak::Decimation; j++ )
+			{
+				int nSample = ( BIOS::ADC::GetAt(j) >> (c*8) ) & 0xff;
+				nRefMin = min( nRefMin, nSample );
+				nRefMax = max( nRefMax, nSample );
+			}
+			if ( nMin[c] != nRefMin || nMax[c] != nRefMax )
+				nMismatches++;
+		}
+		if ( ( BIOS::ADC::GetAt(nRaw) & 0xff ) != CCaptureStore::GetAnalogAt( CCaptureStore::CH1, i ) )
+			nMismatches++;
+		if ( nMax[0] == 255 )
+			nGlitchesPeak++;
+		if ( CCaptureStore::GetAnalogAt( CCaptureStore::CH1, i ) == 255 )
+			nGlitchesPlain++;
+	}
+
+	printf( "points  mismatches  glitches peak  glitches decimated  us/capture\n" );
+	printf( "%6d  %10d  %13d  %18d  %10.1f\n", nPoints, nMismatches, nGlitchesPeak, nGlitchesPlain,
+		fTime * 1e6 / nLoops );
+	if ( nMismatches > 0 || nPoints != CCaptureStore::Length / CCorePeak::Decimation ||
+		nGlitchesPeak < nGlitchesPlain )
+		nFailed++;
+	return nFailed ? 1 : 0;
+}
+
+// Slow sine with about 1.5 LSB of noise on CH1, the ideal value of raw sample
+// i is 128 + 100 * sin(i * 0.002)
+static int _BenchHiRes()
+{
+	const int nLoops = 2000;
+	const int N = CCorePeak::Decimation;
+	int nFailed = 0;
+
+	static CSettings settings;
+	Settings.Time.Resolution = CSettings::TimeBase::_500us;
+	Settings.Time.Acquire = CSettings::TimeBase::_AcqHiRes;
+	Settings.Trig.nPosition = 150;
+
+	srand( 1 );
+	for ( int i = 0; i < BIOS::ADC::Length; i++ )
+	{
+		int nNoise = (rand() % 5) + (rand() % 5) - 4;
+		int nCh1 = (int)( 128.5f + 100 * sin( i * 0.002f ) ) + nNoise;
+		BIOS::ADC::GetAt(i) = max( 0, min( nCh1, 255 ) ) | ((i & 0xff) << 8);
+	}
+
+	ULONGLONG nBegin = CDevice::GetMicros();
+	for ( int i = 0; i < nLoops; i++ )
+		CCaptureStore::Update();
+	double fUpdate = _Seconds( nBegin );
+	nBegin = CDevice::GetMicros();
+	for ( int i = 0; i < nLoops; i++ )
+		CCoreHiRes::Process();
+	double fHiRes = _Seconds( nBegin );
+
+	// exact reference of the kernel, then the error of the plain 8 bit sample
+	// and of the 16 bit average against the ideal signal
+	int nFirst, nCount;
+	CCorePeak::GetRecord( nFirst, nCount );
+	int nMismatches = 0;
+	double fSum8 = 0, fSum16 = 0;
+	for ( int k = 0; k < nCount; k++ )
+	{
+		int arrSum[2] = {0, 0};
+		double fIdeal = 0;
+		for ( int j = k * N; j < (k + 1) * N; j++ )
+		{
+			arrSum[0] += BIOS::ADC::GetAt(j) & 0xff;
+			arrSum[1] += ( BIOS::ADC::GetAt(j) >> 8 ) & 0xff;
+			fIdeal += 128 + 100 * sin( j * 0.002 );
+		}
+		fIdeal /= N;
+		for ( int c = 0; c < 2; c++ )
+			if ( CCaptureStore::GetFineAt( c, nFirst + k ) != ( arrSum[c] * 256 + N/2 ) / N )
+				nMismatches++;
+
+		double fPlain = ( BIOS::ADC::GetAt( k * N ) & 0xff ) - ( 128 + 100 * sin( k * N * 0.002 ) );
+		double fFine = CCaptureStore::GetFineAt( CCaptureStore::CH1, nFirst + k ) / 256.0 - fIdeal;
+		fSum8 += fPlain * fPlain;
+		fSum16 += fFine * fFine;
+	}
+	double fRms8 = sqrt( fSum8 / nCount );
+	double fRms16 = sqrt( fSum16 / nCount );
+	double fGain = log( fRms8 / fRms16 ) / log( 2.0 );
+
+	printf( "points  mismatches  rms 8 bit  rms 16 bit  bits gained  us/capture  store us/capture\n" );
+	printf( "%6d  %10d  %9.3f  %10.3f  %11.2f  %10.1f  %16.1f\n", nCount, nMismatches, fRms8, fRms16, fGain,
+		fHiRes * 1e6 / nLoops, fUpdate * 1e6 / nLoops );
+	if ( nMismatches > 0 || fGain < 1.0 )
+		nFailed++;
+	return nFailed ? 1 : 0;
+}
+
+// Sweeps of the same sine with independent noise of 2 LSB rms on CH1 and CH2,
+// every accumulator and mode runs over the full capture. The linear average of
+// the first N sweeps is checked against a scalar sum, the noise has to drop
+// close to sqrt(N) for linear and sqrt(2N-1) for exponential averaging
+static void _FillSweep(int nSweep)
+{
+	srand( nSweep + 1 );
+	for ( int i = 0; i < BIOS::ADC::Length; i++ )
+	{
+		int nCh1 = (int)( 128.5f + 100 * sin( i * 0.01f ) ) + (rand() % 5) + (rand() % 5) - 4;
+		int nCh2 = 128 + (rand() % 5) + (rand() % 5) - 4;
+		BIOS::ADC::GetAt(i) = nCh1 | (nCh2 << 8);
+	}
+}
+
+static int _BenchAverage()
+{
+	const int nSweeps = 64;
+	int nFailed = 0;
+
+	static CSettings settings;
+	Settings.Time.Resolution = CSettings::TimeBase::_500us;
+	Settings.Time.Acquire = CSettings::TimeBase::_AcqNormal;
+	Settings.Time.Shift = 0;
+	Settings.Disp.AverageCount = CSettings::Display::_Avg16;
+	int N = 2 << (NATIVEENUM)Settings.Disp.AverageCount;
+	int nLength = CCoreAverage::Length;
+
+	static int arrSum[CCoreAverage::Length];
+	printf( "mode    accumulator  sweeps  mismatches  rms single  rms average  reduction  expected  us/sweep\n" );
+	for ( int nMode = 0; nMode < 4; nMode++ )
+	{
+		bool bLinear = nMode < 2;
+		Settings.Disp.Average = bLinear ? CSettings::Display::_AvgLinear : CSettings::Display::_AvgExp;
+		Settings.Disp.Accumulator = (nMode & 1) ? CSettings::Display::_Acc32 : CSettings::Display::_Acc16;
+		CCoreAverage::Reset();
+		memset( arrSum, 0, sizeof(arrSum) );
+
+		// linear average is compared after exactly N sweeps, before any drop
+		int nCount = bLinear ? N : nSweeps;
+		double fTime = 0;
+		for ( int k = 0; k < nCount; k++ )
+		{
+			_FillSweep( k );
+			CCaptureStore::Update();
+			for ( int i = 0; i < nLength; i++ )
+				arrSum[i] += BIOS::ADC::GetAt(i) & 0xff;
+			ULONGLONG nBegin = CDevice::GetMicros();
+			CCoreAverage::Process();
+			fTime += _Seconds( nBegin );
+		}
+
+		int nMismatches = 0;
+		double fSingle = 0, fAverage = 0;
+		for ( int i = 0; i < nLength; i++ )
+		{
+			if ( bLinear && CCaptureStore::GetFineAt( CCaptureStore::CH1, i ) != ( arrSum[i] * 256 + N/2 ) / N )
+				nMismatches++;
+			double fIdeal = 128 + 100 * sin( i * 0.01 );
+			double fPlain = ( BIOS::ADC::GetAt(i) & 0xff ) - fIdeal;
+			double fFine = CCaptureStore::GetFineAt( CCaptureStore::CH1, i ) / 256.0 - fIdeal;
+			fSingle += fPlain * fPlain;
+			fAverage += fFine * fFine;
+		}
+		fSingle = sqrt( fSingle / nLength );
+		fAverage = sqrt( fAverage / nLength );
+		double fReduction = fSingle / fAverage;
+		double fExpected = sqrt( bLinear ? (double)N : 2.0 * N - 1 );
+
+		printf( "%-6s  %11s  %6d  %10d  %10.3f  %11.3f  %9.2f  %8.2f  %8.1f\n", bLinear ? "linear" : "exp",
+			CSettings::Display::ppszTextAccumulator[ (NATIVEENUM)Settings.Disp.Accumulator ], nCount, nMismatches,
+			fSingle, fAverage, fReduction, fExpected, fTime * 1e6 / nCount );
+		if ( nMismatches > 0 || fReduction < fExpected * 0.7 )
+			nFailed++;
+	}
+	Settings.Disp.Average = CSettings::Display::_AvgOff;
+	return nFailed ? 1 : 0;
+}
+
+// Two sources loaded with the same scenario have to produce identical captures,
+// the bus channels are decoded back from the samples: UART on CH2, I2C on
+// CH3 (SCL) and CH4 (SDA), CAN on CH1 of a second scenario including the
+// stuff bits and the CRC
+static void _LoadScenario(CScenarioSource& source, const char** arrLines, int nLines)
+{
+	for ( int i = 0; i < nLines; i++ )
+		if ( !source.Parse( arrLines[i] ) )
+			printf( "cannot parse '%s'\n", arrLines[i] );
+	source.Configure( 1e-3f );
+}
+
+static int _DecodeUart(const BIOS::ADC::TSample* pSamples, int nBit, ui8* pData, int nMax)
+{
+	int nCount = 0;
+	for ( int i = 1; i < BIOS::ADC::Length && nCount < nMax; i++ )
+	{
+		bool bFalling = ( (pSamples[i-1] >> 8) & 0xff ) >= 128 && ( (pSamples[i] >> 8) & 0xff ) < 128;
+		if ( !bFalling )
+			continue;
+		int nByte = 0;
+		for ( int j = 0; j < 8; j++ )
+		{
+			int nCenter = i + nBit + nBit/2 + j*nBit;
+			if ( nCenter >= BIOS::ADC::Length )
+				return nCount;
+			if ( ( (pSamples[nCenter] >> 8) & 0xff ) >= 128 )
+				nByte |= 1 << j;
+		}
+		pData[nCount++] = (ui8)nByte;
+		i += 9*nBit;
+	}
+	return nCount;
+}
+
+static int _DecodeI2c(const BIOS::ADC::TSample* pSamples, ui8* pData, int nMax, int& nNacks)
+{
+	int nCount = 0, nBits = 0, nWord = 0;
+	bool bFrame = false;
+	nNacks = 0;
+	for ( int i = 1; i < BIOS::ADC::Length; i++ )
+	{
+		int nScl = (pSamples[i] >> 16) & 1, nPrevScl = (pSamples[i-1] >> 16) & 1;
+		int nSda = (pSamples[i] >> 17) & 1, nPrevSda = (pSamples[i-1] >> 17) & 1;
+		if ( nScl && nPrevScl && nPrevSda != nSda )
+		{
+			// start or stop condition
+			bFrame = !nSda;
+			nBits = nWord = 0;
+			if ( !bFrame )
+				break;
+			continue;
+		}
+		if ( !bFrame || !nScl || nPrevScl )
+			continue;
+		nWord = (nWord << 1) | nSda;
+		if ( ++nBits == 9 )
+		{
+			if ( nCount < nMax )
+				pData[nCount++] = (ui8)(nWord >> 1);
+			nNacks += nWord & 1;
+			nBits = nWord = 0;
+		}
+	}
+	return nCount;
+}
+
+// returns the number of data bytes or -1 when the frame is broken
+static int _DecodeCan(const BIOS::ADC::TSample* pSamples, int nBit, int& nId, ui8* pData)
+{
+	int nFirst = 1;
+	while ( nFirst < BIOS::ADC::Length && (pSamples[nFirst] & 0xff) >= 128 )
+		nFirst++;
+
+	ui8 arrBits[128];
+	int nBits = 0, nRun = 0, nLast = -1, nNeeded = 19;
+	for ( int i = nFirst + nBit/2; i < BIOS::ADC::Length && nBits < nNeeded; i += nBit )
+	{
+		int nValue = (pSamples[i] & 0xff) >= 128;
+		if ( nRun == 5 )
+		{
+			// stuff bit, has to be the opposite level
+			if ( nValue == nLast )
+				return -1;
+			nRun = 1;
+			nLast = nValue;
+			continue;
+		}
+		nRun = nValue == nLast ? nRun + 1 : 1;
+		nLast = nValue;
+		arrBits[nBits++] = (ui8)nValue;
+		if ( nBits == 19 )
+		{
+			int nDlc = (arrBits[15] << 3) | (arrBits[16] << 2) | (arrBits[17] << 1) | arrBits[18];
+			nNeeded = 19 + min(nDlc, 8) * 8 + 15;
+		}
+	}
+	if ( nBits < nNeeded || nNeeded == 19 )
+		return -1;
+
+	int nCrc = 0;
+	for ( int i = 0; i < nNeeded - 15; i++ )
+	{
+		int nNext = arrBits[i] ^ ((nCrc >> 14) & 1);
+		nCrc = (nCrc << 1) & 0x7fff;
+		if ( nNext )
+			nCrc ^= 0x4599;
+	}
+	int nFrameCrc = 0;
+	for ( int i = nNeeded - 15; i < nNeeded; i++ )
+		nFrameCrc = (nFrameCrc << 1) | arrBits[i];
+	if ( nCrc != nFrameCrc )
+		return -1;
+
+	nId = 0;
+	for ( int i = 1; i <= 11; i++ )
+		nId = (nId << 1) | arrBits[i];
+	int nData = (nNeeded - 19 - 15) / 8;
+	for ( int j = 0; j < nData; j++ )
+	{
+		pData[j] = 0;
+		for ( int i = 0; i < 8; i++ )
+			pData[j] = (ui8)((pData[j] << 1) | arrBits[19 + j*8 + i]);
+	}
+	return nData;
+}
+
+static int _BenchScenario()
+{
+	const int nCaptures = 200;
+	int nFailed = 0;
+	const char* arrBus[] = {
+		"seed 7",
+		"ch1 sine period=100 amp=90 noise=3 jitter=4",
+		"ch2 uart bit=10 amp=100 data=48656c6c6f noise=2",
+		"ch3 i2c line=scl bit=8 addr=0x50 data=a55a",
+		"ch4 i2c line=sda bit=8 addr=0x50 data=a55a"
+	};
+	const char* arrCan[] = {
+		"ch1 can bit=4 amp=100 id=0x7f0 data=0000001f80ff"
+	};
+
+	static CScenarioSource source1, source2, sourceCan;
+	_LoadScenario( source1, arrBus, COUNT(arrBus) );
+	_LoadScenario( source2, arrBus, COUNT(arrBus) );
+	_LoadScenario( sourceCan, arrCan, COUNT(arrCan) );
+
+	static BIOS::ADC::TSample arrCapture[BIOS::ADC::Length];
+	int nDifferent = 0;
+	for ( int k = 0; k < 20; k++ )
+	{
+		source1.Restart();
+		source2.Restart();
+		for ( int i = 0; i < BIOS::ADC::Length; i++ )
+		{
+			arrCapture[i] = source1.Get();
+			if ( source2.Get() != arrCapture[i] )
+				nDifferent++;
+		}
+	}
+
+	ui8 arrData[16];
+	int nUart = _DecodeUart( arrCapture, 10, arrData, COUNT(arrData) );
+	bool bUart = nUart >= 5 && memcmp( arrData, "Hello", 5 ) == 0;
+	int nNacks;
+	int nI2c = _DecodeI2c( arrCapture, arrData, COUNT(arrData), nNacks );
+	bool bI2c = nI2c == 3 && nNacks == 0 && arrData[0] == 0xa0 && arrData[1] == 0xa5 && arrData[2] == 0x5a;
+	sourceCan.Restart();
+	for ( int i = 0; i < BIOS::ADC::Length; i++ )
+		arrCapture[i] = sourceCan.Get();
+	int nId;
+	const ui8 arrCanData[] = {0x00, 0x00, 0x00, 0x1f, 0x80, 0xff};
+	int nCan = _DecodeCan( arrCapture, 4, nId, arrData );
+	bool bCan = nCan == 6 && nId == 0x7f0 && memcmp( arrData, arrCanData, 6 ) == 0;
+
+	ui32 nSum = 0;
+	ULONGLONG nBegin = CDevice::GetMicros();
+	for ( int k = 0; k < nCaptures; k++ )
+	{
+		source1.Restart();
+		for ( int i = 0; i < BIOS::ADC::Length; i++ )
+			nSum += source1.Get();
+	}
+	double fScenario = _Seconds( nBegin );
+	ui32 nSineSum = 0;
+	CSineSource sine;
+	nBegin = CDevice::GetMicros();
+	for ( int k = 0; k < nCaptures; k++ )
+	{
+		sine.Restart();
+		for ( int i = 0; i < BIOS::ADC::Length; i++ )
+			nSineSum += sine.Get();
+	}
+	double fSine = _Seconds( nBegin );
+
+	printf( "differences  uart  i2c  can  checksum  ns/sample  sine ns/sample\n" );
+	printf( "%11d  %4s  %3s  %3s  %08x  %9.2f  %14.2f\n", nDifferent, bUart ? "ok" : "bad", bI2c ? "ok" : "bad",
+		bCan ? "ok" : "bad", (unsigned)(nSum & 0xffffffff), fScenario * 1e9 / nCaptures / BIOS::ADC::Length, fSine * 1e9 / nCaptures / BIOS::ADC::Length );
+	if ( nDifferent > 0 || !bUart || !bI2c || !bCan )
+		nFailed++;
+	return nFailed ? 1 : 0;
+}
+
+// Records scenario captures through BIOS::FAT and replays them, every replayed
+// frame has to match the recorded one in the 18 bits of the ADC word and the
+// settings snapshot has to come back. Replay is timed with the capture store
+// update, that is the cost of one frame before the measurements and decoders
+static int _BenchReplay()
+{
+	const int nFrames = 50;
+	const int nPasses = 10;
+	const char* strName = "BENCH.DSR";
+	const char* arrLines[] = {
+		"ch1 sine period=333 amp=90 noise=4",
+		"ch2 uart bit=12 amp=100 data=0123456789",
+		"ch3 square period=64",
+		"ch4 pulse period=100 duty=10"
+	};
+
+	static CSettings settings;
+	static CScenarioSource source;
+	_LoadScenario( source, arrLines, COUNT(arrLines) );
+	static BIOS::ADC::TSample arrFrames[nFrames][BIOS::ADC::Length];
+
+	Settings.Time.Resolution = CSettings::TimeBase::_100us;
+	Settings.CH1.u16Position = 40;
+	if ( !CCoreRecorder::StartRecording( strName ) )
+		return 1;
+	ULONGLONG nBegin = CDevice::GetMicros();
+	double fWrite = 0;
+	for ( int k = 0; k < nFrames; k++ )
+	{
+		for ( int i = 0; i < BIOS::ADC::Length; i++ )
+			BIOS::ADC::GetAt(i) = arrFrames[k][i] = source.Get() | ((ui32)k << 24);
+		nBegin = CDevice::GetMicros();
+		CCoreRecorder::Record();
+		fWrite += _Seconds( nBegin );
+	}
+	CCoreRecorder::StopRecording();
+	int nRecorded = CCoreRecorder::GetFrames();
+
+	Settings.Time.Resolution = CSettings::TimeBase::_1ms;
+	Settings.CH1.u16Position = 100;
+	CCoreRecorder::SetSpeed( CCoreRecorder::SpeedMax );
+	int nMismatches = 0;
+	int nChanged = 0;
+	double fRead = 0;
+	if ( !CCoreRecorder::StartReplay( strName ) )
+		return 1;
+	for ( int k = 0; k < nFrames * nPasses; k++ )
+	{
+		nBegin = CDevice::GetMicros();
+		if ( CCoreRecorder::Replay() )
+			nChanged++;
+		CCaptureStore::Update();
+		fRead += _Seconds( nBegin );
+		if ( k >= nFrames )
+			continue;
+		for ( int i = 0; i < BIOS::ADC::Length; i++ )
+			if ( ( BIOS::ADC::GetAt(i) ^ arrFrames[k][i] ) & 0x3ffff )
+				nMismatches++;
+	}
+	bool bSettings = Settings.Time.Resolution == CSettings::TimeBase::_100us && Settings.CH1.u16Position == 40;
+	CCoreRecorder::StopReplay();
+	remove( strName );
+
+	double fBytes = (double)CCoreRecorder::Sectors * CCoreRecorder::SectorSize;
+	printf( "frames %d/%d, mismatches %d, settings %s (changed %d times)\n", nRecorded, nFrames,
+		nMismatches, bSettings ? "restored" : "LOST", nChanged );
+	printf( "record: %.1f MB/s, %.1f us/frame\n", fBytes * nFrames / fWrite / 1e6, fWrite * 1e6 / nFrames );
+	printf( "replay: %.1f MB/s, %.0f frames/s\n", fBytes * nFrames * nPasses / fRead / 1e6, nFrames * nPasses / fRead );
+	return ( nRecorded != nFrames || nMismatches > 0 || !bSettings || nChanged != 1 ) ? 1 : 0;
+}
+
+// Float sinc that CWndZoomView::GetInterpolatedSincAnalytic evaluated over 21
+// neighbours of the position (8 bit fraction)
+static int _RefSincAnalytic(const ui8* pSamples, int nLength, int nIndex)
+{
+	int nMid = nIndex/256;
+	int nMin = max( 0, nMid-10 );
+	int nMax = min( nLength-1, nMid+10 );
+
+	float fSum = 0;
+	for ( int i = nMin; i <= nMax; i++ )
+	{
+		float fRelTime = i - nIndex / 256.0f;
+		float fSi = 1;
+		if ( fRelTime != 0 )
+		{
+			fRelTime *= 3.141592f;
+			fSi = sin( fRelTime ) / fRelTime;
+		}
+		fSum += fSi * pSamples[i];
+	}
+	return max( 0, min( (int)fSum, 255 ) );
+}
+
+static int _BenchSinc()
+{
+	const int nLength = BIOS::ADC::Length;
+	const int nCount = 4096;
+	const int nLoops = 200;
+	static BIOS::ADC::TSample arrSamples[BIOS::ADC::Length];
+	static ui8 arrPlane[BIOS::ADC::Length];
+	static ui8 arrFixed[nCount];
+	// keeps the float loop from being optimized out
+	volatile int nSink = 0;
+	const int arrFactor[] = {2, 4, 8, 16};
+	int nFailed = 0;
+
+	_FillSamples( arrSamples, nLength, 3 );
+	for ( int i = 0; i < nLength; i++ )
+		arrPlane[i] = (ui8)arrSamples[i];
+
+	// the window starts near the end of the record, the kernel gets clamped there
+	printf( "factor  max error  float Msamples/s  Q15 Msamples/s  speedup\n" );
+	for ( int f = 0; f < (int)COUNT(arrFactor); f++ )
+	{
+		int nStep = CInterpolator::Unity / arrFactor[f];
+		int nBegin = ( nLength - nCount / arrFactor[f] + 2 ) << CInterpolator::FractionBits;
+
+		ULONGLONG nTime = CDevice::GetMicros();
+		for ( int l = 0; l < nLoops / 10; l++ )
+			for ( int i = 0; i < nCount; i++ )
+				nSink += _RefSincAnalytic( arrPlane, nLength, nBegin + i * nStep );
+		double fFloat = nCount * (double)(nLoops / 10) / _Seconds( nTime ) / 1e6;
+
+		nTime = CDevice::GetMicros();
+		for ( int l = 0; l < nLoops; l++ )
+			CInterpolator::Process( arrPlane, 1, nLength, nBegin, nStep, arrFixed, nCount );
+		double fFixed = nCount * (double)nLoops / _Seconds( nTime ) / 1e6;
+
+		// the positions fall on the phases of the table, only the Q15 rounding remains
+		int nMaxError = 0;
+		for ( int i = 0; i < nCount; i++ )
+		{
+			int nRef = _RefSinc( arrPlane, 1, nLength, ( nBegin + i * nStep ) / (double)CInterpolator::Unity );
+			nMaxError = max( nMaxError, abs( nRef - arrFixed[i] ) );
+		}
+		if ( nMaxError > 1 )
+			nFailed++;
+
+		printf( "%6d  %9d  %16.1f  %14.1f  %6.1fx\n", arrFactor[f], nMaxError, fFloat, fFixed, fFixed / fFloat );
+	}
+	return nFailed ? 1 : 0;
+}
+
+// Block transfers have to draw the same pixels as PutPixel with the cursor set
+// for every pixel, which is what the ARM LCD did before, clipped rectangles and
+// the repeated column (stride 0) included
+static void _RefBlit(const CRect& rc, const ui16* pBuffer, int nStride, bool bColumns)
+{
+	for ( int x = 0; x < rc.Width(); x++ )
+		for ( int y = 0; y < rc.Height(); y++ )
+			BIOS::LCD::PutPixel( rc.left + x, bColumns ? rc.bottom - 1 - y : rc.top + y,
+				pBuffer[ bColumns ? x * nStride + y : y * nStride + x ] );
+}
+
+static int _BenchBlit()
+{
+	const int nPasses = 50;
+	const struct {
+		const char* strName;
+		CRect rc;
+		int nStride;
+		bool bColumns;
+	} arrCases[] = {
+		{"graph", CRect(12, 22, 312, 222), 200, true},
+		{"column", CRect(100, 22, 101, 222), 200, true},
+		{"padded", CRect(12, 22, 312, 222), 201, true},
+		{"repeat", CRect(20, 40, 220, 56), 0, true},
+		{"rect", CRect(50, 30, 250, 130), 200, false},
+		{"row", CRect(50, 100, 350, 101), 300, false},
+		{"clipped", CRect(-8, 200, 60, 260), 68, false},
+		{"clippedc", CRect(380, -10, 420, 30), 40, true}
+	};
+
+	static ui16 arrSource[CFrameBuffer::Width * (CFrameBuffer::Height+1)];
+	static ui16 arrReference[CFrameBuffer::Width * CFrameBuffer::Height];
+	srand( 7 );
+	for ( int i = 0; i < (int)COUNT(arrSource); i++ )
+	{
+		arrSource[i] = (ui16)rand();
+		if ( arrSource[i] == RGBTRANS )
+			arrSource[i] = 0;
+	}
+
+	ui16* pScreen = CDevice::m_pInstance->display.GetBuffer();
+	const int nScreen = CFrameBuffer::Width * CFrameBuffer::Height * sizeof(ui16);
+	int nFailed = 0;
+	printf( "case      pixels  mismatches  pixel Mpixels/s  blit Mpixels/s  pixel windows  blit windows\n" );
+	for ( int k = 0; k < (int)COUNT(arrCases); k++ )
+	{
+		const CRect& rc = arrCases[k].rc;
+		int nStride = arrCases[k].nStride;
+		bool bColumns = arrCases[k].bColumns;
+
+		memset( pScreen, 0, nScreen );
+		ULONGLONG nBegin = CDevice::GetMicros();
+		for ( int i = 0; i < nPasses; i++ )
+			_RefBlit( rc, arrSource, nStride, bColumns );
+		double fPixel = _Seconds( nBegin );
+		memcpy( arrReference, pScreen, nScreen );
+
+		memset( pScreen, 0, nScreen );
+		nBegin = CDevice::GetMicros();
+		for ( int i = 0; i < nPasses; i++ )
+		{
+			if ( bColumns )
+				BIOS::LCD::BlitColumns( rc, arrSource, nStride );
+			else
+				BIOS::LCD::BlitRect( rc, arrSource, nStride );
+		}
+		double fBlit = _Seconds( nBegin );
+
+		int nMismatches = 0;
+		for ( int i = 0; i < CFrameBuffer::Width * CFrameBuffer::Height; i++ )
+			if ( pScreen[i] != arrReference[i] )
+				nMismatches++;
+		int nPixels = rc.Width() * rc.Height();
+		printf( "%-8s  %6d  %10d  %15.1f  %14.1f  %13d  %12d\n", arrCases[k].strName, nPixels, nMismatches,
+			nPixels * nPasses / fPixel / 1e6, nPixels * nPasses / fBlit / 1e6, nPixels, 1 );
+		if ( nMismatches > 0 )
+			nFailed++;
+	}
+	memset( pScreen, 0, nScreen );
+	return nFailed ? 1 : 0;
+}
+
+// Print of an opaque run from the text cache has to leave the same pixels as
+// drawing it glyph by glyph. The strings of two measurement items fit into the
+// cache, the values set is larger and runs through it, every Print of it
+// rasterises a strip again
+int _DrawChar(int x, int y, unsigned short clrf, unsigned short clrb, char ch);
+
+static void _RefPrint(int x, int y, ui16 clrf, ui16 clrb, const char* str)
+{
+	for ( ; *str; str++ )
+		x += _DrawChar( x, y, clrf, clrb, *str );
+}
+
+static int _BenchText()
+{
+	const int nPasses = 200;
+	const char* arrItems[] = {"RMS", "0.676", "V", "Vpp", "1.000"};
+	const char* arrValues[] = {"0.676", "1.000", "0.085", "0.187", "12.34", "5.008", "0.956", "0.000",
+		"99.10", "3.142", "2.718", "1.414", "6.283", "7.389", "0.693", "1.732"};
+	const struct {
+		const char* strName;
+		const char** arrStrings;
+		int nStrings;
+	} arrCases[] = {
+		{"items", arrItems, COUNT(arrItems)},
+		{"values", arrValues, COUNT(arrValues)}
+	};
+
+	static ui16 arrReference[CFrameBuffer::Width * CFrameBuffer::Height];
+	ui16* pScreen = CDevice::m_pInstance->display.GetBuffer();
+	const int nScreen = CFrameBuffer::Width * CFrameBuffer::Height * sizeof(ui16);
+	int nFailed = 0;
+	printf( "case    strings  mismatches  glyph kchars/s  cached kchars/s  hits  misses\n" );
+	for ( int k = 0; k < (int)COUNT(arrCases); k++ )
+	{
+		int nChars = 0;
+		for ( int i = 0; i < arrCases[k].nStrings; i++ )
+			nChars += strlen( arrCases[k].arrStrings[i] );
+
+		memset( pScreen, 0, nScreen );
+		ULONGLONG nBegin = CDevice::GetMicros();
+		for ( int j = 0; j < nPasses; j++ )
+			for ( int i = 0; i < arrCases[k].nStrings; i++ )
+				_RefPrint( 12 + (i & 3) * 96, 20 + (i >> 2) * 16, RGB565(000000), RGB565(b0b0b0),
+					arrCases[k].arrStrings[i] );
+		double fGlyph = _Seconds( nBegin );
+		memcpy( arrReference, pScreen, nScreen );
+
+		ui32 nHits0, nMisses0, nHits, nMisses;
+		BIOS::LCD::GetTextStats( nHits0, nMisses0 );
+		memset( pScreen, 0, nScreen );
+		nBegin = CDevice::GetMicros();
+		for ( int j = 0; j < nPasses; j++ )
+			for ( int i = 0; i < arrCases[k].nStrings; i++ )
+				BIOS::LCD::Print( 12 + (i & 3) * 96, 20 + (i >> 2) * 16, RGB565(000000), RGB565(b0b0b0),
+					arrCases[k].arrStrings[i] );
+		double fCached = _Seconds( nBegin );
+		BIOS::LCD::GetTextStats( nHits, nMisses );
+
+		int nMismatches = 0;
+		for ( int i = 0; i < CFrameBuffer::Width * CFrameBuffer::Height; i++ )
+			if ( pScreen[i] != arrReference[i] )
+				nMismatches++;
+		printf( "%-6s  %7d  %10d  %14.0f  %15.0f  %4u  %6u\n", arrCases[k].strName, arrCases[k].nStrings, nMismatches,
+			nChars * nPasses / fGlyph / 1e3, nChars * nPasses / fCached / 1e3,
+			(unsigned)(nHits - nHits0), (unsigned)(nMisses - nMisses0) );
+		if ( nMismatches > 0 )
+			nFailed++;
+		// every case fits into the cache, only the first pass may miss
+		if ( (nMisses - nMisses0) > (ui32)arrCases[k].nStrings )
+		{
+			printf( "%s: the cache thrashes, %u misses for %d strings\n", arrCases[k].strName,
+				(unsigned)(nMisses - nMisses0), arrCases[k].nStrings );
+			nFailed++;
+		}
+	}
+	memset( pScreen, 0, nScreen );
+	return nFailed ? 1 : 0;
+}
+
+// Encoder of Resources/ImageConv/bmconv, the pixels are palette indices in the
+// order of the format (rows alternating direction). Like the converter it
+// marks the bitmap for the span decoder when the transfers of the spans cost
+// less than setting every pixel on the device
+class CBitmapWriter
+{
+public:
+	enum {
+		// costs in pixel writes, PutPixel sets the cursor for every pixel, a
+		// span sets the LCD window and starts a transfer
+		PixelCost = 4,
+		TransferCost = 32
+	};
+
+	int m_nOpaque;
+	int m_nTransfers;
+
+private:
+	ui8* m_pOut;
+	int m_nOut;
+	int m_nAccum;
+	int m_nWidth;
+	int m_x;
+	int m_y;
+	int m_nPending;
+
+public:
+	int Encode(ui8* pOut, const ui8* pPixels, int nWidth, int nHeight, const ui16* pPalette)
+	{
+		m_pOut = pOut;
+		m_nOut = 0;
+		m_nAccum = -1;
+		m_nWidth = nWidth;
+		m_x = m_y = m_nPending = 0;
+		m_nOpaque = m_nTransfers = 0;
+		_Byte( 'G' );
+		_Byte( 'B' );
+		_Vlc8( nWidth );
+		_Vlc8( nHeight );
+		for ( int i = 0; i < 16; i++ )
+		{
+			_Byte( pPalette[i] >> 8 );
+			_Byte( pPalette[i] & 0xff );
+		}
+
+		int nTotal = nWidth * nHeight;
+		int nIndex = 0;
+		bool bSame = true;
+		while ( nIndex < nTotal )
+		{
+			if ( bSame )
+			{
+				int nLength = _RunLength( pPixels, nIndex, nTotal );
+				_Vlc4( nLength-1 );
+				_Fix4( pPixels[nIndex] );
+				_SimRun( pPalette[pPixels[nIndex]] == CBitmap::Transparent, nLength );
+				nIndex += nLength;
+			} else
+			{
+				int j = nIndex+1;
+				while ( j < nTotal-1 && j-nIndex <= 15 && pPixels[j] != pPixels[j+1] )
+					j++;
+				_Fix4( j-nIndex-1 );
+				for ( ; nIndex < j; nIndex++ )
+				{
+					_Fix4( pPixels[nIndex] );
+					_SimPixel( pPalette[pPixels[nIndex]] == CBitmap::Transparent );
+				}
+			}
+			bSame = !bSame;
+		}
+		if ( m_nAccum != -1 )
+			_Fix4( 0 );
+		if ( IsSpans() )
+			pOut[1] = 'S';
+		return m_nOut;
+	}
+
+	bool IsSpans()
+	{
+		return GetSpanCost() < GetPixelCost();
+	}
+	int GetPixelCost()
+	{
+		return m_nOpaque * PixelCost;
+	}
+	int GetSpanCost()
+	{
+		return m_nTransfers * TransferCost + m_nOpaque;
+	}
+
+private:
+	static int _RunLength(const ui8* pPixels, int nIndex, int nTotal)
+	{
+		int j = nIndex+1;
+		while ( j < nTotal && pPixels[j] == pPixels[nIndex] )
+			j++;
+		return j-nIndex;
+	}
+	void _Byte(int n)
+	{
+		m_pOut[m_nOut++] = (ui8)n;
+	}
+	void _Vlc8(int n)
+	{
+		if ( n >= 128 )
+			_Byte( (n & 127) | 128 );
+		_Byte( n >= 128 ? n >> 7 : n );
+	}
+	void _Fix4(int n)
+	{
+		if ( m_nAccum == -1 )
+			m_nAccum = n;
+		else
+		{
+			_Byte( (m_nAccum << 4) | n );
+			m_nAccum = -1;
+		}
+	}
+	void _Vlc4(int n)
+	{
+		do
+		{
+			_Fix4( n > 7 ? (n & 7) | 8 : n );
+			n >>= 3;
+		} while ( n > 0 );
+	}
+
+	// transfers of the span decoder, follows CBitmap::Run and CBitmap::Pixel
+	void _SimFlush()
+	{
+		if ( m_nPending )
+			m_nTransfers++;
+		m_nPending = 0;
+	}
+	void _SimPixel(bool bTransparent)
+	{
+		if ( bTransparent )
+			_SimFlush();
+		else
+		{
+			m_nPending++;
+			m_nOpaque++;
+		}
+		if ( m_y & 1 ? --m_x < 0 : ++m_x >= m_nWidth )
+		{
+			m_x = m_y & 1 ? 0 : m_nWidth-1;
+			_SimFlush();
+			m_y++;
+		}
+	}
+	void _SimRun(bool bTransparent, int n)
+	{
+		while ( n > 0 )
+		{
+			if ( m_x == ( m_y & 1 ? m_nWidth-1 : 0 ) && n >= m_nWidth )
+			{
+				int nRows = n / m_nWidth;
+				_SimFlush();
+				if ( !bTransparent )
+				{
+					m_nTransfers++;
+					m_nOpaque += nRows * m_nWidth;
+				}
+				m_y += nRows;
+				m_x = m_y & 1 ? m_nWidth-1 : 0;
+				n -= nRows * m_nWidth;
+				continue;
+			}
+			int nLeft = m_y & 1 ? m_x+1 : m_nWidth-m_x;
+			int nSpan = min( n, nLeft );
+			if ( nSpan < CBitmap::SpanMin && !bTransparent )
+			{
+				for ( int i = 0; i < nSpan; i++ )
+					_SimPixel( false );
+			} else
+			{
+				_SimFlush();
+				if ( !bTransparent )
+				{
+					m_nTransfers++;
+					m_nOpaque += nSpan;
+				}
+				if ( nSpan == nLeft )
+				{
+					m_x = m_y & 1 ? 0 : m_nWidth-1;
+					m_y++;
+				} else
+					m_x += m_y & 1 ? -nSpan : nSpan;
+			}
+			n -= nSpan;
+		}
+	}
+};
+
+// CBitmap::Blit before the spans, every pixel set one by one
+static void _RefBitmap(const ui8* pPixels, int nWidth, int nHeight, const ui16* pPalette, int x, int y)
+{
+	for ( int i = 0; i < nWidth * nHeight; i++ )
+	{
+		int nRow = i / nWidth;
+		int nColumn = ( nRow & 1 ) ? nWidth - 1 - i % nWidth : i % nWidth;
+		if ( pPalette[pPixels[i]] != CBitmap::Transparent )
+			BIOS::LCD::PutPixel( x + nColumn, y + nRow, pPalette[pPixels[i]] );
+	}
+}
+
+// Both decoders and the decoded image of the cache have to give the same
+// pixels as the reference. The icon has a transparent background, the photo
+// is mostly unique pixels and the panel mostly long runs. The host times do
+// not show the cost of the LCD transfers of the device, the decoder chosen
+// by the converter follows the modelled device cost
+static int _BenchBitmap()
+{
+	const int nPasses = 200;
+	const struct {
+		const char* strName;
+		int nWidth;
+		int nHeight;
+		int nKind;
+	} arrCases[] = {
+		{"icon", 40, 40, 0},
+		{"photo", 64, 48, 1},
+		{"panel", 120, 60, 2},
+		{"noise", 48, 32, 3}
+	};
+
+	ui16 arrPalette[16];
+	for ( int i = 0; i < 16; i++ )
+		arrPalette[i] = (ui16)( i * 0x1083 + 0x0841 );
+	arrPalette[0] = CBitmap::Transparent;
+
+	// the cache knows a bitmap by the address of its data, every case
+	// has its own
+	static ui8 arrPixels[120*60];
+	static ui8 arrBuffers[4][2*120*60];
+	static ui16 arrReference[CFrameBuffer::Width * CFrameBuffer::Height];
+	ui16* pScreen = CDevice::m_pInstance->display.GetBuffer();
+	const int nScreen = CFrameBuffer::Width * CFrameBuffer::Height * sizeof(ui16);
+	int nFailed = 0;
+	srand( 11 );
+	printf( "case    pixels  bytes  mismatches  decoder  pixel cost  span cost  pixel Mpx/s  span Mpx/s  cached Mpx/s\n" );
+	for ( int k = 0; k < (int)COUNT(arrCases); k++ )
+	{
+		int nWidth = arrCases[k].nWidth;
+		int nHeight = arrCases[k].nHeight;
+		int nPixels = nWidth * nHeight;
+		for ( int i = 0; i < nPixels; i++ )
+		{
+			// the pixel order of the format
+			int y = i / nWidth;
+			int x = ( y & 1 ) ? nWidth - 1 - i % nWidth : i % nWidth;
+			int dx = x - nWidth/2, dy = y - nHeight/2;
+			switch ( arrCases[k].nKind )
+			{
+			case 0: arrPixels[i] = dx*dx + dy*dy > 18*18 ? 0 : ( dx*dx + dy*dy > 14*14 ? 1 : 2 + (x/4 + y/6) % 3 ); break;
+			case 1: arrPixels[i] = 1 + rand() % 15; break;
+			case 2: arrPixels[i] = ( y < 12 ) ? 3 : ( x > 20 && x < 100 && y > 20 && y < 50 ) ? 4 + (x+y)/30 % 2 : 5; break;
+			case 3: arrPixels[i] = rand() % 3 == 0 ? 0 : 1 + rand() % 15; break;
+			}
+		}
+		ui8* arrData = arrBuffers[k];
+		CBitmapWriter writer;
+		int nBytes = writer.Encode( arrData, arrPixels, nWidth, nHeight, arrPalette );
+		ui8 nChosen = arrData[1];
+
+		const int x = 30, y = 40;
+		memset( pScreen, 0, nScreen );
+		ULONGLONG nBegin = CDevice::GetMicros();
+		for ( int i = 0; i < nPasses; i++ )
+			_RefBitmap( arrPixels, nWidth, nHeight, arrPalette, x, y );
+		memcpy( arrReference, pScreen, nScreen );
+
+		int nMismatches = 0;
+		double arrTime[3];
+		for ( int j = 0; j < 3; j++ )
+		{
+			// pixel decoder, span decoder and the cache
+			arrData[1] = j == 1 ? 'S' : 'B';
+			CBitmap bmp;
+			bmp.Load( arrData );
+			memset( pScreen, 0, nScreen );
+			nBegin = CDevice::GetMicros();
+			for ( int i = 0; i < nPasses; i++ )
+				bmp.Blit( x, y, j == 2 );
+			arrTime[j] = _Seconds( nBegin );
+			for ( int i = 0; i < CFrameBuffer::Width * CFrameBuffer::Height; i++ )
+				if ( pScreen[i] != arrReference[i] )
+					nMismatches++;
+		}
+		arrData[1] = nChosen;
+		printf( "%-6s  %6d  %5d  %10d  %7s  %10d  %9d  %11.1f  %10.1f  %12.1f\n", arrCases[k].strName, nPixels, nBytes,
+			nMismatches, nChosen == 'S' ? "span" : "pixel", writer.GetPixelCost(), writer.GetSpanCost(),
+			nPixels * nPasses / arrTime[0] / 1e6, nPixels * nPasses / arrTime[1] / 1e6, nPixels * nPasses / arrTime[2] / 1e6 );
+		if ( nMismatches > 0 )
+			nFailed++;
+	}
+	memset( pScreen, 0, nScreen );
+	return nFailed ? 1 : 0;
+}
+
+int RunBenchmark(const char* strName)
+{
+	const static struct {
+		const char* strName;
+		int (*pBenchmark)();
+	} arrBenchmarks[] = {
+		{"resample", _BenchResample},
+		{"trigger", _BenchTrigger},
+		{"ets", _BenchEts},
+		{"peak", _BenchPeak},
+		{"hires", _BenchHiRes},
+		{"average", _BenchAverage},
+		{"scenario", _BenchScenario},
+		{"replay", _BenchReplay},
+		{"blit", _BenchBlit},
+		{"sinc", _BenchSinc},
+		{"text", _BenchText},
+		{"bitmap", _BenchBitmap}
+	};
+
+	for ( int i = 0; i < (int)COUNT(arrBenchmarks); i++ )
+		if ( strcmp( strName, arrBenchmarks[i].strName ) == 0 || strcmp( strName, "all" ) == 0 )
+		{
+			printf( "%s:\n", arrBenchmarks[i].strName );
+			int nResult = arrBenchmarks[i].pBenchmark();
+			if ( nResult != 0 || strcmp( strName, "all" ) != 0 )
+				return nResult;
+		}
+
+	if ( strcmp( strName, "all" ) == 0 )
+		return 0;
+
+	printf( "Available benchmarks: all" );
+	for ( int i = 0; i < (int)COUNT(arrBenchmarks); i++ )
+		printf( ", %s", arrBenchmarks[i].strName );
+	printf( "\n" );
+	return strcmp( strName, "list" ) == 0 ? 0 : 1;
+}
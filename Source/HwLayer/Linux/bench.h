@@ -0,0 +1,6 @@
+#pragma once
+
+// Host benchmarks of the processing routines, each one compares the optimized
+// code with a reference implementation and reports its throughput
+// usage: ds203 -b <name>, or ds203 -b list
+int RunBenchmark(const char* strName);
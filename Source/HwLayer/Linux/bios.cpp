@@ -0,0 +1,1004 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "device.h"
+#include <Source/HwLayer/Types.h>
+#include <Source/HwLayer/Bios.h>
+#define DEVICE CDevice::m_pInstance
+#include "font.h"
+#include "sprintf/spf.h"
+#include <Source/HwLayer/TextCache.h>
+
+CRect m_rcBuffer;
+CPoint m_cpBuffer;
+const CClipRegion* m_pClip = NULL;
+
+int _DrawChar(int x, int y, unsigned short clrf, unsigned short clrb, char ch);
+ui8 _Round(int x, int y);
+
+void Assert(const char *msg, int n)
+{
+	fprintf(stderr, "Assertion failed: %s:%d\n", msg, n);
+}
+
+/*static*/ void BIOS::SYS::Init()
+{
+}
+
+/*static*/ int BIOS::LCD::Printf (int x, int y, unsigned short clrf, unsigned short clrb, const char * format, ...)
+{
+	char buffer[256];
+	char* bbuf = buffer;
+	va_list args;
+	va_start( args, format );
+	int nAux = print( &bbuf, format, args );
+	Print( x, y, clrf, clrb, buffer );
+
+	return nAux;
+}
+
+/*static*/ int BIOS::LCD::Print (int x, int y, unsigned short clrf, unsigned short clrb, char *str)
+{
+	return Print(x, y, clrf, clrb, (const char*)str);
+}
+
+/*static*/ int BIOS::LCD::Print (int x, int y, unsigned short clrf, unsigned short clrb, const char *str)
+{
+	if (!str || !*str)
+		return 0;
+	int nLength = 0;
+	const ui16* pStrip = ( x >= 0 && y >= 0 && y + CTextCache::CharHeight <= LcdHeight ) ?
+		CTextCache::Get( str, clrf, clrb, nLength ) : NULL;
+	if ( pStrip && x + nLength*CTextCache::CharWidth <= LcdWidth )
+	{
+		BlitColumns( CRect( x, y, x + nLength*CTextCache::CharWidth, y + CTextCache::CharHeight ),
+			pStrip, CTextCache::CharHeight );
+		return nLength*CTextCache::CharWidth;
+	}
+	int nAux = 0;
+	int _x = x;
+	for (;*str; str++)
+	{
+		if (*str == '\n')
+		{
+			x = _x;
+			y += 16;
+			continue;
+		}
+		int nW = _DrawChar(x, y, clrf, clrb, *str);
+		x += nW;
+		nAux += nW;
+	}
+	return nAux;
+}
+
+/*static*/ int BIOS::LCD::Print (const CPoint& cp, unsigned short clrf, char *str)
+{
+	return Print(cp.x, cp.y, clrf, RGBTRANS, str);
+}
+
+/*static*/ void BIOS::LCD::GetTextStats(ui32& nHits, ui32& nMisses)
+{
+	CTextCache::GetStats( nHits, nMisses );
+}
+
+/*static*/ void BIOS::LCD::PutPixel(int x, int y, unsigned short clr)
+{
+	if ( clr == RGBTRANS )
+		return;
+	if ( x < 0 || y < 0 || x >= CFrameBuffer::Width || y >= CFrameBuffer::Height )
+		return;
+	if ( m_pClip && m_pClip->IsHidden( x, y ) )
+		return;
+	DEVICE->display.GetBuffer()[y*CFrameBuffer::Width+x] = clr;
+	DEVICE->display.m_nPixels++;
+}
+
+/*static*/ ui16 BIOS::LCD::GetPixel(int x, int y)
+{
+	if ( x < 0 || y < 0 || x >= CFrameBuffer::Width || y >= CFrameBuffer::Height )
+		return 0;
+	return DEVICE->display.GetBuffer()[y*CFrameBuffer::Width+x];
+}
+
+/*static*/ void BIOS::LCD::PutPixel(const CPoint& cp, unsigned short clr)
+{
+	PutPixel( cp.x, cp.y, clr );
+}
+
+/*static*/ void BIOS::LCD::Clear(unsigned short clr)
+{
+	if ( m_pClip && m_pClip->IsActive() )
+	{
+		Bar( 0, 0, CFrameBuffer::Width, CFrameBuffer::Height, clr );
+		return;
+	}
+	ui16 *pBuf = DEVICE->display.GetBuffer();
+	for (int i=0; i<CFrameBuffer::Width*CFrameBuffer::Height; i++)
+		*pBuf++ = clr;
+	DEVICE->display.m_nPixels += CFrameBuffer::Width*CFrameBuffer::Height;
+}
+
+/*static*/ void BIOS::LCD::RoundRect(int x1, int y1, int x2, int y2, unsigned short clr)
+{
+	for (int x=x1; x<x2; x++)
+		for (int y=y1; y<y2; y++)
+			if ( !_Round(min(x-x1, x2-x-1), min(y-y1, y2-y-1)) )
+				PutPixel(x, y, clr);
+}
+
+/*static*/ void BIOS::LCD::RoundRect(const CRect& rc, unsigned short clr)
+{
+	RoundRect(rc.left, rc.top, rc.right, rc.bottom, clr);
+}
+
+/*static*/ void BIOS::LCD::Bar(int x1, int y1, int x2, int y2, unsigned short clr)
+{
+	for (int x=x1; x<x2; x++)
+		for (int y=y1; y<y2; y++)
+			PutPixel(x, y, clr);
+}
+
+/*static*/ void BIOS::LCD::Bar(const CRect& rc, unsigned short clr)
+{
+	Bar(rc.left, rc.top, rc.right, rc.bottom, clr);
+}
+
+/*static*/ void BIOS::LCD::Rectangle(const CRect& rc, unsigned short clr)
+{
+	BIOS::LCD::Bar(rc.left, rc.top, rc.right, rc.top+1, clr);
+	BIOS::LCD::Bar(rc.left, rc.bottom-1, rc.right, rc.bottom, clr);
+	BIOS::LCD::Bar(rc.left, rc.top, rc.left+1, rc.bottom, clr);
+	BIOS::LCD::Bar(rc.right-1, rc.top, rc.right, rc.bottom, clr);
+}
+
+/*static*/ void BIOS::LCD::Pattern(int x1, int y1, int x2, int y2, const ui16 *pat, int l)
+{
+	const ui16* patb = pat;
+	const ui16* pate = patb + l;
+
+	for (int x=x1; x<x2; x++)
+		for (int y=y2-1; y>=y1; y--)
+		{
+			PutPixel(x, y, *pat);
+			if (++pat == pate)
+				pat = patb;
+		}
+}
+
+/*static*/ void BIOS::LCD::GetImage(const CRect& rcRect, ui16* pBuffer )
+{
+	int x1=rcRect.left, x2=rcRect.right, y1=rcRect.top, y2=rcRect.bottom;
+	for (int x=x1; x<x2; x++)
+		for (int y=y2-1; y>=y1; y--)
+			*pBuffer++ = GetPixel(x, y);
+}
+
+/*static*/ void BIOS::LCD::PutImage(const CRect& rcRect, ui16* pBuffer )
+{
+	BlitColumns(rcRect, pBuffer, rcRect.Height());
+}
+
+/*static*/ void BIOS::LCD::SetClip(const CClipRegion* pClip)
+{
+	m_pClip = pClip;
+}
+
+void _BlitRect(const CRect& rc, const ui16* pBuffer, int nStride)
+{
+	int x1 = max(rc.left, 0), x2 = min(rc.right, (int)CFrameBuffer::Width);
+	int y1 = max(rc.top, 0), y2 = min(rc.bottom, (int)CFrameBuffer::Height);
+	if ( x1 >= x2 || y1 >= y2 )
+		return;
+	ui16* pBuf = DEVICE->display.GetBuffer();
+	for (int y=y1; y<y2; y++)
+		memcpy(pBuf + y*CFrameBuffer::Width + x1, pBuffer + (y-rc.top)*nStride + (x1-rc.left), (x2-x1)*sizeof(ui16));
+	DEVICE->display.m_nPixels += (x2-x1)*(y2-y1);
+}
+
+void _BlitColumns(const CRect& rc, const ui16* pBuffer, int nStride)
+{
+	int x1 = max(rc.left, 0), x2 = min(rc.right, (int)CFrameBuffer::Width);
+	int y1 = max(rc.top, 0), y2 = min(rc.bottom, (int)CFrameBuffer::Height);
+	if ( x1 >= x2 || y1 >= y2 )
+		return;
+	ui16* pBuf = DEVICE->display.GetBuffer();
+	for (int x=x1; x<x2; x++)
+	{
+		// the column starts at the bottom
+		const ui16* pColumn = pBuffer + (x-rc.left)*nStride + (rc.bottom-y2);
+		ui16* pTarget = pBuf + (y2-1)*CFrameBuffer::Width + x;
+		for (int y=y2; y>y1; y--, pTarget -= CFrameBuffer::Width)
+			*pTarget = *pColumn++;
+	}
+	DEVICE->display.m_nPixels += (x2-x1)*(y2-y1);
+}
+
+/*static*/ void BIOS::LCD::BlitRect(const CRect& rc, const ui16* pBuffer, int nStride)
+{
+	if ( !m_pClip || !m_pClip->IsActive() )
+	{
+		_BlitRect(rc, pBuffer, nStride);
+		return;
+	}
+	CRect arrPieces[CClipRegion::MaxPieces];
+	int nPieces = m_pClip->GetVisible(rc, arrPieces, COUNT(arrPieces));
+	for (int i=0; i<nPieces; i++)
+	{
+		const CRect& rcPiece = arrPieces[i];
+		_BlitRect(rcPiece, pBuffer + (rcPiece.top-rc.top)*nStride + (rcPiece.left-rc.left), nStride);
+	}
+}
+
+/*static*/ void BIOS::LCD::BlitColumns(const CRect& rc, const ui16* pBuffer, int nStride)
+{
+	if ( !m_pClip || !m_pClip->IsActive() )
+	{
+		_BlitColumns(rc, pBuffer, nStride);
+		return;
+	}
+	CRect arrPieces[CClipRegion::MaxPieces];
+	int nPieces = m_pClip->GetVisible(rc, arrPieces, COUNT(arrPieces));
+	for (int i=0; i<nPieces; i++)
+	{
+		const CRect& rcPiece = arrPieces[i];
+		_BlitColumns(rcPiece, pBuffer + (rcPiece.left-rc.left)*nStride + (rc.bottom-rcPiece.bottom), nStride);
+	}
+}
+
+/*static*/ int BIOS::LCD::Draw(int x, int y, unsigned short clrf, unsigned short clrb, const char *p)
+{
+	int h = *p++;
+	for (int _x=0; _x<80; _x++)
+		for (int _y=0; _y<h; _y++)
+		{
+			if (!p[_x*h+_y])
+				return _x;
+			PutPixel(x+_x, y+_y, (p[_x*h+_y]&4) ? clrf : clrb);
+		}
+	return 8;
+}
+
+/*static*/ void BIOS::LCD::BufferBegin(const CRect& rc, ui8 nMode)
+{
+	m_rcBuffer = rc;
+	m_cpBuffer = rc.TopLeft();
+}
+
+/*static*/ void BIOS::LCD::BufferPush(ui16 clr)
+{
+	PutPixel( m_cpBuffer, clr );
+	if ( ++m_cpBuffer.x >= m_rcBuffer.right )
+	{
+		m_cpBuffer.x = m_rcBuffer.left;
+		m_cpBuffer.y++;
+	}
+}
+
+/*static*/ void BIOS::LCD::BufferEnd()
+{
+}
+
+/*static*/ void BIOS::LCD::Shadow(int x1, int y1, int x2, int y2, unsigned int nColor)
+{
+	// rrggbbaa
+	int nA_ = nColor >> 24;
+	int nR_ = (nColor >> 16) & 0xff;
+	int nG_ = (nColor >> 8) & 0xff;
+	int nB_ = nColor & 0xff;
+
+	for (int x=x1; x<x2; x++)
+		for (int y=y1; y<y2; y++)
+			if ( !_Round(min(x-x1, x2-x-1), min(y-y1, y2-y-1)) )
+			{
+				ui16 nOld = GetPixel(x, y);
+				int nR = Get565R( nOld );
+				int nG = Get565G( nOld );
+				int nB = Get565B( nOld );
+
+				nR += ( (nR_ - nR) * nA_ ) >> 8;
+				nG += ( (nG_ - nG) * nA_ ) >> 8;
+				nB += ( (nB_ - nB) * nA_ ) >> 8;
+
+				PutPixel(x, y, RGB565RGB(nR, nG, nB));
+			}
+}
+
+/*static*/ void BIOS::LCD::Buffer(int x, int y, unsigned short* pBuffer, int n)
+{
+	BlitColumns(CRect(x, y, x+1, y+n), pBuffer, n);
+}
+
+/*static*/ void BIOS::LCD::Line(int x1, int y1, int x2, int y2, unsigned short clr)
+{
+	si16 delta_x(x2 - x1);
+	si8 ix((delta_x > 0) - (delta_x < 0));
+	delta_x = abs(delta_x) << 1;
+
+	si16 delta_y(y2 - y1);
+	si8 iy((delta_y > 0) - (delta_y < 0));
+	delta_y = abs(delta_y) << 1;
+
+	PutPixel( x1, y1, clr );
+
+	if (delta_x >= delta_y)
+	{
+		si16 error(delta_y - (delta_x >> 1));
+		while (x1 != x2)
+		{
+			if (error >= 0 && (error || (ix > 0)))
+			{
+				y1 += iy;
+				error -= delta_x;
+			}
+			x1 += ix;
+			error += delta_y;
+			PutPixel( x1, y1, clr );
+		}
+	}
+	else
+	{
+		si16 error(delta_x - (delta_y >> 1));
+		while (y1 != y2)
+		{
+			if (error >= 0 && (error || (iy > 0)))
+			{
+				x1 += ix;
+				error -= delta_y;
+			}
+			y1 += iy;
+			error += delta_x;
+			PutPixel( x1, y1, clr );
+		}
+	}
+}
+
+/*static*/ const void* BIOS::LCD::GetCharRom()
+{
+	return (void*)font;
+}
+
+/*static*/ ui8 _Round(int x, int y)
+{
+	const static ui8 r[] =
+	{
+		1, 1, 1, 0, 0, 0, 0, 0,
+		1, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	};
+	if (x<8 && y<8)
+		return r[y*8+x];
+	return 0;
+}
+
+/*static*/ int _DrawChar(int x, int y, unsigned short clrf, unsigned short clrb, char ch)
+{
+	const unsigned char *pFont = GetFont(ch);
+	for (ui8 _y=0; _y<14; _y++)
+	{
+		ui8 col = ~*pFont++;
+		for (ui8 _x=0; _x<8; _x++, col <<= 1)
+			BIOS::LCD::PutPixel(x+_x, y+_y, (col & 128) ? clrf : clrb);
+	}
+	return 8;
+}
+
+// KEY
+/*static*/ ui16 BIOS::KEY::GetKeys()
+{
+	return DEVICE->script.GetKeys( BIOS::SYS::GetTick() );
+}
+
+// SYS
+/*static*/ ui32 BIOS::SYS::GetTick()
+{
+	return DEVICE->GetTick();
+}
+
+/*static*/ ui32 BIOS::SYS::GetMicros()
+{
+	return (ui32)CDevice::GetMicros();
+}
+
+/*static*/ void BIOS::SYS::DelayMs(unsigned short l)
+{
+	usleep(l*1000);
+}
+
+void BIOS::SYS::Beep(int)
+{
+}
+
+/*static*/ int BIOS::SYS::GetBattery()
+{
+	return 85;
+}
+
+/*static*/ void BIOS::SYS::SetBacklight(int nLevel) // 0..100
+{
+}
+
+/*static*/ void BIOS::SYS::SetVolume(int nLevel) // 0..100
+{
+}
+
+int BIOS::SYS::Get(int, int)
+{
+	return 0;
+}
+
+void BIOS::SYS::Set(int, int)
+{
+}
+
+int BIOS::SYS::GetTemperature()
+{
+	return 2068;
+}
+
+int BIOS::SYS::GetCoreVoltage()
+{
+	return 1024;
+}
+
+void BIOS::SYS::Standby(bool)
+{
+}
+
+void* BIOS::SYS::IdentifyApplication( int nCode )
+{
+	if ( nCode == BIOS::SYS::EApp1 )
+		return (void*)"DSO_APP: Gabonator's alternative UI;Alter UI;Gabriel Valky 2013;";
+	return NULL;
+}
+
+/*static*/ int BIOS::SYS::Execute( int nCode )
+{
+	return 0;
+}
+
+bool BIOS::SYS::IsColdBoot()
+{
+	return true;
+}
+
+/*static*/ char* BIOS::SYS::GetSharedBuffer()
+{
+	static char buf[4096];
+	return buf;
+}
+
+/*static*/ int BIOS::SYS::GetSharedLength()
+{
+	return 4096;
+}
+
+void NullFunction()
+{
+}
+
+/*static*/ ui32 BIOS::SYS::GetProcAddress( const char* strFuncName )
+{
+	#define EXPORT(f, decl) if ( strcmp( strFuncName, #f ) == 0 ) return (NATIVEPTR)(decl)&f;
+	#define EXPORT_ALIAS(al, f, decl) if ( strcmp( strFuncName, #al ) == 0 ) return (NATIVEPTR)(decl)&f;
+	EXPORT(BIOS::LCD::PutPixel, void (*)(int, int, ui16));
+	EXPORT(BIOS::LCD::Print, int (*)(int, int, ui16, ui16, const char*));
+	EXPORT(BIOS::KEY::GetKeys, ui16 (*)());
+	EXPORT(BIOS::SYS::Execute, int (*)(int));
+	EXPORT(BIOS::LCD::Printf, int (*)(int x, int y, unsigned short clrf, unsigned short clrb, const char * format, ...));
+
+	EXPORT_ALIAS(PutPixel, BIOS::LCD::PutPixel, void (*)(int, int, ui16));
+	EXPORT_ALIAS(Print, BIOS::LCD::Print, int (*)(int, int, ui16, ui16, const char*));
+	EXPORT_ALIAS(GetKeys, BIOS::KEY::GetKeys, ui16 (*)());
+	EXPORT_ALIAS(Execute, BIOS::SYS::Execute, int (*)(int));
+	EXPORT_ALIAS(Printf, BIOS::LCD::Printf, int (*)(int x, int y, unsigned short clrf, unsigned short clrb, const char * format, ...));
+
+	EXPORT_ALIAS(gBiosInit, NullFunction, void (*)());
+	EXPORT_ALIAS(gBiosExit, NullFunction, void (*)());
+
+	#undef EXPORT
+	#undef EXPORT_ALIAS
+	return 0;
+}
+
+// DBG
+/*static*/ void BIOS::DBG::Print(const char * format, ...)
+{
+	_ASSERT( format );
+	static int px = 0;
+	static int py = 0;
+
+	char buf[128];
+	char* bbuf = buf;
+	va_list args;
+	va_start( args, format );
+	print( &bbuf, format, args );
+
+	fputs( buf, stderr );
+	for ( bbuf = buf; *bbuf; bbuf++ )
+	{
+		if ( *bbuf == '\n' || px >= 400-8 )
+		{
+			px = 0;
+			py+=14;
+			if (py > 240-16)
+				py = 0;
+			continue;
+		}
+		px += _DrawChar(px, py, RGB565(ffffff), RGB565(0000B0), *bbuf);
+	}
+}
+
+/*static*/ int BIOS::DBG::sprintf(char* buf, const char * format, ...)
+{
+	char* bbuf = buf;
+	va_list args;
+	va_start( args, format );
+	return print( &bbuf, format, args );
+}
+
+// ADC
+#define ADCSIZE 4096
+BIOS::ADC::TSample g_ADCMem[ADCSIZE];
+bool g_bAdcEnabled = false;
+bool g_bAdcReady = false;
+float g_fTimePerDiv = 1e-3f;
+
+/*static*/ void BIOS::ADC::Init()
+{
+}
+
+/*static*/ void BIOS::ADC::Enable(bool bEnable)
+{
+	g_bAdcEnabled = bEnable;
+}
+
+/*static*/ bool BIOS::ADC::Enabled()
+{
+	return g_bAdcEnabled;
+}
+
+/*static*/ void BIOS::ADC::Configure(ui8 nACouple, ui8 nARange, ui16 nAOffset, ui8 nBCouple, ui8 nBRange, ui16 nBPosition, float fTimePerDiv)
+{
+	g_fTimePerDiv = fTimePerDiv;
+	DEVICE->GetSource()->Configure( fTimePerDiv );
+}
+
+/*static*/ void BIOS::ADC::ConfigureTrigger(ui16 nTThreshold, ui16 nVThreshold, ui8 nSource, ui8 nType)
+{
+}
+
+/*static*/ int BIOS::ADC::GetPointer()
+{
+	if ( DEVICE->bMaxSpeed )
+		return ADCSIZE;
+	ULONGLONG nTime = CDevice::GetMicros() - DEVICE->nRestarted;
+	float fDivs = nTime / 1000000.0f / g_fTimePerDiv;
+	int nSamples = (int)(fDivs * 30.0f);
+	if ( nSamples > ADCSIZE )
+		return ADCSIZE;
+	return nSamples;
+}
+
+// the FIFO is full when the whole record was sampled with the current timebase,
+// in max speed mode it is full immediately after restart
+/*static*/ unsigned char BIOS::ADC::Ready()
+{
+	if ( !g_bAdcEnabled )
+		return false;
+	if ( !g_bAdcReady )
+		g_bAdcReady = GetPointer() >= ADCSIZE;
+	return g_bAdcReady;
+}
+
+/*static*/ BIOS::ADC::EState BIOS::ADC::GetState()
+{
+	int nAux = 0;
+	if ( Ready() )
+		nAux |= BIOS::ADC::Full;
+	return (BIOS::ADC::EState)(nAux);
+}
+
+/*static*/ unsigned long BIOS::ADC::Get()
+{
+	return DEVICE->GetSource()->Get();
+}
+
+void _CountAcquisition()
+{
+	ULONGLONG nLatency = CDevice::GetMicros() - DEVICE->nRestarted;
+	DEVICE->nAcquisitions++;
+	DEVICE->nAcqLatency += nLatency;
+	DEVICE->nAcqLatencyMax = max(DEVICE->nAcqLatencyMax, nLatency);
+}
+
+/*static*/ void BIOS::ADC::Copy(int nCount)
+{
+	_ASSERT( nCount <= ADCSIZE );
+	for ( int i = 0; i < ADCSIZE; i++ )
+	{
+		ui32 nOld = g_ADCMem[i] & 0xff000000;
+		g_ADCMem[i] = ( Get() & 0x00ffffff ) | nOld;
+	}
+	_CountAcquisition();
+}
+
+/*static*/ void BIOS::ADC::Read(TSample* pTarget, int nCount)
+{
+	for ( int i = 0; i < nCount; i++ )
+		pTarget[i] = Get();
+}
+
+/*static*/ void BIOS::ADC::CopySegment(int nFirst, int nCount, int nTarget)
+{
+	_ASSERT( nFirst >= 0 && nFirst + nCount <= ADCSIZE && nTarget + nCount <= ADCSIZE );
+	for ( int i = 0; i < ADCSIZE; i++ )
+	{
+		ui32 nSample = Get();
+		if ( i < nFirst || i >= nFirst + nCount )
+			continue;
+		BIOS::ADC::TSample& nTargetSample = g_ADCMem[nTarget + i - nFirst];
+		nTargetSample = ( nSample & 0x00ffffff ) | ( nTargetSample & 0xff000000 );
+	}
+	_CountAcquisition();
+}
+
+/*static*/ unsigned long BIOS::ADC::GetCount()
+{
+	return ADCSIZE;
+}
+
+/*static*/ BIOS::ADC::TSample& BIOS::ADC::GetAt(int i)
+{
+	_ASSERT( i >= 0 && i < ADCSIZE );
+	return g_ADCMem[i];
+}
+
+/*static*/ void BIOS::ADC::Restart()
+{
+	g_bAdcReady = false;
+	DEVICE->nRestarted = CDevice::GetMicros();
+	DEVICE->GetSource()->Restart();
+}
+
+// GEN
+/*static*/ void BIOS::GEN::ConfigureDc(ui16 nData)
+{
+}
+
+/*static*/ void BIOS::GEN::ConfigureSq(ui16 psc, ui16 arr, ui16 ccr)
+{
+}
+
+/*static*/ void BIOS::GEN::ConfigureWave(ui16* pData, ui16 cnt)
+{
+}
+
+/*static*/ void BIOS::GEN::ConfigureWaveRate(ui16 arr)
+{
+}
+
+// DSK, files are placed into the host folder CDevice::strRoot
+void _HostPath(char* strPath, const char* strName)
+{
+	strcpy(strPath, DEVICE->strRoot);
+	if ( strName[0] != 0 )
+		strcat(strPath, "/");
+	strcat(strPath, strName);
+	for ( char* p = strPath; *p; p++ )
+		if ( *p == '\\' )
+			*p = '/';
+}
+
+/*static*/ PVOID BIOS::DSK::GetSharedBuffer()
+{
+	static ui8 pSectorBuffer[FILEINFO::SectorSize];
+	return (PVOID)pSectorBuffer;
+}
+
+/*static*/ BOOL BIOS::DSK::Open(FILEINFO* pFileInfo, const char* strName, ui8 nIoMode)
+{
+	// "FILENAMEEXT" -> "FILENAME.EXT"
+	char name[32];
+	memcpy(name, strName, 8);
+	name[8] = 0;
+	while ( strlen(name) > 0 && name[strlen(name)-1] == ' ' )
+		name[strlen(name)-1] = 0;
+	strcat(name, ".");
+	strncat(name, strName+8, 3);
+
+	char strPath[512];
+	_HostPath(strPath, name);
+
+	pFileInfo->f = NULL;
+	if ( nIoMode == BIOS::DSK::IoRead )
+		pFileInfo->f = fopen(strPath, "rb");
+	if ( nIoMode == BIOS::DSK::IoWrite )
+		pFileInfo->f = fopen(strPath, "wb");
+	pFileInfo->nMode = nIoMode;
+	pFileInfo->nSectors = 0;
+	return pFileInfo->f != NULL;
+}
+
+/*static*/ BOOL BIOS::DSK::Read(FILEINFO* pFileInfo, ui8* pSectorData)
+{
+	memset( pSectorData, 0, FILEINFO::SectorSize );
+	fread( pSectorData, FILEINFO::SectorSize, 1, pFileInfo->f );
+	return TRUE;
+}
+
+/*static*/ BOOL BIOS::DSK::Write(FILEINFO* pFileInfo, ui8* pSectorData)
+{
+	fwrite( pSectorData, FILEINFO::SectorSize, 1, pFileInfo->f );
+	pFileInfo->nSectors++;
+	return TRUE;
+}
+
+/*static*/ BOOL BIOS::DSK::Close(FILEINFO* pFileInfo, int nSize /*=-1*/)
+{
+	if ( !pFileInfo->f )
+		return FALSE;
+	if ( pFileInfo->nMode == BIOS::DSK::IoWrite && nSize != -1 )
+	{
+		fflush( pFileInfo->f );
+		ftruncate( fileno(pFileInfo->f), nSize );
+	}
+	fclose( pFileInfo->f );
+	pFileInfo->f = NULL;
+	return TRUE;
+}
+
+// SERIAL, bridged to a pseudo terminal when the simulator was started with --pty,
+// otherwise the output goes to stdout
+/*static*/ void BIOS::SERIAL::Init()
+{
+}
+
+/*static*/ void BIOS::SERIAL::Configure(int nBaudrate)
+{
+}
+
+/*static*/ void BIOS::SERIAL::Send(const char* strBuf)
+{
+	while ( *strBuf )
+		Putch( *strBuf++ );
+}
+
+/*static*/ int BIOS::SERIAL::Getch()
+{
+	if ( DEVICE->nPty < 0 )
+		return -1;
+	ui8 ch;
+	if ( read( DEVICE->nPty, &ch, 1 ) != 1 )
+		return -1;
+	return ch;
+}
+
+/*static*/ void BIOS::SERIAL::Putch(char ch)
+{
+	if ( DEVICE->nPty >= 0 )
+	{
+		if ( write( DEVICE->nPty, &ch, 1 ) != 1 )
+		{
+			// nobody is listening on the other side
+		}
+	}
+	else
+		fputc( ch, stdout );
+}
+
+// VER
+const char* BIOS::VER::GetHardwareVersion()
+{
+	return sizeof(void*) == 8 ? "x64" : "x86";
+}
+
+const char* BIOS::VER::GetSystemVersion()
+{
+	return "LINUX";
+}
+
+const char* BIOS::VER::GetFpgaVersion()
+{
+	return "0.00";
+}
+
+const char* BIOS::VER::GetDfuVersion()
+{
+	return "0.00";
+}
+
+ui32 BIOS::VER::GetSerialNumber()
+{
+	return 0x0006ab0;
+}
+
+ui32 BIOS::VER::GetDisplayType()
+{
+	return ToDword('v', 'g', 'a', 0);
+}
+
+void BIOS::VER::DrawLogo(int x, int y)
+{
+}
+
+// MOUSE
+bool BIOS::MOUSE::IsSupported()
+{
+	return false;
+}
+
+int BIOS::MOUSE::GetX()
+{
+	return DEVICE->mousex;
+}
+
+int BIOS::MOUSE::GetY()
+{
+	return DEVICE->mousey;
+}
+
+bool BIOS::MOUSE::GetDown()
+{
+	int nm = DEVICE->moused;
+	DEVICE->moused = 0;
+	return nm ? true : false;
+}
+
+// GPIO
+/*static*/ ui32* BIOS::GPIO::GetRegister(int nPort, int nReg)
+{
+	static ui32 dummy;
+	return &dummy;
+}
+
+/*static*/ void BIOS::GPIO::SetState(int nPort, int nPin, int nState)
+{
+}
+
+/*static*/ void BIOS::GPIO::SetPin(int nPort, int nPin, bool bOn)
+{
+}
+
+/*static*/ bool BIOS::GPIO::GetPin(int nPort, int nPin)
+{
+	return false;
+}
+
+#ifdef _VERSION2
+
+/*static*/ bool BIOS::MEMORY::PageWrite(int nPage, const ui8* pBuffer)
+{
+	return true;
+}
+
+/*static*/ bool BIOS::MEMORY::PageRead(int nPage, ui8* pBuffer)
+{
+	return true;
+}
+
+/*static*/ bool BIOS::MEMORY::PageErase(int nPage)
+{
+	return true;
+}
+
+/*static*/ void BIOS::MEMORY::LinearStart()
+{
+}
+
+/*static*/ bool BIOS::MEMORY::LinearFinish()
+{
+	return true;
+}
+
+/*static*/ bool BIOS::MEMORY::LinearProgram( ui32 nAddress, unsigned char* pData, int nLength )
+{
+	return true;
+}
+
+// FAT
+DIR* g_pFindDir = NULL;
+char g_strFindPath[512];
+FILEINFO g_fatFile;
+
+/*static*/ BIOS::FAT::EResult BIOS::FAT::Init()
+{
+	return BIOS::FAT::EOk;
+}
+
+/*static*/ BIOS::FAT::EResult BIOS::FAT::OpenDir(char* strPath)
+{
+	if ( g_pFindDir )
+		closedir( g_pFindDir );
+	_HostPath( g_strFindPath, strPath );
+	g_pFindDir = opendir( g_strFindPath );
+	return g_pFindDir ? BIOS::FAT::EOk : BIOS::FAT::ENoPath;
+}
+
+/*static*/ BIOS::FAT::EResult BIOS::FAT::FindNext(TFindFile* pFile)
+{
+	if ( !g_pFindDir )
+		return BIOS::FAT::ENoFile;
+
+	struct dirent* pEntry = readdir( g_pFindDir );
+	if ( !pEntry )
+	{
+		closedir( g_pFindDir );
+		g_pFindDir = NULL;
+		return BIOS::FAT::ENoFile;
+	}
+
+	char strFull[1024];
+	snprintf( strFull, sizeof(strFull), "%s/%s", g_strFindPath, pEntry->d_name );
+	struct stat st;
+	memset( &st, 0, sizeof(st) );
+	stat( strFull, &st );
+
+	pFile->nAtrib = S_ISDIR(st.st_mode) ? BIOS::FAT::EDirectory : BIOS::FAT::EArchive;
+	pFile->nFileLength = (ui32)st.st_size;
+	// 8.3 names, longer host names are cut
+	size_t nName = strnlen( pEntry->d_name, sizeof(pFile->strName)-1 );
+	memcpy( pFile->strName, pEntry->d_name, nName );
+	pFile->strName[nName] = 0;
+
+	struct tm* pTime = localtime( &st.st_mtime );
+	pFile->nDate = ((pTime->tm_year + 1900 - 1980) << 9) | ((pTime->tm_mon + 1) << 5) | pTime->tm_mday;
+	pFile->nTime = (pTime->tm_hour << 11) | (pTime->tm_min << 5) | (pTime->tm_sec >> 1);
+	return BIOS::FAT::EOk;
+}
+
+/*static*/ BIOS::FAT::EResult BIOS::FAT::Open(const char* strName, ui8 nIoMode)
+{
+	char strPath[512];
+	_HostPath( strPath, strName );
+
+	g_fatFile.f = NULL;
+	if ( nIoMode == BIOS::DSK::IoRead )
+		g_fatFile.f = fopen(strPath, "rb");
+	if ( nIoMode == BIOS::DSK::IoWrite )
+		g_fatFile.f = fopen(strPath, "wb");
+	if ( nIoMode == BIOS::DSK::IoAppend )
+		g_fatFile.f = fopen(strPath, "ab");
+	g_fatFile.nMode = nIoMode;
+	g_fatFile.nSectors = 0;
+	return g_fatFile.f ? BIOS::FAT::EOk : BIOS::FAT::ENoFile;
+}
+
+/*static*/ BIOS::FAT::EResult BIOS::FAT::Seek(ui32 lOffset)
+{
+	fseek( g_fatFile.f, lOffset, SEEK_SET );
+	return BIOS::FAT::EOk;
+}
+
+/*static*/ BIOS::FAT::EResult BIOS::FAT::Read(ui8* pSectorData)
+{
+	return BIOS::DSK::Read(&g_fatFile, pSectorData) ? BIOS::FAT::EOk : BIOS::FAT::EIntError;
+}
+
+/*static*/ BIOS::FAT::EResult BIOS::FAT::Write(ui8* pSectorData)
+{
+	return BIOS::DSK::Write(&g_fatFile, pSectorData) ? BIOS::FAT::EOk : BIOS::FAT::EIntError;
+}
+
+/*static*/ BIOS::FAT::EResult BIOS::FAT::Close(int nSize /*= -1*/)
+{
+	return BIOS::DSK::Close(&g_fatFile, nSize) ? BIOS::FAT::EOk : BIOS::FAT::EIntError;
+}
+
+/*static*/ ui32 BIOS::FAT::GetFileSize()
+{
+	long lPos = ftell( g_fatFile.f );
+	fseek( g_fatFile.f, 0, SEEK_END );
+	long lSize = ftell( g_fatFile.f );
+	fseek( g_fatFile.f, lPos, SEEK_SET );
+	return (ui32)lSize;
+}
+#endif
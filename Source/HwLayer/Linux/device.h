@@ -0,0 +1,238 @@
+#pragma once
+#include <time.h>
+#include <math.h>
+#include <Source/Main/Application.h>
+
+// Source of the raw FIFO words returned by BIOS::ADC::Get, the simulator reads
+// one word per sample in the same packed format as the FPGA does:
+// bits 0..7 CH1, 8..15 CH2, 16 CH3, 17 CH4
+class CSampleSource {
+public:
+	virtual ~CSampleSource()
+	{
+	}
+	virtual void Restart()
+	{
+	}
+	virtual void Configure(float fTimePerDiv)
+	{
+	}
+	virtual ui32 Get() = 0;
+};
+
+// Default source, same waveform as the win32 simulator
+class CSineSource : public CSampleSource {
+	int m_nCounter;
+
+public:
+	CSineSource()
+	{
+		m_nCounter = 0;
+	}
+	virtual void Restart()
+	{
+		m_nCounter = 0;
+	}
+	virtual ui32 Get()
+	{
+		if ( m_nCounter == 4096 )
+			m_nCounter = 0;
+
+		FLOAT fa = 0.05f;
+		FLOAT a = sin(m_nCounter*fa + 3.14f/2) * 0.8f;
+		FLOAT b = sin(m_nCounter*fa)*0.25f;
+
+		int da = (int)((a+1.0f)*127);
+		int db = (int)((b+1.0f)*127);
+		da = max(0, min(da, 255));
+		db = max(0, min(db, 255));
+		da |= rand()&3;
+		m_nCounter++;
+		return da | (db<<8);
+	}
+};
+
+class CFrameBuffer {
+public:
+	enum {
+		Width = 400,
+		Height = 240
+	};
+
+private:
+	ui16 m_pBuffer[Width*Height];
+
+public:
+	ULONGLONG m_nPixels;
+
+public:
+	CFrameBuffer()
+	{
+		m_nPixels = 0;
+		memset(m_pBuffer, 0, sizeof(m_pBuffer));
+	}
+
+	ui16* GetBuffer()
+	{
+		return m_pBuffer;
+	}
+
+	bool SavePpm(const char* strName)
+	{
+		FILE* f = fopen(strName, "wb");
+		if ( !f )
+			return false;
+		fprintf(f, "P6\n%d %d\n255\n", Width, Height);
+		for (int i=0; i<Width*Height; i++)
+		{
+			ui16 clr = m_pBuffer[i];
+			ui8 rgb[3] = { (ui8)Get565R(clr), (ui8)Get565G(clr), (ui8)Get565B(clr) };
+			fwrite(rgb, 3, 1, f);
+		}
+		fclose(f);
+		return true;
+	}
+};
+
+// Scripted key input, each line of the script holds "<time ms> <keys>", where
+// keys is a list of Left, Right, Up, Down, Enter, Escape, F1, F2, S1, S2 joined
+// by '+'. Keys stay pressed until the next event, "-" releases all of them.
+class CKeyScript {
+public:
+	enum {
+		MaxEvents = 1024
+	};
+
+	struct TEvent
+	{
+		ui32 nTime;
+		ui16 nKeys;
+	};
+
+private:
+	TEvent m_arrEvents[MaxEvents];
+	int m_nCount;
+	int m_nCurrent;
+
+public:
+	CKeyScript()
+	{
+		m_nCount = 0;
+		m_nCurrent = 0;
+	}
+
+	bool Push(ui32 nTime, ui16 nKeys)
+	{
+		if ( m_nCount >= MaxEvents )
+			return false;
+		m_arrEvents[m_nCount].nTime = nTime;
+		m_arrEvents[m_nCount].nKeys = nKeys;
+		m_nCount++;
+		return true;
+	}
+
+	bool Load(const char* strName)
+	{
+		FILE* f = fopen(strName, "r");
+		if ( !f )
+			return false;
+		char strLine[128];
+		while ( fgets(strLine, sizeof(strLine), f) )
+		{
+			char strKeys[96] = {0};
+			unsigned int nTime;
+			if ( strLine[0] == '#' || sscanf(strLine, "%u %95s", &nTime, strKeys) != 2 )
+				continue;
+			Push(nTime, Parse(strKeys));
+		}
+		fclose(f);
+		return true;
+	}
+
+	ui16 GetKeys(ui32 nTime)
+	{
+		while ( m_nCurrent < m_nCount && m_arrEvents[m_nCurrent].nTime <= nTime )
+			m_nCurrent++;
+		if ( m_nCurrent == 0 )
+			return 0;
+		return m_arrEvents[m_nCurrent-1].nKeys;
+	}
+
+	bool Finished(ui32 nTime)
+	{
+		return m_nCount == 0 || (m_nCurrent >= m_nCount && m_arrEvents[m_nCount-1].nTime <= nTime);
+	}
+
+	static ui16 Parse(char* strKeys)
+	{
+		const static struct {
+			const char* strName;
+			ui16 nKey;
+		} arrNames[] = {
+			{"Left", 1}, {"Right", 2}, {"Up", 4}, {"Down", 8}, {"Enter", 16},
+			{"Escape", 32}, {"F1", 64}, {"F2", 128}, {"S1", 256}, {"S2", 512}
+		};
+
+		ui16 nKeys = 0;
+		for ( char* strToken = strtok(strKeys, "+"); strToken; strToken = strtok(NULL, "+") )
+			for ( int i = 0; i < COUNT(arrNames); i++ )
+				if ( stricmp(strToken, arrNames[i].strName) == 0 )
+					nKeys |= arrNames[i].nKey;
+		return nKeys;
+	}
+};
+
+class CDevice {
+public:
+	static CDevice* m_pInstance;
+	CFrameBuffer display;
+	CKeyScript script;
+	CSampleSource* pSource;
+	char strRoot[256];
+	int nPty;
+	bool bMaxSpeed;
+	int mousex, mousey, moused;
+
+	// statistics
+	ULONGLONG nStarted;
+	ULONGLONG nRestarted;
+	ui32 nAcquisitions;
+	ULONGLONG nAcqLatency;
+	ULONGLONG nAcqLatencyMax;
+
+public:
+	CDevice()
+	{
+		m_pInstance = this;
+		pSource = NULL;
+		strcpy(strRoot, ".");
+		nPty = -1;
+		bMaxSpeed = false;
+		mousex = -1;
+		mousey = -1;
+		moused = 0;
+		nStarted = GetMicros();
+		nRestarted = nStarted;
+		nAcquisitions = 0;
+		nAcqLatency = 0;
+		nAcqLatencyMax = 0;
+	}
+
+	static ULONGLONG GetMicros()
+	{
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (ULONGLONG)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+	}
+
+	ui32 GetTick()
+	{
+		return (ui32)((GetMicros() - nStarted) / 1000);
+	}
+
+	CSampleSource* GetSource()
+	{
+		static CSineSource sine;
+		return pSource ? pSource : &sine;
+	}
+};
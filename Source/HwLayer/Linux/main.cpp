@@ -0,0 +1,166 @@
+// Headless DS203 simulator, runs the application against the Linux BIOS
+// without any display and reports the throughput of the GUI code
+//
+// usage: ds203 [-t ms] [-k keyscript] [-c scenario] [-r rec] [-R rec] [-d diskdir] [-s shot.ppm] [-p] [-m] [-b bench]
+//   -t  run for given number of milliseconds (default 5000)
+//   -k  load scripted key events, see CKeyScript
+//   -c  synthetic ADC signals described by a scenario file, see CScenarioSource
+//   -r  record the captures into the given file of the disk directory
+//   -R  replay a recording at max speed instead of acquiring
+//   -d  host directory used as the DSK/FAT root (default .)
+//   -s  save screen into PPM file when finished
+//   -p  open pseudo terminal for the serial port
+//   -m  max speed, the ADC is ready immediately after restart
+//   -b  run the given host benchmark and exit, see bench.cpp
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <termios.h>
+#include "device.h"
+#include "bench.h"
+#include "scenario.h"
+#include <Source/Framework/Application.h>
+#include <Source/Core/Settings.h>
+#include <Source/Core/Perf.h>
+#include <Source/Gui/Oscilloscope/Core/CoreRecorder.h>
+
+CDevice *CDevice::m_pInstance = NULL;
+CDevice g_dev;
+CApplication myApp;
+CApplicationProto* g_app = &myApp;
+CScenarioSource g_scenario;
+
+int _OpenPty()
+{
+	int nPty = posix_openpt( O_RDWR | O_NOCTTY );
+	if ( nPty < 0 || grantpt( nPty ) != 0 || unlockpt( nPty ) != 0 )
+		return -1;
+
+	struct termios tio;
+	tcgetattr( nPty, &tio );
+	cfmakeraw( &tio );
+	tcsetattr( nPty, TCSANOW, &tio );
+	fcntl( nPty, F_SETFL, fcntl( nPty, F_GETFL ) | O_NONBLOCK );
+
+	fprintf( stderr, "Serial port: %s\n", ptsname( nPty ) );
+	return nPty;
+}
+
+int main(int argc, char** argv)
+{
+	ui32 nDuration = 5000;
+	const char* strShot = NULL;
+	const char* strRecord = NULL;
+	const char* strReplay = NULL;
+
+	int nOpt;
+	while ( (nOpt = getopt( argc, argv, "t:k:c:r:R:d:s:pmb:" )) != -1 )
+	{
+		switch ( nOpt )
+		{
+		case 't':
+			nDuration = atoi( optarg );
+			break;
+		case 'k':
+			if ( !g_dev.script.Load( optarg ) )
+			{
+				fprintf( stderr, "Cannot load key script '%s'\n", optarg );
+				return 1;
+			}
+			break;
+		case 'c':
+			if ( !g_scenario.Load( optarg ) )
+			{
+				fprintf( stderr, "Cannot load scenario '%s'\n", optarg );
+				return 1;
+			}
+			g_dev.pSource = &g_scenario;
+			break;
+		case 'r':
+			strRecord = optarg;
+			break;
+		case 'R':
+			strReplay = optarg;
+			break;
+		case 'd':
+			strncpy( g_dev.strRoot, optarg, sizeof(g_dev.strRoot)-1 );
+			break;
+		case 's':
+			strShot = optarg;
+			break;
+		case 'p':
+			g_dev.nPty = _OpenPty();
+			break;
+		case 'm':
+			g_dev.bMaxSpeed = true;
+			break;
+		case 'b':
+			return RunBenchmark( optarg );
+		default:
+			fprintf( stderr, "usage: %s [-t ms] [-k keyscript] [-c scenario] [-r rec] [-R rec] [-d diskdir] [-s shot.ppm] [-p] [-m] [-b bench]\n", argv[0] );
+			return 1;
+		}
+	}
+
+	g_app->Create();
+	if ( strRecord )
+		CCoreRecorder::StartRecording( strRecord );
+	if ( strReplay )
+	{
+		CCoreRecorder::SetSpeed( CCoreRecorder::SpeedMax );
+		if ( !CCoreRecorder::StartReplay( strReplay ) )
+		{
+			fprintf( stderr, "Cannot replay '%s'\n", strReplay );
+			return 1;
+		}
+		BIOS::ADC::Enable( false );
+	}
+
+	ULONGLONG nBegin = CDevice::GetMicros();
+	ULONGLONG nPixels = g_dev.display.m_nPixels;
+	ui32 nAcquisitions = g_dev.nAcquisitions;
+	ui32 nLoops = 0;
+
+	while ( g_dev.GetTick() < nDuration )
+	{
+		(*g_app)();
+		nLoops++;
+	}
+
+	float fSeconds = (CDevice::GetMicros() - nBegin) / 1000000.0f;
+	nAcquisitions = g_dev.nAcquisitions - nAcquisitions;
+	nPixels = g_dev.display.m_nPixels - nPixels;
+
+	fprintf( stderr, "Run time: %.2f s\n", fSeconds );
+	fprintf( stderr, "Main loop: %u iterations, %.1f/s\n", (unsigned)nLoops, nLoops / fSeconds );
+	fprintf( stderr, "Acquisitions: %u, %.1f/s", (unsigned)nAcquisitions, nAcquisitions / fSeconds );
+	if ( g_dev.nAcquisitions > 0 )
+		fprintf( stderr, ", latency avg %.2f ms, max %.2f ms",
+			g_dev.nAcqLatency / 1000.0f / g_dev.nAcquisitions, g_dev.nAcqLatencyMax / 1000.0f );
+	fprintf( stderr, "\n" );
+	fprintf( stderr, "Waveforms: %d/s in the last second\n", Settings.Runtime.m_nWaveformsPerSecond );
+	fprintf( stderr, "LCD: %.2f Mpixels/s\n", nPixels / fSeconds / 1e6f );
+	fprintf( stderr, "Paints: %d/s in the last second, %d/s dropped\n", CPerf::GetPaintsPerSecond(),
+		CPerf::GetDropsPerSecond() );
+	ui32 nTextHits, nTextMisses;
+	BIOS::LCD::GetTextStats( nTextHits, nTextMisses );
+	fprintf( stderr, "Text cache: %u hits, %u misses\n", (unsigned)nTextHits, (unsigned)nTextMisses );
+	if ( strRecord || strReplay )
+		fprintf( stderr, "%s: %d frames\n", strRecord ? "Recorded" : "Replayed", strRecord ?
+			CCoreRecorder::GetFrames() : CCoreRecorder::GetFrame() + 1 );
+	for ( int i = 0; i < CPerf::StageMax; i++ )
+	{
+		const CPerf::TStage& stage = CPerf::Get( (CPerf::EStage)i );
+		if ( stage.nCount > 0 )
+			fprintf( stderr, "  %-10s min %u us, avg %u us, max %u us\n", CPerf::GetName( (CPerf::EStage)i ),
+				(unsigned)stage.nMin, (unsigned)(stage.nSum / stage.nCount), (unsigned)stage.nMax );
+	}
+
+	if ( strShot && !g_dev.display.SavePpm( strShot ) )
+		fprintf( stderr, "Cannot write '%s'\n", strShot );
+
+	g_app->Destroy();
+	if ( g_dev.nPty >= 0 )
+		close( g_dev.nPty );
+	return 0;
+}
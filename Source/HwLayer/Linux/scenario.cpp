@@ -0,0 +1,362 @@
+#include "scenario.h"
+#include <ctype.h>
+
+// "1k5" style values are not supported, "1.5k" and "2M" are
+static float _ParseValue(const char* strValue)
+{
+	char* strEnd;
+	float fValue = (float)strtod(strValue, &strEnd);
+	if ( *strEnd == 'k' )
+		fValue *= 1e3f;
+	if ( *strEnd == 'M' )
+		fValue *= 1e6f;
+	return fValue;
+}
+
+static int _ParseHex(const char* strValue, ui8* pData, int nMax)
+{
+	int nCount = 0;
+	for ( ; isxdigit(strValue[0]) && isxdigit(strValue[1]) && nCount < nMax; strValue += 2 )
+	{
+		char strByte[3] = { strValue[0], strValue[1], 0 };
+		pData[nCount++] = (ui8)strtoul(strByte, NULL, 16);
+	}
+	return nCount;
+}
+
+CScenarioSource::CScenarioSource()
+{
+	memset(m_arrChannels, 0, sizeof(m_arrChannels));
+	m_nSeed = 1;
+	m_nRandom = 1;
+	m_nNoisePos = 0;
+	m_fTimePerDiv = 1e-3f;
+	for ( int c = 0; c < Channels; c++ )
+		Parse(c < 2 ? (c == 0 ? "ch1 dc" : "ch2 dc") : (c == 2 ? "ch3 dc offset=0" : "ch4 dc offset=0"));
+}
+
+bool CScenarioSource::Load(const char* strName)
+{
+	FILE* f = fopen(strName, "r");
+	if ( !f )
+		return false;
+	char strLine[256];
+	int nLine = 0;
+	bool bValid = true;
+	while ( fgets(strLine, sizeof(strLine), f) )
+	{
+		nLine++;
+		if ( !Parse(strLine) )
+		{
+			fprintf(stderr, "%s:%d: cannot parse '%s'\n", strName, nLine, strtok(strLine, "\r\n"));
+			bValid = false;
+		}
+	}
+	fclose(f);
+	return bValid;
+}
+
+bool CScenarioSource::Parse(const char* strLine)
+{
+	const static char* arrShapes[] = {"dc", "sine", "square", "pulse", "noise", "uart", "can", "i2c"};
+
+	char strCopy[256];
+	strncpy(strCopy, strLine, sizeof(strCopy)-1);
+	strCopy[sizeof(strCopy)-1] = 0;
+	char* strComment = strchr(strCopy, '#');
+	if ( strComment )
+		*strComment = 0;
+
+	const char* strSeparators = " \t\r\n";
+	char* strToken = strtok(strCopy, strSeparators);
+	if ( !strToken )
+		return true;
+	if ( strcmp(strToken, "seed") == 0 )
+	{
+		strToken = strtok(NULL, strSeparators);
+		if ( !strToken )
+			return false;
+		m_nSeed = (ui32)strtoul(strToken, NULL, 0);
+		m_nRandom = m_nSeed ? m_nSeed : 1;
+		for ( int c = 0; c < Channels; c++ )
+			_Render(c);
+		return true;
+	}
+	if ( strncmp(strToken, "ch", 2) != 0 || strToken[2] < '1' || strToken[2] > '4' || strToken[3] != 0 )
+		return false;
+	int nChannel = strToken[2] - '1';
+
+	strToken = strtok(NULL, strSeparators);
+	int nShape = -1;
+	for ( int i = 0; strToken && i < COUNT(arrShapes); i++ )
+		if ( strcmp(strToken, arrShapes[i]) == 0 )
+			nShape = i;
+	if ( nShape < 0 )
+		return false;
+
+	TChannel& ch = m_arrChannels[nChannel];
+	ch.eShape = (EShape)nShape;
+	ch.nAmp = 64;
+	ch.nOffset = 128;
+	ch.nPeriod = 64;
+	ch.fFreq = 0;
+	ch.nBit = 8;
+	ch.fBaud = 0;
+	ch.nDuty = ch.eShape == Pulse ? 10 : 50;
+	ch.nNoise = ch.eShape == Noise ? 8 : 0;
+	ch.nJitter = 0;
+	ch.arrData[0] = 0x55;
+	ch.nData = 1;
+	ch.nId = 0x123;
+	ch.nAddr = 0x50;
+	ch.bScl = false;
+	ch.nGap = 10;
+
+	while ( (strToken = strtok(NULL, strSeparators)) != NULL )
+	{
+		char* strValue = strchr(strToken, '=');
+		if ( !strValue )
+			return false;
+		*strValue++ = 0;
+		if ( strcmp(strToken, "amp") == 0 )
+			ch.nAmp = atoi(strValue);
+		else if ( strcmp(strToken, "offset") == 0 )
+			ch.nOffset = atoi(strValue);
+		else if ( strcmp(strToken, "period") == 0 )
+			ch.nPeriod = atoi(strValue);
+		else if ( strcmp(strToken, "freq") == 0 )
+			ch.fFreq = _ParseValue(strValue);
+		else if ( strcmp(strToken, "bit") == 0 )
+			ch.nBit = atoi(strValue);
+		else if ( strcmp(strToken, "baud") == 0 )
+			ch.fBaud = _ParseValue(strValue);
+		else if ( strcmp(strToken, "duty") == 0 )
+			ch.nDuty = atoi(strValue);
+		else if ( strcmp(strToken, "noise") == 0 )
+			ch.nNoise = atoi(strValue);
+		else if ( strcmp(strToken, "jitter") == 0 )
+			ch.nJitter = atoi(strValue);
+		else if ( strcmp(strToken, "data") == 0 )
+			ch.nData = _ParseHex(strValue, ch.arrData, MaxData);
+		else if ( strcmp(strToken, "id") == 0 )
+			ch.nId = (int)strtoul(strValue, NULL, 0) & 0x7ff;
+		else if ( strcmp(strToken, "addr") == 0 )
+			ch.nAddr = (int)strtoul(strValue, NULL, 0) & 0x7f;
+		else if ( strcmp(strToken, "line") == 0 )
+			ch.bScl = strcmp(strValue, "scl") == 0;
+		else if ( strcmp(strToken, "gap") == 0 )
+			ch.nGap = atoi(strValue);
+		else
+			return false;
+	}
+	_Render(nChannel);
+	return true;
+}
+
+// xorshift32, the only source of randomness of the scenario
+ui32 CScenarioSource::_Random()
+{
+	ui32 x = m_nRandom & 0xffffffff;
+	x ^= (x << 13) & 0xffffffff;
+	x ^= x >> 17;
+	x ^= (x << 5) & 0xffffffff;
+	m_nRandom = x;
+	return x;
+}
+
+void CScenarioSource::Restart()
+{
+	for ( int c = 0; c < Channels; c++ )
+	{
+		TChannel& ch = m_arrChannels[c];
+		int nShift = ch.nJitter > 0 ? (int)(_Random() % (2*ch.nJitter+1)) - ch.nJitter : 0;
+		ch.nPos = ((nShift % ch.nLength) + ch.nLength) % ch.nLength;
+	}
+	m_nNoisePos = _Random() % NoiseLength;
+}
+
+void CScenarioSource::Configure(float fTimePerDiv)
+{
+	m_fTimePerDiv = fTimePerDiv;
+	for ( int c = 0; c < Channels; c++ )
+		if ( m_arrChannels[c].fFreq > 0 || m_arrChannels[c].fBaud > 0 )
+			_Render(c);
+}
+
+// samples per cycle or per bit, a rate in Hz follows the timebase
+int CScenarioSource::_GetSamples(int nSamples, float fRate, int nMin)
+{
+	if ( fRate > 0 )
+		nSamples = (int)(SamplesPerDiv / m_fTimePerDiv / fRate + 0.5f);
+	return max(nMin, min(nSamples, (int)MaxTable));
+}
+
+void CScenarioSource::_Put(TChannel& ch, int nLevel, int nSamples)
+{
+	for ( int i = 0; i < nSamples && ch.nLength < MaxTable; i++ )
+		ch.arrTable[ch.nLength++] = (ui8)nLevel;
+}
+
+// nCount bits, most significant first
+void CScenarioSource::_PutBits(TChannel& ch, ui32 nBits, int nCount, int nBit)
+{
+	for ( int i = nCount-1; i >= 0; i-- )
+		_Put(ch, (nBits >> i) & 1, nBit);
+}
+
+// standard data frame with acknowledge, stuff bits follow five equal bits
+// from the start of frame to the end of the CRC
+void CScenarioSource::_PutCan(TChannel& ch, int nBit)
+{
+	ui8 arrBits[128];
+	int nBits = 0;
+	int nData = min(ch.nData, 8);
+	arrBits[nBits++] = 0;
+	for ( int i = 10; i >= 0; i-- )
+		arrBits[nBits++] = (ch.nId >> i) & 1;
+	arrBits[nBits++] = 0;	// RTR
+	arrBits[nBits++] = 0;	// IDE
+	arrBits[nBits++] = 0;	// r0
+	for ( int i = 3; i >= 0; i-- )
+		arrBits[nBits++] = (nData >> i) & 1;
+	for ( int j = 0; j < nData; j++ )
+		for ( int i = 7; i >= 0; i-- )
+			arrBits[nBits++] = (ch.arrData[j] >> i) & 1;
+
+	int nCrc = 0;
+	for ( int i = 0; i < nBits; i++ )
+	{
+		int nNext = arrBits[i] ^ ((nCrc >> 14) & 1);
+		nCrc = (nCrc << 1) & 0x7fff;
+		if ( nNext )
+			nCrc ^= 0x4599;
+	}
+	for ( int i = 14; i >= 0; i-- )
+		arrBits[nBits++] = (nCrc >> i) & 1;
+
+	int nRun = 0, nLast = -1;
+	for ( int i = 0; i < nBits; i++ )
+	{
+		_Put(ch, arrBits[i], nBit);
+		nRun = arrBits[i] == nLast ? nRun + 1 : 1;
+		nLast = arrBits[i];
+		if ( nRun == 5 )
+		{
+			nLast = 1 - nLast;
+			_Put(ch, nLast, nBit);
+			nRun = 1;
+		}
+	}
+	// CRC delimiter, ACK slot, ACK delimiter, end of frame and intermission
+	_PutBits(ch, 0x17ff, 13, nBit);
+}
+
+// address with write bit and the data bytes, every byte acknowledged, the
+// data changes in the first half of a bit while SCL is low
+void CScenarioSource::_PutI2c(TChannel& ch, int nBit)
+{
+	int nHalf = nBit / 2;
+	ui16 arrBytes[MaxData+1];
+	arrBytes[0] = (ui16)(ch.nAddr << 1);
+	for ( int i = 0; i < ch.nData; i++ )
+		arrBytes[i+1] = ch.arrData[i];
+
+	#define I2C(scl, sda) _Put(ch, ch.bScl ? (scl) : (sda), nHalf)
+	I2C(1, 1);
+	I2C(1, 0);
+	for ( int j = 0; j <= ch.nData; j++ )
+	{
+		// 8 data bits and the acknowledge driven low by the slave
+		int nWord = arrBytes[j] << 1;
+		for ( int i = 8; i >= 0; i-- )
+		{
+			I2C(0, (nWord >> i) & 1);
+			I2C(1, (nWord >> i) & 1);
+		}
+	}
+	I2C(0, 0);
+	I2C(1, 0);
+	I2C(1, 1);
+	#undef I2C
+}
+
+void CScenarioSource::_Render(int nChannel)
+{
+	TChannel& ch = m_arrChannels[nChannel];
+	bool bAnalog = nChannel < 2;
+	bool bLogic = true;
+	int nPeriod = _GetSamples(ch.nPeriod, ch.fFreq, 2);
+	int nBit = _GetSamples(ch.nBit, ch.fBaud, 2);
+
+	// the bus is idle at the beginning of a capture
+	ch.nLength = 0;
+	if ( ch.eShape >= Uart )
+		_Put(ch, 1, max(ch.nGap, 1) * nBit);
+	switch ( ch.eShape )
+	{
+	case Dc:
+	case Noise:
+		bLogic = !bAnalog;
+		_Put(ch, bAnalog ? max(0, min(ch.nOffset, 255)) : ch.nOffset > 0, 1);
+		break;
+	case Sine:
+		bLogic = !bAnalog;
+		for ( int i = 0; i < nPeriod; i++ )
+		{
+			float fSin = sin(i * 2 * 3.14159265f / nPeriod);
+			int nValue = (int)floor(ch.nOffset + ch.nAmp * fSin + 0.5f);
+			_Put(ch, bAnalog ? max(0, min(nValue, 255)) : fSin >= 0, 1);
+		}
+		break;
+	case Square:
+	case Pulse:
+	{
+		int nHigh = max(1, min(nPeriod * ch.nDuty / 100, nPeriod-1));
+		_Put(ch, 1, nHigh);
+		_Put(ch, 0, nPeriod - nHigh);
+		break;
+	}
+	case Uart:
+		// 8N1, least significant bit first
+		for ( int j = 0; j < ch.nData; j++ )
+		{
+			_Put(ch, 0, nBit);
+			for ( int i = 0; i < 8; i++ )
+				_Put(ch, (ch.arrData[j] >> i) & 1, nBit);
+			_Put(ch, 1, nBit);
+		}
+		break;
+	case Can:
+		_PutCan(ch, nBit);
+		break;
+	case I2c:
+		_PutI2c(ch, nBit);
+		break;
+	}
+	if ( bLogic && bAnalog )
+	{
+		int nLow = ch.eShape == Pulse ? ch.nOffset : ch.nOffset - ch.nAmp;
+		int nHigh = ch.nOffset + ch.nAmp;
+		nLow = max(0, min(nLow, 255));
+		nHigh = max(0, min(nHigh, 255));
+		for ( int i = 0; i < ch.nLength; i++ )
+			ch.arrTable[i] = (ui8)(ch.arrTable[i] ? nHigh : nLow);
+	}
+	ch.nPos = 0;
+
+	// gaussian like noise from the sum of four uniform values, every channel
+	// has its own sequence given by the seed
+	ui32 nState = (m_nSeed + 1) * 2654435761u + nChannel;
+	for ( int i = 0; i < NoiseLength; i++ )
+	{
+		int nSum = 0;
+		for ( int j = 0; j < 4; j++ )
+		{
+			nState = (nState * 1103515245 + 12345) & 0xffffffff;
+			nSum += (int)((nState >> 16) & 0x7fff) - 0x4000;
+		}
+		// the sum has rms of 1.155 * 0x4000
+		int nValue = bAnalog ? (int)floor(nSum * ch.nNoise / (1.155f * 0x4000) + 0.5f) : 0;
+		ch.arrNoise[i] = (si8)max(-127, min(nValue, 127));
+	}
+}
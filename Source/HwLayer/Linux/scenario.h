@@ -0,0 +1,121 @@
+#pragma once
+#include "device.h"
+
+// Synthetic signal source described by a scenario file. Each channel plays a
+// table that is rendered when the scenario is loaded or the timebase changes,
+// the noise is a table too, so one sample costs a few lookups. A seeded PRNG
+// shifts every capture by up to the jitter and picks the noise offset, the
+// sequence of captures is the same in every run of the simulator.
+//
+// One statement per line, '#' starts a comment:
+//   seed <n>
+//   <ch1|ch2|ch3|ch4> <shape> [key=value ...]
+// shapes: dc, sine, square, pulse, noise, uart, can, i2c
+// keys:   amp, offset   peak amplitude and mean level in ADC counts
+//         period, freq  length of one cycle in samples or its frequency in Hz
+//         bit, baud     bit length in samples or bit rate of uart, can and i2c
+//         duty          high time of square and pulse in percent
+//         noise         rms noise in ADC counts (analog channels)
+//         jitter        largest shift of a capture in samples
+//         data          hex bytes sent by uart, can and i2c
+//         id, addr      can identifier, i2c address
+//         line          sda (default) or scl of i2c
+//         gap           idle bits before the frame
+// Logic shapes on analog channels swing between offset-amp and offset+amp,
+// pulse between offset and offset+amp
+class CScenarioSource : public CSampleSource {
+public:
+	enum {
+		Channels = 4,
+		MaxTable = 8192,
+		NoiseLength = 4093,
+		MaxData = 16,
+		// FIFO samples per division of the timebase, same as BIOS::ADC::GetPointer
+		SamplesPerDiv = 30
+	};
+
+	enum EShape {
+		Dc,
+		Sine,
+		Square,
+		Pulse,
+		Noise,
+		Uart,
+		Can,
+		I2c
+	};
+
+	struct TChannel
+	{
+		EShape eShape;
+		int nAmp;
+		int nOffset;
+		int nPeriod;
+		float fFreq;
+		int nBit;
+		float fBaud;
+		int nDuty;
+		int nNoise;
+		int nJitter;
+		ui8 arrData[MaxData];
+		int nData;
+		int nId;
+		int nAddr;
+		bool bScl;
+		int nGap;
+
+		// rendered signal, ADC counts on CH1/CH2, 0 or 1 on CH3/CH4
+		ui8 arrTable[MaxTable];
+		si8 arrNoise[NoiseLength];
+		int nLength;
+		int nPos;
+	};
+
+private:
+	TChannel m_arrChannels[Channels];
+	ui32 m_nSeed;
+	ui32 m_nRandom;
+	int m_nNoisePos;
+	float m_fTimePerDiv;
+
+public:
+	CScenarioSource();
+
+	bool Load(const char* strName);
+	// one line of the scenario, returns false on a syntax error
+	bool Parse(const char* strLine);
+
+	virtual void Restart();
+	virtual void Configure(float fTimePerDiv);
+	virtual ui32 Get()
+	{
+		ui32 nSample = 0;
+		for ( int c = 0; c < 2; c++ )
+		{
+			TChannel& ch = m_arrChannels[c];
+			int nValue = ch.arrTable[ch.nPos] + ch.arrNoise[m_nNoisePos];
+			nSample |= (ui32)( nValue < 0 ? 0 : nValue > 255 ? 255 : nValue ) << (c*8);
+			if ( ++ch.nPos == ch.nLength )
+				ch.nPos = 0;
+		}
+		for ( int c = 2; c < Channels; c++ )
+		{
+			TChannel& ch = m_arrChannels[c];
+			nSample |= (ui32)ch.arrTable[ch.nPos] << (14+c);
+			if ( ++ch.nPos == ch.nLength )
+				ch.nPos = 0;
+		}
+		if ( ++m_nNoisePos == NoiseLength )
+			m_nNoisePos = 0;
+		return nSample;
+	}
+
+private:
+	ui32 _Random();
+	void _Render(int nChannel);
+	void _Put(TChannel& ch, int nLevel, int nSamples);
+	void _PutBits(TChannel& ch, ui32 nBits, int nCount, int nBit);
+	void _PutCan(TChannel& ch, int nBit);
+	void _PutI2c(TChannel& ch, int nBit);
+	int _GetSamples(int nSamples, float fRate, int nMin);
+};
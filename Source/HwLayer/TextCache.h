@@ -0,0 +1,114 @@
+#ifndef __TEXTCACHE_H__
+#define __TEXTCACHE_H__
+
+// Text run cache of the BIOS::LCD::Print. An opaque text run is rasterised
+// once into a strip of RGB565 columns (bottom to top, as BlitColumns takes
+// them) and the next Print of the same string with the same colours sends the
+// strip in one block transfer instead of setting the pixels of every glyph.
+// Every entry owns a slot for a strip of MaxChars, the oldest entry is
+// replaced first. There is only the 8x14 font, so the key is the string and
+// the colours.
+// Included once by the BIOS implementation after its font (GetFont). The ARM
+// BIOS does not use it, the application RAM has no room for the strips
+class CTextCache
+{
+public:
+	enum {
+		CharWidth = 8,
+		CharHeight = 14,
+		// the values of all the measurements and the menu
+		Entries = 16,
+		MaxChars = 9,
+		// longer runs are drawn directly
+		SlotPixels = MaxChars * CharWidth * CharHeight,
+		Pixels = Entries * SlotPixels
+	};
+
+	struct TEntry
+	{
+		ui32 nHash;
+		ui16 clrf;
+		ui16 clrb;
+		ui8 nLength;	// 0 for free entry
+		char str[MaxChars];
+	};
+
+private:
+	static ui16 m_arrPixels[Pixels];
+	static TEntry m_arrEntries[Entries];
+	static int m_nNext;
+	static ui32 m_nHits;
+	static ui32 m_nMisses;
+
+public:
+	// strip of the run, NULL when the run is not cacheable (transparent
+	// colour, new line, too long)
+	static const ui16* Get(const char* str, ui16 clrf, ui16 clrb, int& nLength)
+	{
+		if ( clrf == RGBTRANS || clrb == RGBTRANS )
+			return NULL;
+
+		ui32 nHash = clrf ^ (clrb << 16);
+		for ( nLength = 0; str[nLength]; nLength++ )
+		{
+			if ( nLength == MaxChars || str[nLength] == '\n' )
+				return NULL;
+			nHash = ( nHash * 33 ) ^ (ui8)str[nLength];
+		}
+
+		for ( int i = 0; i < Entries; i++ )
+		{
+			TEntry& entry = m_arrEntries[i];
+			if ( entry.nHash == nHash && entry.nLength == nLength && entry.clrf == clrf &&
+				entry.clrb == clrb && memcmp( entry.str, str, nLength ) == 0 )
+			{
+				m_nHits++;
+				return m_arrPixels + i * SlotPixels;
+			}
+		}
+
+		m_nMisses++;
+		return _Rasterise( str, nLength, clrf, clrb, nHash );
+	}
+
+	static void GetStats(ui32& nHits, ui32& nMisses)
+	{
+		nHits = m_nHits;
+		nMisses = m_nMisses;
+	}
+
+private:
+	static const ui16* _Rasterise(const char* str, int nLength, ui16 clrf, ui16 clrb, ui32 nHash)
+	{
+		int nEntry = m_nNext;
+		m_nNext = ( m_nNext + 1 ) % Entries;
+
+		TEntry& entry = m_arrEntries[nEntry];
+		entry.nHash = nHash;
+		entry.clrf = clrf;
+		entry.clrb = clrb;
+		entry.nLength = nLength;
+		memcpy( entry.str, str, nLength );
+
+		ui16* pStrip = m_arrPixels + nEntry * SlotPixels;
+		for ( int i = 0; i < nLength; i++ )
+		{
+			const ui8* pFont = GetFont( str[i] );
+			for ( ui8 _x = 0; _x < CharWidth; _x++ )
+			{
+				ui8 nMask = 128 >> _x;
+				for ( int _y = CharHeight-1; _y >= 0; _y-- )
+					*pStrip++ = ( pFont[_y] & nMask ) ? clrb : clrf;
+			}
+		}
+		return m_arrPixels + nEntry * SlotPixels;
+	}
+};
+
+/*static*/ ui16 CTextCache::m_arrPixels[CTextCache::Pixels];
+/*static*/ CTextCache::TEntry CTextCache::m_arrEntries[CTextCache::Entries];
+/*static*/ int CTextCache::m_nNext = 0;
+/*static*/ ui32 CTextCache::m_nHits = 0;
+/*static*/ ui32 CTextCache::m_nMisses = 0;
+
+#endif
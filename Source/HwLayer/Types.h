@@ -6,6 +6,10 @@
 #	include "ArmM3/Types.h"
 #endif
 
+#ifdef _LINUX
+#	include "Linux/Types.h"
+#endif
+
 #ifndef __TYPES_H__
 #	error Platform not defined
 #endif
\ No newline at end of file
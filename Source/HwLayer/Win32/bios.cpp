@@ -11,9 +11,11 @@
 #include <math.h>
 //u16 *Get_TAB_8x14(u8 Code)
 #include "sprintf\spf.h"
+#include <Source/HwLayer/TextCache.h>
 
 CRect m_rcBuffer;
 CPoint m_cpBuffer;
+const CClipRegion* m_pClip = NULL;
 int m_nKeys;
 int g_nBufferLen = 4096;
 
@@ -55,23 +57,7 @@ void Assert(const char *msg, int n)
        
 /*static*/ int BIOS::LCD::Print (int x, int y, unsigned short clrf, unsigned short clrb, char *str)
 {
-	if (!str || !*str)
-		return 0;
-	int nAux = 0;
-	int _x = x;
-	for (;*str; str++)
-	{
-		if (*str == '\n')
-		{
-			x = _x;
-			y += 16;
-			continue;
-		}
-		int nW = _DrawChar(x, y, clrf, clrb, *str);
-		x += nW;
-		nAux += nW;
-	}
-	return nAux;
+	return Print(x, y, clrf, clrb, (const char*)str);
 }
 
 /*static*/ int BIOS::LCD::Print (int x, int y, unsigned short clrf, unsigned short clrb, const char *str)
@@ -84,6 +70,15 @@ void Assert(const char *msg, int n)
 #endif*/
 	if (!str || !*str)
 		return 0;
+	int nLength = 0;
+	const ui16* pStrip = ( x >= 0 && y >= 0 && y + CTextCache::CharHeight <= LcdHeight ) ?
+		CTextCache::Get( str, clrf, clrb, nLength ) : NULL;
+	if ( pStrip && x + nLength*CTextCache::CharWidth <= LcdWidth )
+	{
+		BlitColumns( CRect( x, y, x + nLength*CTextCache::CharWidth, y + CTextCache::CharHeight ),
+			pStrip, CTextCache::CharHeight );
+		return nLength*CTextCache::CharWidth;
+	}
 	int nAux = 0;
 	int _x = x;
 	for (;*str; str++)
@@ -106,10 +101,17 @@ void Assert(const char *msg, int n)
 	return Print(cp.x, cp.y, clrf, RGBTRANS, str);
 }
 
+/*static*/ void BIOS::LCD::GetTextStats(ui32& nHits, ui32& nMisses)
+{
+	CTextCache::GetStats( nHits, nMisses );
+}
+
 /*static*/ void BIOS::LCD::PutPixel(int x, int y, unsigned short clr)
 {
 	if ( clr == RGBTRANS )
 		return;
+	if ( m_pClip && m_pClip->IsHidden( x, y ) )
+		return;
 	DWORD *pBuf = (DWORD*)DEVICE->display.GetBuffer();
 	pBuf[y*CFrameBuffer::Width+x] = FROM_565_TO_RGB(clr);
 }
@@ -127,6 +129,11 @@ void Assert(const char *msg, int n)
 
 /*static*/ void BIOS::LCD::Clear(unsigned short clr)
 {
+	if ( m_pClip && m_pClip->IsActive() )
+	{
+		Bar( 0, 0, CFrameBuffer::Width, CFrameBuffer::Height, clr );
+		return;
+	}
 	DWORD *pBuf = (DWORD*)DEVICE->display.GetBuffer();
 	COLORREF c = FROM_565_TO_RGB(clr);
 	for (int i=0; i<CFrameBuffer::Width*CFrameBuffer::Height; i++, pBuf++)
@@ -203,6 +210,29 @@ void Assert(const char *msg, int n)
 		}
 }
 
+/*static*/ void BIOS::LCD::BlitRect(const CRect& rc, const ui16* pBuffer, int nStride)
+{
+	DWORD *pBuf = (DWORD*)DEVICE->display.GetBuffer();
+	for (int y=rc.top; y<rc.bottom; y++, pBuffer += nStride)
+		for (int x=rc.left; x<rc.right; x++)
+			if ( !m_pClip || !m_pClip->IsHidden( x, y ) )
+				pBuf[y*CFrameBuffer::Width+x] = FROM_565_TO_RGB(pBuffer[x-rc.left]);
+}
+
+/*static*/ void BIOS::LCD::BlitColumns(const CRect& rc, const ui16* pBuffer, int nStride)
+{
+	DWORD *pBuf = (DWORD*)DEVICE->display.GetBuffer();
+	for (int x=rc.left; x<rc.right; x++, pBuffer += nStride)
+		for (int y=rc.bottom-1; y>=rc.top; y--)
+			if ( !m_pClip || !m_pClip->IsHidden( x, y ) )
+				pBuf[y*CFrameBuffer::Width+x] = FROM_565_TO_RGB(pBuffer[rc.bottom-1-y]);
+}
+
+/*static*/ void BIOS::LCD::SetClip(const CClipRegion* pClip)
+{
+	m_pClip = pClip;
+}
+
 
 /*static*/ int BIOS::LCD::Draw(int x, int y, unsigned short clrf, unsigned short clrb, const char *p)
 {
@@ -384,6 +414,14 @@ void Assert(const char *msg, int n)
 	return GetTickCount();
 }
 
+/*static*/ ui32 BIOS::SYS::GetMicros()
+{
+	LARGE_INTEGER nFrequency, nCounter;
+	QueryPerformanceFrequency( &nFrequency );
+	QueryPerformanceCounter( &nCounter );
+	return (ui32)( nCounter.QuadPart * 1000000 / nFrequency.QuadPart );
+}
+
 /*static*/ void BIOS::LCD::Line(int x1, int y1, int x2, int y2, unsigned short clr)
 {
     // if x1 == x2 or y1 == y2, then it does not matter what we set here
@@ -560,6 +598,25 @@ unsigned long g_ADCMem[ADCSIZE];
 	}
 }
 
+/*static*/ void BIOS::ADC::Read(TSample* pTarget, int nCount)
+{
+	for ( int i = 0; i < nCount; i++ )
+		pTarget[i] = Get();
+}
+
+/*static*/ void BIOS::ADC::CopySegment(int nFirst, int nCount, int nTarget)
+{
+	_ASSERT( nFirst >= 0 && nFirst + nCount <= ADCSIZE && nTarget + nCount <= ADCSIZE );
+	for ( int i = 0; i < ADCSIZE; i++ )
+	{
+		ui32 nSample = Get();
+		if ( i < nFirst || i >= nFirst + nCount )
+			continue;
+		unsigned long& nTargetSample = g_ADCMem[nTarget + i - nFirst];
+		nTargetSample = ( nSample & 0x00ffffff ) | ( nTargetSample & 0xff000000 );
+	}
+}
+
 /*static*/ unsigned long BIOS::ADC::GetCount()
 {
 	return ADCSIZE;
@@ -1073,6 +1130,8 @@ FILEINFO fatFile;
 		fatFile.f = fopen(strName, "rb");
 	if ( nIoMode == BIOS::DSK::IoWrite )
 		fatFile.f = fopen(strName, "wb");
+	if ( nIoMode == BIOS::DSK::IoAppend )
+		fatFile.f = fopen(strName, "ab");
 	fatFile.nSectors = 0;
 	int e = GetLastError();
 	return (fatFile.f != NULL && fatFile.f != INVALID_HANDLE_VALUE) ? BIOS::FAT::EOk : BIOS::FAT::EIntError;
@@ -114,7 +114,6 @@ public:
 
 	virtual void OnTimer()
 	{
-		static int nLastRedraw = 0;
 		if ( HasOverlay() )
 			return;
 
@@ -122,8 +121,6 @@ public:
 
 		if ( m_bRedraw )
 		{
-			nLastRedraw = nTick;
-
 			static int nMinutes, nHours, nDay, nWDay, nMonth, nYear;
 			struct TDcfItem {
 				const char* strName;
@@ -354,7 +351,7 @@ public:
 	void OnWave()
 	{
 		BIOS::ADC::SSample Sample;
-		Sample.nValue = BIOS::ADC::GetAt( 1024 );
+		Sample.nValue = CCaptureStore::GetAt( 1024 );
 		m_nSample = Sample.CH1;
 		bool bSignal = ( Sample.CH1 > (int)Settings.Trig.nLevel );
 		if ( bSignal != m_bPrevSignal )
@@ -390,7 +387,7 @@ public:
 
 	virtual void OnMessage(CWnd* pSender, ui16 code, ui32 data)
 	{
-	 	if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'g') )
+	 	if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'a') )
 		{
 			OnWave();
 			return;
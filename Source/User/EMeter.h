@@ -59,14 +59,14 @@ public:
 			return;
 		}
 
-		if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'g') )
+		if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'a') )
 		{
 			// get average to reduce spurious errors, probably useless
 			int nSum = 0;
 			for (int i=256; i<512; i++)
 			{
 				BIOS::ADC::SSample Sample;
-				Sample.nValue = BIOS::ADC::GetAt(i);
+				Sample.nValue = CCaptureStore::GetAt(i);
 				nSum += Sample.CH1;
 			}
 			nSum /= 256;
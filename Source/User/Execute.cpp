@@ -37,7 +37,7 @@ bool Verify( CBufferedReader2& f, Elf32_Shdr& elfSection )
 {
 	f.Seek( elfSection.offset );
 
-	ui8* pMem = (ui8*)elfSection.addr;
+	ui8* pMem = (ui8*)(ui32)elfSection.addr;
 	for (int i=0; i<(int)elfSection.size; i++, pMem++)
 	{
 		ui8 bData;
@@ -50,7 +50,7 @@ bool Verify( CBufferedReader2& f, Elf32_Shdr& elfSection )
 
 bool VerifyZero( CBufferedReader2& f, Elf32_Shdr& elfSection )
 {
-	ui8* pMem = (ui8*)elfSection.addr;
+	ui8* pMem = (ui8*)(ui32)elfSection.addr;
 	for (int i=0; i<(int)elfSection.size; i++, pMem++)
 	{
 		if ( 0 != *pMem )
@@ -62,7 +62,7 @@ bool VerifyZero( CBufferedReader2& f, Elf32_Shdr& elfSection )
 void FlashRam( CBufferedReader2& f, Elf32_Shdr& elfSection )
 {
 	f.Seek( elfSection.offset );
-	ui8* pWriteTo = (ui8*)elfSection.addr;
+	ui8* pWriteTo = (ui8*)(ui32)elfSection.addr;
 	for (int i=0; i<(int)elfSection.size; i++)
 	{
 		ui8 bData;
@@ -74,7 +74,7 @@ void FlashRam( CBufferedReader2& f, Elf32_Shdr& elfSection )
 void ZeroRam( CBufferedReader2& f, Elf32_Shdr& elfSection )
 {
 	// section length should be aligned to 32bits!?
-	ui8* pWriteTo = (ui8*)elfSection.addr;
+	ui8* pWriteTo = (ui8*)(ui32)elfSection.addr;
 	for (int i=0; i<(int)elfSection.size; i++)
 		*pWriteTo++ = 0;
 }
@@ -373,7 +373,7 @@ void CWndUserManager::ElfExecute( char* strName )
 					0x20000E84 (GOT[2]) -> 0x20000DAC (PLT[0])
 					0x20000E84 (GOT[2]) <- new address
 					*/
-					ui32* pRelocation = (ui32*)elfRelocation.r_offset;
+					ui32* pRelocation = (ui32*)(ui32)elfRelocation.r_offset;
 					*pRelocation = dwProcAddr;
 #endif
 				}
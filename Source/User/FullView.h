@@ -5,6 +5,7 @@ ADD_MODULE( "FView", CWndFullView )
 #define __FULLVIEW_H__
 
 #include <Source/Framework/Wnd.h>
+#include <Source/Gui/Oscilloscope/Core/CaptureStore.h>
 
 class CWndFullView : public CWnd
 {
@@ -18,6 +19,8 @@ class CWndFullView : public CWnd
 
 	CWndButton m_btn1;
 	//CWndButton m_btn2;
+	// write pointer at the last acquisition
+	int m_nPtr;
 
 public:
 	virtual void Create(CWnd *pParent, ui16 dwFlags)
@@ -25,6 +28,7 @@ public:
 		CWnd::Create("CWndFullView", dwFlags | CWnd::WsListener /*| CWnd::WsNoActivate*/, CRect(0, 16, 400, 240), pParent);
 		CRect rc1( 240, m_rcClient.bottom-16, 320, m_rcClient.bottom );
 		m_btn1.Create("reset W_PTR", CWnd::WsVisible, rc1, this);
+		m_nPtr = 0;
 		//CRect rc2( 280, m_rcClient.bottom-16, 330, m_rcClient.bottom );
 		//m_btn2.Create("R_PTR", CWnd::WsVisible, rc2, this);
 	}
@@ -33,6 +37,7 @@ public:
 	{
 		if ( HasOverlay() )
 			return;
+		Capture();
 		DrawWave();
 	}
 
@@ -42,13 +47,18 @@ public:
 		BIOS::LCD::Bar(0, m_rcClient.bottom-20, 400, m_rcClient.bottom, RGB565(808080));
 	}
 
+	// the samples come from the capture store, the acquisition of the main
+	// window has already copied the fifo
+	void Capture()
+	{
+		m_nPtr = BIOS::ADC::GetPointer();
+	}
+
 	void DrawWave()
 	{
 		ui16 col[200];
 		int nLast = 0;
-
-		BIOS::ADC::Copy( BIOS::ADC::GetCount() );
-		int nPtr = BIOS::ADC::GetPointer();
+		int nPtr = m_nPtr;
 
 		for ( int y = 0; y < (int)COUNT(col); y++ )
 			col[y] = RGB565(101010);
@@ -57,11 +67,7 @@ public:
 
 		for (ui16 x=0; x<BIOS::ADC::GetCount(); x++)
 		{
-			BIOS::ADC::SSample Sample;
-
-			Sample.nValue = BIOS::ADC::GetAt(x);
-
-			int ch1 = Sample.CH1*COUNT(col)/256;
+			int ch1 = CCaptureStore::GetAnalogAt( CCaptureStore::CH1, x )*COUNT(col)/256;
 			col[ch1] = RGB565(ffff00);
 
 			int nX = x*400/BIOS::ADC::GetCount();
@@ -97,6 +103,12 @@ public:
 			return;
 		}
 
+		if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'a') )
+		{
+			Capture();
+			return;
+		}
+
 		if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'g') )
 		{
 			DrawWave();
@@ -150,7 +150,7 @@ public:
 			return;
 		}
 
-		if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'g') )
+		if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'a') )
 		{
 			m_nCounter++;
 			BIOS::SYS::Beep(20);
@@ -1,6 +1,7 @@
 #include "Meter.h"
 #ifdef ENABLE_MODULE_METER
 #include <Source/Core/Settings.h>
+#include <Source/Gui/Oscilloscope/Core/CaptureStore.h>
 #include <string.h>
 
 void CWndUserMeter::OnPaint()
@@ -128,7 +129,7 @@ void CWndUserMeter::OnWave()
 	int nMax = -1, nMin = -1;
 	for (int i=0; i</*BIOS::ADC::Length()*/ (int)BIOS::ADC::GetCount(); i++)
 	{
-		int nValue = BIOS::ADC::GetAt(i)&0xff;
+		int nValue = CCaptureStore::GetAnalogAt( CCaptureStore::CH1, i );
 		if ( nMax == -1 )
 			nMax = nMin = nValue;
 		else
@@ -53,7 +53,8 @@ public:
 			return;
 		}
 
-		if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'g') )
+		// the reading is painted by the timer
+		if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'a') )
 		{
 			OnWave();
 			return;
@@ -68,7 +68,7 @@ void CWndPidRegulator::Process()
 	for (int i=50; i<256+50; i++)
 	{
 		BIOS::ADC::SSample Sample;
-		Sample.nValue = BIOS::ADC::GetAt(i);
+		Sample.nValue = CCaptureStore::GetAt(i);
 		nSum += Sample.CH1;
 	}
 
@@ -575,7 +575,7 @@ void CWndPidRegulator::OnMessage(CWnd* pSender, ui16 code, ui32 data)
 
 LINKERSECTION(".extra")
 /*static*/ const unsigned char CWndPidRegulator::bitmapRegulator[] = {
-	0x47, 0x42, 0x85, 0x03, 0xaa, 0x01, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xbe, 0xef, 0x7d, 0xde, 0xfb, 0xd6, 0x9a, 0xc6, 0x18, 0xad, 0x75, 0x9c, 0xd3, 0x7b, 0xef, 0x6b, 0x6d, 0x5a, 0xcb, 0x42, 0x28, 
+	0x47, 0x53, 0x85, 0x03, 0xaa, 0x01, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xbe, 0xef, 0x7d, 0xde, 0xfb, 0xd6, 0x9a, 0xc6, 0x18, 0xad, 0x75, 0x9c, 0xd3, 0x7b, 0xef, 0x6b, 0x6d, 0x5a, 0xcb, 0x42, 0x28, 
 	0x31, 0x86, 0x21, 0x24, 0x00, 0x20, 0xa8, 0x20, 0x03, 0xeb, 0x14, 0x01, 0x98, 0x50, 0x29, 0xfd, 0xcb, 0x1e, 0x0d, 0xd8, 0x40, 0x2d, 0x50, 0x31, 0x02, 0xf4, 0x10, 0x2b, 0x31, 0x02, 0xf1, 0x10, 
 	0x01, 0xa0, 0x08, 0x85, 0x01, 0xaa, 0xcb, 0x10, 0x15, 0xdd, 0x84, 0x01, 0xd5, 0xcb, 0x10, 0x1a, 0xa9, 0x85, 0x01, 0xaa, 0xcb, 0x10, 0x15, 0xdd, 0x84, 0x01, 0xd5, 0xcb, 0x10, 0x1a, 0xa9, 0x85, 
 	0x01, 0xaa, 0xcb, 0x10, 0x15, 0xdd, 0x84, 0x01, 0xd5, 0xcb, 0x10, 0x1a, 0xa9, 0x85, 0x01, 0xaa, 0xcb, 0x10, 0x15, 0xdd, 0x84, 0x01, 0xd5, 0xcb, 0x10, 0x1a, 0xa9, 0x85, 0x01, 0xaa, 0xf8, 0x10, 
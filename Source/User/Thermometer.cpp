@@ -121,7 +121,7 @@ void CWndThermometer::OnMessage(CWnd* pSender, ui16 code, ui32 data)
 
 LINKERSECTION(".extra")
 /*static*/ const unsigned char CWndThermometer::bitmapThermometer[] = {
-	0x47, 0x42, 0x3a, 0xd7, 0x01, 0x00, 0x1f, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x3e, 0x10, 0x9e, 0x10, 0x97, 0x08, 0x70, 0x08, 0x49, 0x08, 0x41, 0xff, 0xff, 0xf7, 0x9e, 0xde, 0xfb, 0xb5, 0x96, 0x94, 
+	0x47, 0x53, 0x3a, 0xd7, 0x01, 0x00, 0x1f, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x3e, 0x10, 0x9e, 0x10, 0x97, 0x08, 0x70, 0x08, 0x49, 0x08, 0x41, 0xff, 0xff, 0xf7, 0x9e, 0xde, 0xfb, 0xb5, 0x96, 0x94, 
 	0x92, 0x63, 0x0c, 0x39, 0xc7, 0x83, 0x93, 0xac, 0xef, 0x38, 0x3f, 0xec, 0xaf, 0x49, 0x1a, 0xd1, 0x81, 0x77, 0x36, 0x07, 0x18, 0x2f, 0xda, 0xb5, 0x95, 0xac, 0xf8, 0x75, 0x74, 0x45, 0x78, 0xfc, 
 	0xa4, 0x93, 0xd8, 0x75, 0xb1, 0x40, 0x61, 0x81, 0xda, 0xe4, 0x91, 0xbd, 0x18, 0x05, 0xe1, 0x42, 0x78, 0xde, 0x39, 0x2c, 0x87, 0x82, 0x40, 0x51, 0x81, 0xdb, 0xa4, 0x94, 0xac, 0xf8, 0x5a, 0x24, 
 	0x27, 0x8b, 0xb3, 0x92, 0xe8, 0x5b, 0x24, 0x46, 0x8e, 0xba, 0xf3, 0x91, 0xbd, 0x18, 0x04, 0xc2, 0x42, 0x68, 0xb9, 0x39, 0x1e, 0x8e, 0x24, 0x46, 0x8e, 0xca, 0xd3, 0x94, 0xbd, 0xf8, 0x5e, 0x24, 
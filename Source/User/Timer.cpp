@@ -137,7 +137,7 @@ void CWndUserTimer::DrawNumbers( char* numbers, ui16 clrBack, ui16 clrFront1, ui
 	}
 	x += bmpDigit.m_width;
 	x += 8;
-	bmpDots.Blit ( x, y+12 );
+	bmpDots.Blit ( x, y+12, true );
 	x += 8;
 
 	x += bmpDots.m_width;
@@ -1,4 +1,5 @@
 #include "Tuner.h"
+#include <Source/Gui/Oscilloscope/Core/CaptureStore.h>
 
 #ifdef ENABLE_MODULE_TUNER
 
@@ -6,6 +7,8 @@
 {
 	CWnd::Create("CWndTuner", dwFlags | CWnd::WsNoActivate | CWnd::WsListener, CRect(0, 16, 400, 240), pParent);
 	m_bWave = false;
+	m_fFundamental = 0;
+	memset( m_arrSpectrum, 0, sizeof(m_arrSpectrum) );
 }
 
 /*virtual*/ void CWndTuner::OnPaint()
@@ -32,7 +35,8 @@
 		BIOS::LCD::Print( 240, BIOS::LCD::LcdHeight-41, RGB565(ff0000), RGBTRANS, "Spectrum");
 	}
 
-	float fBestFreq = GetFundamental();
+	DrawSpectrum();
+	float fBestFreq = m_fFundamental;
 	if ( fBestFreq == 0 )
 	{
 		BIOS::LCD::Bar(m_rcClient.left, m_rcClient.bottom-16, m_rcClient.right, m_rcClient.bottom, RGB565(b0b0b0));
@@ -227,6 +231,12 @@ void CWndTuner::DrawPiano()
 {
 	static int nOldResolution, nOldSync;
 
+ 	if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'a') )
+	{
+		m_fFundamental = GetFundamental();
+		return;
+	}
+
  	if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'g') )
 	{
 		m_bWave = true;
@@ -258,20 +268,22 @@ void CWndTuner::DrawPiano()
 float CWndTuner::GetFundamental()
 {
 	int nLength = 1024;
-	si16* pWaveformR = (si16*)(PVOID)&BIOS::ADC::GetAt(4096-2048);
+	si16* pWaveformR = (si16*)(PVOID)CCaptureStore::GetScratch();
 	si16* pWaveformI = pWaveformR + nLength;
 
 	CFft<1024> fft;
 
 	CRect rcSpec(200, 150, 340, 200 );
 	//BIOS::LCD::Bar(rcSpec, RGB565(808080));
+	_ASSERT( rcSpec.Width() == COUNT(m_arrSpectrum) );
+	memset( m_arrSpectrum, 0, sizeof(m_arrSpectrum) );
 
 	int nOffset = Settings.Time.InvalidFirst;
 
 	for ( int i = 0; i < nLength; i++ )
 	{
 		BIOS::ADC::SSample Sample;
-		Sample.nValue = BIOS::ADC::GetAt( nOffset + i );
+		Sample.nValue = CCaptureStore::GetAt( nOffset + i );
 		int nSample = Sample.CH1;
 		int nWindow = fft.Hann( i );
 		nSample = ( nSample * nWindow ) >> (16-7);
@@ -295,8 +307,6 @@ float CWndTuner::GetFundamental()
 	float fBestIndex = (float)nIndexBegin;
 	int nBestAmplSq = 0;
 	int nAmplSq[3] = {0, 0, 0};
-	const ui16 arrPattern[] = { RGB565(ff8080), RGB565(ff0000), RGB565(ff1010), RGB565(ffd0d0) };
-
 	_ASSERT( nIndexBegin > 5 && nIndexEnd - nIndexBegin > 200 );
 
 	int nAverage = 0;
@@ -330,11 +340,7 @@ float CWndTuner::GetFundamental()
 			nSpecY += 1;
 			UTILS.Clamp<int>(nSpecY, 0, rcSpec.Height() );
 			for (int x=nSpecPrevX+1; x<nSpecDispX; x++)
-			{
-				int _x = rcSpec.left + x;
-				BIOS::LCD::Line( _x, rcSpec.top, _x, rcSpec.bottom-nSpecY, RGB565(ffffff));
-				BIOS::LCD::Pattern( _x, rcSpec.bottom-nSpecY, _x+1, rcSpec.bottom, arrPattern, COUNT(arrPattern) );
-			}
+				m_arrSpectrum[x] = (ui8)nSpecY;
 			nSpecMax = 0;
 			nSpecPrevX = nSpecDispX;
 		}
@@ -372,9 +378,24 @@ float CWndTuner::GetFundamental()
 	return fBestIndex/nLength*(fSampling);
 }
 
+void CWndTuner::DrawSpectrum()
+{
+	CRect rcSpec(200, 150, 340, 200 );
+	const ui16 arrPattern[] = { RGB565(ff8080), RGB565(ff0000), RGB565(ff1010), RGB565(ffd0d0) };
+
+	for (int x=0; x<rcSpec.Width(); x++)
+	{
+		int _x = rcSpec.left + x;
+		int nSpecY = m_arrSpectrum[x];
+		BIOS::LCD::Line( _x, rcSpec.top, _x, rcSpec.bottom-nSpecY, RGB565(ffffff));
+		if ( nSpecY > 0 )
+			BIOS::LCD::Pattern( _x, rcSpec.bottom-nSpecY, _x+1, rcSpec.bottom, arrPattern, COUNT(arrPattern) );
+	}
+}
+
 LINKERSECTION(".extra")
 /*const*/ const unsigned char CWndTuner::bitmapTuner[] = {
-	0x47, 0x42, 0xed, 0x01, 0x32, 0xff, 0xff, 0xff, 0xff, 0x10, 0x17, 0x10, 0x30, 0x41, 0xb4, 0x08, 0x24, 0x73, 0x56, 0x7b, 0xd0, 0x9c, 0xd3, 0xad, 0x76, 0xbd, 0xf8, 0xf7, 0x9e, 0xde, 0xdb, 0xce, 
+	0x47, 0x53, 0xed, 0x01, 0x32, 0xff, 0xff, 0xff, 0xff, 0x10, 0x17, 0x10, 0x30, 0x41, 0xb4, 0x08, 0x24, 0x73, 0x56, 0x7b, 0xd0, 0x9c, 0xd3, 0xad, 0x76, 0xbd, 0xf8, 0xf7, 0x9e, 0xde, 0xdb, 0xce, 
 	0x79, 0xff, 0xdf, 0xe7, 0x3c, 0xa9, 0xf1, 0x01, 0xa7, 0x25, 0x0a, 0x1e, 0x01, 0x21, 0x00, 0xd8, 0x20, 0x09, 0x37, 0x05, 0x81, 0x50, 0xd1, 0xe0, 0x12, 0x10, 0x08, 0xb1, 0x00, 0x11, 0xe3, 0xbb, 
 	0xf7, 0x92, 0x50, 0x71, 0x70, 0x0e, 0xf1, 0x01, 0x11, 0x1e, 0x2b, 0xba, 0x65, 0x0c, 0xf4, 0x01, 0x19, 0x25, 0x57, 0xac, 0x75, 0x71, 0xf0, 0xb1, 0xe0, 0x13, 0x00, 0xa1, 0x00, 0x1a, 0xe1, 0x01, 
 	0x88, 0xe2, 0x53, 0x7d, 0xcf, 0x1b, 0x0e, 0x11, 0x00, 0xea, 0x10, 0x11, 0xe1, 0xb2, 0xcc, 0xd1, 0xa3, 0x99, 0xa9, 0x4a, 0x08, 0x27, 0x05, 0xb1, 0x51, 0x7b, 0xbd, 0x10, 0x01, 0x21, 0x7e, 0x17, 
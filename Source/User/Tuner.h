@@ -22,6 +22,9 @@ class CWndTuner : public CWnd
 {
 	static const unsigned char bitmapTuner[];
 	bool m_bWave;
+	// analysis of the last waveform, painted with the next frame
+	float m_fFundamental;
+	ui8 m_arrSpectrum[140];
 
 public:
 	virtual void Create(CWnd *pParent, ui16 dwFlags);
@@ -30,6 +33,7 @@ public:
 
 protected:
 	float GetFundamental();
+	void DrawSpectrum();
 	void DrawPiano();
 	void DrawKey(int, bool);
 	void DrawScale();
@@ -5,6 +5,8 @@ ADD_MODULE( "Zoom", CWndZoomView )
 #define __ZOOMVIEW_H__
 
 #include <Source/Framework/Wnd.h>
+#include <Source/Gui/Oscilloscope/Core/Interpolator.h>
+#include <Source/Gui/Oscilloscope/Core/CaptureStore.h>
 
 class CWndZoomView : public CWnd
 {
@@ -13,6 +15,8 @@ class CWndZoomView : public CWnd
 
 	int nViewBegin;
 	int nViewEnd;
+	// write pointer at the last acquisition
+	int m_nPtr;
 
 public:
 	virtual void Create(CWnd *pParent, ui16 dwFlags)
@@ -27,12 +31,14 @@ public:
 
 		nViewBegin = 0;
 		nViewEnd = BIOS::ADC::GetCount()-1;
+		m_nPtr = 0;
 	}
 
 	virtual void OnTimer()
 	{
 		if ( HasOverlay() )
 			return;
+		Capture();
 		NormalDraw();
 	}
 
@@ -64,78 +70,29 @@ public:
 		int nRight = nLeft+1;
 		int nPart = nIndex & 0xff;
 
-		int nValLeft = BIOS::ADC::GetAt( nLeft ) & 0xff;
-		int nValRight = BIOS::ADC::GetAt( nRight ) & 0xff;
+		int nValLeft = CCaptureStore::GetAnalogAt( CCaptureStore::CH1, nLeft );
+		int nValRight = CCaptureStore::GetAnalogAt( CCaptureStore::CH1, nRight );
 		return nValLeft + (nValRight - nValLeft)*nPart/256;
 	}
 
-	int GetInterpolatedSincAnalytic(int nIndex)
+	// band limited reconstruction of CH1, nIndex has 8 bit fraction
+	int GetInterpolated(int nIndex)
 	{
-		int nMid = nIndex/256;
-		int nMin = nMid-10;
-		int nMax = nMid+10;
-		nMin = max(0, nMin);
-		nMax = min(4095, nMax);
-
-		float fSum = 0;
-		for (int i=nMin; i<=nMax; i++)
-		{
-			int nSample = BIOS::ADC::GetAt( i ) & 0xff;
-			float fRelTime = i - nIndex / 256.0f;
-			float fSi;
-			if ( fRelTime == 0 )
-				fSi = 1;
-			else
-			{
-				fRelTime *= 3.141592f;
-				fSi = sin(fRelTime)/fRelTime;
-			}
-			fSum += fSi * nSample;
-		}
-		int nSum = (int) fSum;
-		UTILS.Clamp<int>( nSum, 0, 255 );
-		return nSum;
+		return CInterpolator::GetAt( CCaptureStore::GetAnalog( CCaptureStore::CH1 ), 1,
+			CCaptureStore::Length, nIndex );
 	}
 
-	int GetInterpolated(int nIndex)
+	// the samples come from the capture store, the acquisition of the main
+	// window has already copied the fifo
+	void Capture()
 	{
-		int nMid = nIndex/256;
-		int nMin = nMid-10;
-		int nMax = nMid+10;
-		nMin = max(0, nMin);
-		nMax = min(4095, nMax);
-		
-		float fSin = sin( (nIndex & 0xff)/256.0f * 3.14159265f );
-
-		float fSum = 0;
-		for (int i=nMin; i<=nMax; i++)
-		{
-			int nSample = BIOS::ADC::GetAt( i ) & 0xff;
-			float fRelTime = i - nIndex / 256.0f;
-			float fSi;
-			if ( fRelTime == 0 )
-				fSi = 1;
-			else
-			{
-				fRelTime *= 3.141592f;
-				if ((i-nMid+1)&1)
-					fSi = -fSin/fRelTime;
-				else
-					fSi = fSin/fRelTime;
-			}
-			fSum += fSi * nSample;
-		}
-		int nSum = (int) fSum;
-		UTILS.Clamp<int>( nSum, 0, 255 );
-		return nSum;
+		m_nPtr = BIOS::ADC::GetPointer();
 	}
 
 	void DrawWave(int nPixelLeft = 0, int nPixelRight = 400)
 	{
 		ui16 col[198];
-
-		BIOS::ADC::Copy( BIOS::ADC::GetCount() );
-		int nPtr = BIOS::ADC::GetPointer();
+		int nPtr = m_nPtr;
 
 		for ( int y = 0; y < (int)COUNT(col); y++ )
 			col[y] = RGB565(101010);
@@ -164,9 +121,7 @@ public:
 
 				for ( int i=nBegin; i<nEnd; i++ )
 				{
-					BIOS::ADC::SSample Sample;
-					Sample.nValue = BIOS::ADC::GetAt(i);
-					int ch1 = Sample.CH1*COUNT(col)/256;
+					int ch1 = CCaptureStore::GetAnalogAt( CCaptureStore::CH1, i )*COUNT(col)/256;
 					col[ch1] = RGB565(ffff00);
 
 					if ( i==nBegin )
@@ -205,19 +160,14 @@ public:
 			int nPixelStart = max(nPixelLeft-1, 0);
 			for (int x=nPixelStart; x<nPixelRight; x++)
 			{
-				BIOS::ADC::SSample Sample;
-
 				int nFixIndex = x*(nViewEnd - nViewBegin+1)*256/400 + nViewBegin*256;
 				int nIndex = nFixIndex >> 8;
 				bool bMatch = (x > nPixelStart) && (nLastIndex != nIndex);
 				nLastIndex = nIndex;
 
-				if ( bMatch )
-					Sample.nValue = BIOS::ADC::GetAt( nIndex );
-				else
-					Sample.CH1 = GetInterpolated(nFixIndex);
-
-				int ch1 = Sample.CH1*COUNT(col)/256;
+				int nValue = bMatch ? CCaptureStore::GetAnalogAt( CCaptureStore::CH1, nIndex ) :
+					GetInterpolated(nFixIndex);
+				int ch1 = nValue*COUNT(col)/256;
 				
 				for ( int y = 0; y < (int)COUNT(col); y++ )
 					col[y] = RGB565(101010);
@@ -280,6 +230,12 @@ public:
 			return;
 		}
 
+		if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'a') )
+		{
+			Capture();
+			return;
+		}
+
 		if ( pSender == NULL && code == WmBroadcast && data == ToWord('d', 'g') )
 		{
 			DrawWave();